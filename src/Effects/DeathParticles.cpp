@@ -1,5 +1,7 @@
 #include "DeathParticles.h"
-#include "Utils/TransformUpdater.h" // WorldTransformUpdate を使うために必要
+#include "Render/RenderSnapshot.h"
+#include "System/GameTime.h"
+#include "Utils/WorldTransformBatch.h"
 #include <algorithm>
 
 using namespace KamataEngine;
@@ -53,8 +55,8 @@ void DeathParticles::Update() {
 		return;
 	}
 
-	// カウンターを1フレーム分の秒数進める(60fps固定を想定)
-	counter_ += 1.0f / 60.0f;
+	// カウンターを1ステップ分の秒数進める
+	counter_ += GameTime::GetDeltaTime();
 
 	// 存続時間の上限に達したら
 	if (counter_ >= kDuration) {
@@ -72,14 +74,8 @@ void DeathParticles::Update() {
 
 	// 3. 8個のパーティクルにスケールと移動を適用する
 	for (uint32_t i = 0; i < kNumParticles; ++i) {
-		// 基本となる速度ベクトル（右方向）
-		Vector3 velocity = {kSpeed, 0.0f, 0.0f};
-		// 回転角を計算する
-		float angle = kAngleUnit * i;
-		// Z軸まわり回転行列を生成
-		Matrix4x4 matrixRotation = TransformUpdater::MakeRoteZMatrix(angle);
-		// 基本ベクトルを回転させて、このパーティクルの速度ベクトルを得る
-		velocity = TransformUpdater::Transform(velocity, matrixRotation);
+		// 向きの表から、このパーティクルの速度ベクトルを得る
+		Vector3 velocity = {kDirections[i].x * kSpeed, kDirections[i].y * kSpeed, 0.0f};
 		// 座標に速度を加算して移動させる
 		worldTransforms_[i].translation_ += velocity;
 
@@ -87,32 +83,28 @@ void DeathParticles::Update() {
 		worldTransforms_[i].scale_ = {currentScale, currentScale, currentScale};
 	}
 
-	// 全てのパーティクルのワールド行列を更新する
-	// (座標の変更を行列に反映させる)
+	// ワールド行列は GameScene が他の動くものとまとめて計算する（AddTransforms）
+}
+
+void DeathParticles::AddTransforms(WorldTransformBatch& batch) {
+	if (isFinished_) {
+		return;
+	}
 	for (WorldTransform& worldTransform : worldTransforms_) {
-		TransformUpdater::WorldTransformUpdate(worldTransform);
+		batch.Add(worldTransform);
 	}
 }
 
-void DeathParticles::Draw() {
+void DeathParticles::Draw(RenderSnapshot& snapshot) {
 	// 終了なら何もしない
 	if (isFinished_) {
 		return;
 	}
 
-	// DirectXCommonの取得
-	DirectXCommon* dxCommon = DirectXCommon::GetInstance();
-
-	// 3Dモデル描画前処理
-	Model::PreDraw(dxCommon->GetCommandList());
-
-	// モデルの描画
+	// モデルの描画を記録
 	// (ヒント：範囲for文)
-	for (WorldTransform& worldTransform : worldTransforms_) {
-		// 第3引数に色変更オブジェクトのアドレスを渡して、計算した色で描画する
-		model_->Draw(worldTransform, *camera_, textureHandle_, &objectColor_);
+	for (const WorldTransform& worldTransform : worldTransforms_) {
+		// 計算した色で描画する
+		snapshot.AddColoredModel(model_, worldTransform, textureHandle_, color_);
 	}
-
-	// 3Dモデル描画後処理
-	Model::PostDraw();
 }
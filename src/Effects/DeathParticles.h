@@ -1,9 +1,11 @@
 #pragma once
 #include "KamataEngine.h"
+#include "Utils/FastMath.h"
 #include <array> // std::array を使うために必要
 
 // 前方宣言
-class TransformUpdater;
+class RenderSnapshot;
+class WorldTransformBatch;
 
 /// <summary>
 /// デス演出用パーティクル
@@ -25,9 +27,14 @@ public:
 	void Update();
 
 	/// <summary>
-	/// 描画
+	/// 行列をまとめて計算してもらうため、ワールド変換を加える（再生中だけ）
 	/// </summary>
-	void Draw();
+	void AddTransforms(WorldTransformBatch& batch);
+
+	/// <summary>
+	/// 描画内容をスナップショットへ記録
+	/// </summary>
+	void Draw(RenderSnapshot& snapshot);
 
 	// パーティクルの再生を開始する
 	void Start(const KamataEngine::Vector3& position);
@@ -55,8 +62,8 @@ private:
 	static inline const float kDuration = 1.0f;
 	// 移動の速さ
 	static inline const float kSpeed = 0.1f;
-	// 分割した1個分の角度（2πラジアン ÷ 8分割）
-	static inline const float kAngleUnit = (2.0f * 3.14159265f) / kNumParticles;
+	// 各パーティクルの進む向き（円を8等分した向き。コンパイル時に計算しておく）
+	static constexpr std::array<FastMath::Direction2, kNumParticles> kDirections = FastMath::MakeDirectionTable<kNumParticles>();
 
 	// パーティクルの初期スケール
 	static inline const float kInitialScale = 0.3f;
@@ -1,21 +1,18 @@
 #include "Fade.h"
+#include "Render/RenderSnapshot.h"
+#include "Render/UiAtlas.h"
+#include "System/GameTime.h"
 #include <algorithm>
 
 using namespace KamataEngine;
 
 // 初期化処理
 void Fade::Initialize() {
-	// テクスチャハンドル
-	textureHandle_ = TextureManager::Load("white1x1.png");
-
-	// フェード用の黒いスプライトを生成する
-	sprite_ = Sprite::Create(textureHandle_, {});
-
-	// 画面全体に表示されるようにサイズを設定
-	sprite_->SetSize(Vector2{1280.0f, 720.0f});
+	// 黒くする四角形は UiAtlas の白い領域に色を掛けて描く（HUD・UI と同じテクスチャなので描画がまとまる）
+	UiAtlas::GetInstance()->Load();
 
 	// 色を黒（不透明）に設定
-	sprite_->SetColor({0.0f, 0.0f, 0.0f, 1.0f});
+	color_ = {0.0f, 0.0f, 0.0f, 1.0f};
 }
 
 // 更新処理
@@ -27,43 +24,36 @@ void Fade::Update() {
 		break;
 
 	case Status::FadeIn: { // フェードイン中の更新処理
-		// 1フレーム分の秒数をカウントアップ
-		counter_ += 1.0f / 60.0f;
+		// 1ステップ分の秒数をカウントアップ
+		counter_ += GameTime::GetDeltaTime();
 
 		// フェードインの進行度（0.0f ～ 1.0f）
 		float progress = std::fminf(counter_ / duration_, 1.0f);
 		// アルファ値を計算 (1.0 -> 0.0)
 		float alpha = 1.0f - progress;
-		sprite_->SetColor({0.0f, 0.0f, 0.0f, alpha});
+		color_ = {0.0f, 0.0f, 0.0f, alpha};
 	} break;
 
 	case Status::FadeOut: { // フェードアウト中の更新処理
-		// 1フレーム分の秒数をカウントアップ
-		counter_ += 1.0f / 60.0f;
+		// 1ステップ分の秒数をカウントアップ
+		counter_ += GameTime::GetDeltaTime();
 
 		// フェードアウトの進行度（0.0f ～ 1.0f）
 		float progress = std::fminf(counter_ / duration_, 1.0f);
 		// アルファ値を計算 (0.0 -> 1.0)
 		float alpha = progress;
-		sprite_->SetColor({0.0f, 0.0f, 0.0f, alpha});
+		color_ = {0.0f, 0.0f, 0.0f, alpha};
 	} break;
 	}
 }
 
-// 描画処理
-void Fade::Draw() {
+void Fade::Draw(RenderSnapshot& snapshot) {
 	// フェード中でなければ何もしない
 	if (status_ == Status::None) {
 		return;
 	}
-	// スプライト描画の前処理
-	Sprite::PreDraw(KamataEngine::DirectXCommon::GetInstance()->GetCommandList());
-
-	// スプライトを描画
-	sprite_->Draw();
-
-	// スプライト描画の後処理
-	Sprite::PostDraw();
+	// 画面全体に黒いスプライトを表示する
+	snapshot.AddSprite(UiAtlas::GetInstance()->Get(UiAtlas::Region::kWhite), {0.0f, 0.0f}, {1280.0f, 720.0f}, color_);
 }
 
 // フェード開始関数の実装
@@ -75,9 +65,9 @@ void Fade::Start(Status status, float duration) {
 	// フェードイン開始時はアルファ値を1(不透明)に、
 	// フェードアウト開始時はアルファ値を0(透明)に初期化する
 	if (status_ == Status::FadeIn) {
-		sprite_->SetColor({0.0f, 0.0f, 0.0f, 1.0f});
+		color_ = {0.0f, 0.0f, 0.0f, 1.0f};
 	} else if (status_ == Status::FadeOut) {
-		sprite_->SetColor({0.0f, 0.0f, 0.0f, 0.0f});
+		color_ = {0.0f, 0.0f, 0.0f, 0.0f};
 	}
 }
 
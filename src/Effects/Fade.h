@@ -1,6 +1,8 @@
 #pragma once
 #include "KamataEngine.h"
 
+class RenderSnapshot;
+
 /// <summary>
 /// フェード
 /// </summary>
@@ -13,18 +15,14 @@ public:
 	};
 
 private:
-	// テクスチャハンドル
-	uint32_t textureHandle_ = 0;
-
-	// スプライト
-	KamataEngine::Sprite* sprite_ = nullptr;
-
 	// 現在のフェードの状態
 	Status status_ = Status::None;
 	// フェードの持続時間
 	float duration_ = 0.0f;
 	// 経過時間カウンター
 	float counter_ = 0.0f;
+	// 現在の色（スプライトへは描画時に反映する）
+	KamataEngine::Vector4 color_ = {0.0f, 0.0f, 0.0f, 1.0f};
 
 public:
 	/// <summary>
@@ -38,9 +36,9 @@ public:
 	void Update();
 
 	/// <summary>
-	/// 描画
+	/// 描画内容をスナップショットへ記録
 	/// </summary>
-	void Draw();
+	void Draw(RenderSnapshot& snapshot);
 
 	// フェード開始
 	void Start(Status status, float duration);
@@ -1,4 +1,5 @@
 #include "Skydome.h"
+#include "Render/RenderSnapshot.h"
 #include "Utils/TransformUpdater.h"
 
 using namespace KamataEngine;
@@ -19,20 +20,8 @@ void Skydome::Initialize(KamataEngine::Model* model, uint32_t textureHandle, Kam
 
 void Skydome::Update() {
 
-	// 行列の更新と転送
-	TransformUpdater::WorldTransformUpdate(worldTransform_);
-	worldTransform_.TransferMatrix();
+	// 行列の更新と転送（動かないので最初の1回だけ行われる）
+	TransformUpdater::WorldTransformUpdate(worldTransform_, transformCache_);
 }
 
-void Skydome::Draw() {
-	// DirectXCommonの取得
-	KamataEngine::DirectXCommon* dxCommon = KamataEngine::DirectXCommon::GetInstance();
-
-	// 3Dモデル描画前処理
-	KamataEngine::Model::PreDraw(dxCommon->GetCommandList());
-
-	model_->Draw(worldTransform_, *camera_, textureHandle_);
-
-	// 3Dモデル描画後処理
-	KamataEngine::Model::PostDraw();
-}
\ No newline at end of file
+void Skydome::Draw(RenderSnapshot& snapshot) { snapshot.AddModel(model_, worldTransform_, textureHandle_); }
@@ -1,5 +1,8 @@
 #pragma once
 #include "KamataEngine.h"
+#include "Utils/TransformUpdater.h"
+
+class RenderSnapshot;
 
 /// <summary>
 /// 天球
@@ -8,6 +11,7 @@ class Skydome {
 private:
 	// 座標変換
 	KamataEngine::WorldTransform worldTransform_;
+	TransformCache transformCache_;
 	// カメラ
 	KamataEngine::Camera* camera_;
 
@@ -27,7 +31,7 @@ public:
 	void Update();
 
 	/// <summary>
-	/// 描画
+	/// 描画内容をスナップショットへ記録
 	/// </summary>
-	void Draw();
+	void Draw(RenderSnapshot& snapshot);
 };
\ No newline at end of file
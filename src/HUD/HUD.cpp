@@ -1,137 +1,28 @@
 #include "HUD.h"
 #include "Objects/Player.h"
-#include <string>
+#include "Render/RenderSnapshot.h"
+#include "Render/UiAtlas.h"
 
 using namespace KamataEngine;
 
 void HUD::Initialize() {
-	// HPの読み込み（既存）
-	hpHandle_ = TextureManager::GetInstance()->Load("HUD/HP.png");
-	for (int i = 0; i < 3; ++i) {
-		hpSprite_[i] = Sprite::Create(hpHandle_, {50, 50});
-		hpSprite_[i]->SetSize({50, 50});
-
-		// 同じ hpHandle_ (ハート画像) を使って別のスプライトを作る
-		hpBackSprite_[i] = Sprite::Create(hpHandle_, {50, 50});
-		hpBackSprite_[i]->SetSize({50, 50});
-
-		// 元の画像の色にこの色が乗算されるため、(0,0,0)を指定すると真っ黒になります
-		hpBackSprite_[i]->SetColor({0.0f, 0.0f, 0.0f, 1.0f});
+	// ハート・「STAGE 1-」の文字・数字（0 ～ 9）の画像は全て UiAtlas の領域
+	// 背景の黒いハートも同じハート画像で描く（スプライトは描画側がまとめて持つ）
+	UiAtlas::GetInstance()->Load();
 
+	for (int i = 0; i < StageDraw::kHeartCount; ++i) {
 		// 最初は大きさ 1.0 (最大) にしておく
 		heartScales_[i] = 1.0f;
 	}
-
-	// ★追加: 「STAGE 1-」画像の読み込み
-	// ※画像ファイル "Resources/HUD/stage_text.png" を用意してください
-	stageTextHandle_ = TextureManager::GetInstance()->Load("number/STAGE1.png");
-	stageTextSprite_ = Sprite::Create(stageTextHandle_, {0, 0});
-	// サイズや基準点は適宜調整してください（例: 幅256, 高さ64）
-	stageTextSprite_->SetSize({384.0f, 64.0f});
-
-	// ★追加: 数字画像（0.png ～ 9.png）の読み込み
-	for (int i = 0; i < 10; ++i) {
-		// ファイルパスを作成（例: HUD/0.png, HUD/1.png ...）
-		std::string path = "number/" + std::to_string(i) + ".png";
-		numberHandles_[i] = TextureManager::GetInstance()->Load(path);
-
-		// スプライト生成
-		numberSprites_[i] = Sprite::Create(numberHandles_[i], {0, 0});
-		// サイズを適宜設定（例: 64x64）
-		numberSprites_[i]->SetSize({64.0f, 64.0f});
-	}
 }
 
-void HUD::Update() {}
-
-void HUD::Draw(const Player* player) {
-	KamataEngine::DirectXCommon* dxCommon = KamataEngine::DirectXCommon::GetInstance();
-
-	Sprite::PreDraw(dxCommon->GetCommandList());
-
-	for (int i = 0; i < 3; ++i) {
-		hpSpritePosition_[i] = {64.0f + float(i) * 60.0f, 50.0f};
-
-		// --- 1. アニメーション計算 ---
-		// このハートがあるべき目標の大きさ（HPが残っていれば1.0、なければ0.0）
-		float targetScale = (i < player->GetHp()) ? 1.0f : 0.0f;
-
-		// 変化のスピード (値が小さいほどゆっくり消える)
-		float speed = 0.05f;
-
-		// 現在の大きさを目標に近づける
-		if (heartScales_[i] < targetScale) {
-			heartScales_[i] = std::fminf(heartScales_[i] + speed, targetScale); // 回復時：大きくする
-		} else {
-			heartScales_[i] = std::fmaxf(heartScales_[i] - speed, targetScale); // ダメージ時：小さくする
-		}
-
-		// --- 2. 背景（黒いハート）を描画 ---
-		// 背景はずっとサイズ固定
-		hpBackSprite_[i]->SetSize({50.0f, 50.0f});
-		hpBackSprite_[i]->SetPosition(hpSpritePosition_[i]);
-		hpBackSprite_[i]->Draw();
-
-		// --- 3. 赤いハートを描画 ---
-		// 大きさが0より大きいときだけ描画する
-		if (heartScales_[i] > 0.0f) {
-			// 現在のスケールに基づいてサイズを計算
-			float currentSize = 50.0f * heartScales_[i];
-
-			// ★重要: 小さくなるときに「中心に向かって」縮むように位置を調整
-			// (元のサイズ50 - 今のサイズ) / 2 だけ右下にずらす
-			float offset = (50.0f - currentSize) / 2.0f;
-			Vector2 drawPos = {hpSpritePosition_[i].x + offset, hpSpritePosition_[i].y + offset};
-
-			hpSprite_[i]->SetSize({currentSize, currentSize});
-			hpSprite_[i]->SetPosition(drawPos);
-			hpSprite_[i]->Draw();
-		}
+void HUD::Update(const Player* player) {
+	for (int i = 0; i < StageDraw::kHeartCount; ++i) {
+		// HPが残っていれば 1.0、なければ 0.0 へ近づける
+		heartScales_[i] = StageDraw::StepHeartScale(heartScales_[i], i < player->GetHp());
 	}
-
-	Sprite::PostDraw();
 }
 
-void HUD::DrawStageNumber(int stageNo) {
-	KamataEngine::DirectXCommon* dxCommon = KamataEngine::DirectXCommon::GetInstance();
-
-	// 描画開始
-	Sprite::PreDraw(dxCommon->GetCommandList());
-
-	// 1. 「STAGE 1-」の画像を表示
-	// 画面中央より少し左に配置（座標は調整してください）
-	Vector2 textPos = {400.0f, 300.0f};
-	stageTextSprite_->SetPosition(textPos);
-	stageTextSprite_->Draw();
-
-	// 2. 数字の画像を表示
-	// stageNo に対応する数字画像を表示します。
-
-	// 画像の幅（数字の表示位置をずらすため）
-	float numberWidth = 64.0f; // ※実際の画像の幅に合わせてください
-
-	// 「STAGE 1-」の右側に数字を表示
-	Vector2 numPos = {textPos.x + 340.0f, textPos.y}; // 文字の横幅分ずらす
-
-	// ステージ番号が2桁の場合（例: 10）の対応
-	if (stageNo >= 10) {
-		// 10の位
-		int digit10 = stageNo / 10;
-		numberSprites_[digit10]->SetPosition(numPos);
-		numberSprites_[digit10]->Draw();
-
-		// 1の位の位置へずらす
-		numPos.x += numberWidth;
-
-		// 1の位
-		int digit1 = stageNo % 10;
-		numberSprites_[digit1]->SetPosition(numPos);
-		numberSprites_[digit1]->Draw();
-	} else {
-		// 1桁の場合 (0-9)
-		numberSprites_[stageNo]->SetPosition(numPos);
-		numberSprites_[stageNo]->Draw();
-	}
+void HUD::Draw(RenderSnapshot& snapshot) { StageDraw::AddHearts(snapshot, UiAtlas::GetInstance()->GetTextureHandle(), heartScales_); }
 
-	Sprite::PostDraw();
-}
\ No newline at end of file
+void HUD::DrawStageNumber(RenderSnapshot& snapshot, int stageNo) { StageDraw::AddStageNumber(snapshot, UiAtlas::GetInstance()->GetTextureHandle(), stageNo); }
\ No newline at end of file
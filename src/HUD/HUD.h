@@ -1,33 +1,22 @@
 #pragma once
 #include "KamataEngine.h"
+#include "Render/StageDraw.h"
 
 class Player;
+class RenderSnapshot;
 
 class HUD {
 public:
 	void Initialize();
-	void Update();
-	void Draw(const Player* player);
+	// ハートのアニメーション更新
+	void Update(const Player* player);
+	// 描画内容をスナップショットへ記録
+	void Draw(RenderSnapshot& snapshot);
 
 	// ステージ番号表示
-	void DrawStageNumber(int stageNo);
+	void DrawStageNumber(RenderSnapshot& snapshot, int stageNo);
 
 private:
-	uint32_t hpHandle_;
-	KamataEngine::Sprite* hpSprite_[3] = {};
-	KamataEngine::Vector2 hpSpritePosition_[3] = {};
-	// 背景用（黒くする用）のスプライト配列
-	KamataEngine::Sprite* hpBackSprite_[3] = {};
-
-	// 各ハートの現在のスケール（0.0f ～ 1.0f）
-	float heartScales_[3] = {};
-
-	//「STAGE 1-」の文字用
-	uint32_t stageTextHandle_ = 0;
-	KamataEngine::Sprite* stageTextSprite_ = nullptr;
-
-	// 数字（0～9）用
-	// 数字の画像を配列で管理します（インデックスがそのまま数字に対応）
-	uint32_t numberHandles_[10] = {};
-	KamataEngine::Sprite* numberSprites_[10] = {};
+	// 各ハートの現在のスケール（0.0f ～ 1.0f。並べ方・大きさは StageDraw::AddHearts）
+	float heartScales_[StageDraw::kHeartCount] = {};
 };
\ No newline at end of file
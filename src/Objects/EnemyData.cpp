@@ -0,0 +1,21 @@
+#include "Objects/EnemyData.h"
+#include "Utils/SimConvert.h"
+#include <algorithm>
+
+using namespace KamataEngine;
+
+void SyncEnemyTransform(const EnemyHotState& hot, EnemyColdState& cold, const EnemyArchetype& archetype) {
+	WorldTransform& worldTransform = cold.worldTransform;
+	worldTransform.translation_ = ToVector3(hot.translation);
+	worldTransform.rotation_.x = hot.rotationX;
+	worldTransform.rotation_.y = hot.rotationY;
+	worldTransform.scale_ = {hot.scale, hot.scale, hot.scale};
+
+	// 縮小フェーズ中はアルファも合わせて落とす
+	if (hot.state == EnemyState::kDying && hot.deathTimer >= archetype.deathSpinDuration) {
+		float t = std::clamp((hot.deathTimer - archetype.deathSpinDuration) / archetype.deathShrinkDuration, 0.0f, 1.0f);
+		cold.color.w = 1.0f - t;
+	}
+
+	// 行列は GameScene が他の動くものとまとめて計算する（WorldTransformBatch）
+}
@@ -0,0 +1,25 @@
+#pragma once
+#include "KamataEngine.h"
+#include "Sim/SimEnemyData.h"
+#include <cstdint>
+
+/// <summary>
+/// 描画時にだけ参照するインスタンスデータ（コールド）
+/// </summary>
+struct EnemyColdState {
+	// ワールド変換データ
+	KamataEngine::WorldTransform worldTransform;
+	// 色変更オブジェクト（フェードに使用）
+	KamataEngine::ObjectColor objectColor;
+	// 色データ RGBA
+	KamataEngine::Vector4 color = {1.0f, 1.0f, 1.0f, 1.0f};
+	// モデル
+	KamataEngine::Model* model = nullptr;
+	// テクスチャハンドル
+	uint32_t textureHandle = 0u;
+};
+
+/// <summary>
+/// ホットデータをコールド側のワールド変換へ反映する（行列は WorldTransformBatch でまとめて計算する）
+/// </summary>
+void SyncEnemyTransform(const EnemyHotState& hot, EnemyColdState& cold, const EnemyArchetype& archetype);
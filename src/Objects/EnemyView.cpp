@@ -0,0 +1,53 @@
+#include "Objects/EnemyView.h"
+#include "Render/RenderSnapshot.h"
+#include "Render/StageDraw.h"
+#include "Sim/SimMath.h"
+#include "Utils/WorldTransformBatch.h"
+
+using namespace KamataEngine;
+
+void EnemyView::Initialize(KamataEngine::Model* model, uint32_t textureHandle, const EnemyArchetype& archetype) {
+	cold_->model = model;
+	cold_->textureHandle = textureHandle;
+	archetype_ = &archetype;
+
+	cold_->worldTransform.Initialize();
+	cold_->objectColor.Initialize();
+	cold_->color = {1.0f, 1.0f, 1.0f, 1.0f};
+}
+
+void EnemyView::UpdateVisibility(const EnemyHotState& hot, const ViewCulling::Rect& visibleRect) { isVisible_ = StageDraw::IsEnemyVisible(hot, previous_, visibleRect); }
+
+void EnemyView::Update(const EnemyHotState& hot, float alpha) {
+	// Dead と画面の外は行列を更新しない
+	if (!StageDraw::IsEnemyDrawn(hot, isVisible_)) {
+		return;
+	}
+
+	// 姿勢だけ直前のステップとの間を補間する（状態やタイマーは現在の値を使う）
+	EnemyHotState interpolated = hot;
+	interpolated.translation = Lerp(previous_.translation, hot.translation, alpha);
+	interpolated.rotationX = LerpAngle(previous_.rotationX, hot.rotationX, alpha);
+	interpolated.rotationY = LerpAngle(previous_.rotationY, hot.rotationY, alpha);
+	interpolated.scale = previous_.scale + (hot.scale - previous_.scale) * alpha;
+	SyncEnemyTransform(interpolated, *cold_, *archetype_);
+}
+
+void EnemyView::AddTransform(WorldTransformBatch& batch, const EnemyHotState& hot) {
+	// Dead と画面の外は描画しないので行列も要らない
+	if (!StageDraw::IsEnemyDrawn(hot, isVisible_)) {
+		return;
+	}
+	batch.Add(cold_->worldTransform);
+}
+
+void EnemyView::Draw(RenderSnapshot& snapshot, const EnemyHotState& hot) {
+	// Dead と画面の外は描画しない
+	if (!StageDraw::IsEnemyDrawn(hot, isVisible_)) {
+		return;
+	}
+
+	// 3Dモデルを記録
+	// objectColor は SetColor していない（白のまま）ので、死亡演出中も色なしで記録する
+	snapshot.AddModel(cold_->model, cold_->worldTransform, cold_->textureHandle);
+}
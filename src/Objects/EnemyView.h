@@ -0,0 +1,64 @@
+#pragma once
+#include "KamataEngine.h"
+#include "Objects/EnemyData.h"
+#include "Utils/ViewCulling.h"
+#include <memory>
+
+class RenderSnapshot;
+class WorldTransformBatch;
+
+/// <summary>
+/// 敵（表示側）
+/// 挙動は SimEnemy / SimChasingEnemy / SimShooterEnemy が持ち、ここではホットデータを描画用のコールドデータへ反映する
+/// </summary>
+class EnemyView {
+private:
+	// 描画時のみ参照するデータ（コールド）
+	std::unique_ptr<EnemyColdState> cold_ = std::make_unique<EnemyColdState>();
+	// チューニング値（死亡演出のフェードに使う）
+	const EnemyArchetype* archetype_ = nullptr;
+	// 直前のステップのホットデータ（描画時に現在の状態との間を補間する）
+	EnemyHotState previous_;
+	// カメラに映っているか（映っていなければ行列の更新も描画もしない）
+	bool isVisible_ = true;
+
+public:
+	/// <summary>
+	/// 初期化
+	/// </summary>
+	/// <param name="model">モデル</param>
+	/// <param name="textureHandle">テクスチャハンドル</param>
+	/// <param name="archetype">チューニング値</param>
+	void Initialize(KamataEngine::Model* model, uint32_t textureHandle, const EnemyArchetype& archetype);
+
+	/// <summary>
+	/// シミュレーションを1ステップ進める前に呼び、現在の状態を補間の始点として保存する
+	/// </summary>
+	void SavePreviousState(const EnemyHotState& hot) { previous_ = hot; }
+
+	/// <summary>
+	/// カメラに映っているかを決める（Update より前に呼ぶ。判定は StageDraw::IsEnemyVisible）
+	/// </summary>
+	/// <param name="hot">現在のホットデータ</param>
+	/// <param name="visibleRect">カメラに映る範囲</param>
+	void UpdateVisibility(const EnemyHotState& hot, const ViewCulling::Rect& visibleRect);
+
+	bool IsVisible() const { return isVisible_; }
+
+	/// <summary>
+	/// 更新（ホットデータをワールド変換へ反映）
+	/// </summary>
+	/// <param name="hot">現在のホットデータ</param>
+	/// <param name="alpha">直前のステップから現在のステップへの補間係数 [0, 1]</param>
+	void Update(const EnemyHotState& hot, float alpha = 1.0f);
+
+	/// <summary>
+	/// 行列をまとめて計算してもらうため、ワールド変換を加える（描画するときだけ）
+	/// </summary>
+	void AddTransform(WorldTransformBatch& batch, const EnemyHotState& hot);
+
+	/// <summary>
+	/// 描画内容をスナップショットへ記録
+	/// </summary>
+	void Draw(RenderSnapshot& snapshot, const EnemyHotState& hot);
+};
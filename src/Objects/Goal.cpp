@@ -1,4 +1,5 @@
 #include "Objects/Goal.h"
+#include "Render/RenderSnapshot.h"
 #include "Utils/TransformUpdater.h"
 
 void Goal::Initialize(KamataEngine::Model* model, const KamataEngine::Vector3& position) {
@@ -11,35 +12,14 @@ void Goal::Update() {
 	// ゴールが動いたり回転したりする場合はここに書く
 	// 今回は静的なので何もしない
 
-	// 行列の更新
-	TransformUpdater::WorldTransformUpdate(worldTransform_);
-	worldTransform_.TransferMatrix();
+	// 行列の更新（動かない間は最初の1回だけ計算される。転送は描画側）
+	TransformUpdater::UpdateMatrix(worldTransform_, transformCache_);
 }
 
-void Goal::Draw(const KamataEngine::Camera& camera) {
-
-	// DirectXCommonの取得
-	KamataEngine::DirectXCommon* dxCommon = KamataEngine::DirectXCommon::GetInstance();
-
-	// 3Dモデル描画前処理
-	KamataEngine::Model::PreDraw(dxCommon->GetCommandList());
+void Goal::Draw(RenderSnapshot& snapshot) {
 
 	if (model_) {
-		model_->Draw(worldTransform_, camera);
+		snapshot.AddModel(model_, worldTransform_);
 	}
 
-	// 3Dモデル描画後処理
-	KamataEngine::Model::PostDraw();
-
 }
-
-AABB Goal::GetAABB() {
-	// ゴールのサイズ（当たり判定の大きさ）
-	const float kWidth = 1.0f;
-	const float kHeight = 1.0f;
-
-	AABB aabb;
-	aabb.min = {worldTransform_.translation_.x - (kWidth / 2.0f), worldTransform_.translation_.y - (kHeight / 2.0f), worldTransform_.translation_.z - (kWidth / 2.0f)};
-	aabb.max = {worldTransform_.translation_.x + (kWidth / 2.0f), worldTransform_.translation_.y + (kHeight / 2.0f), worldTransform_.translation_.z + (kWidth / 2.0f)};
-	return aabb;
-}
\ No newline at end of file
@@ -1,13 +1,18 @@
 #pragma once
-#include "System/Collision.h"
 #include "KamataEngine.h"
+#include "Utils/TransformUpdater.h"
 
+class RenderSnapshot;
+
+/// <summary>
+/// ゴール（表示側）
+/// 当たり判定は SimWorld が行う
+/// </summary>
 class Goal {
 private:
 	KamataEngine::WorldTransform worldTransform_;
+	TransformCache transformCache_;
 	KamataEngine::Model* model_ = nullptr;
-	uint32_t textureHandle_ = 0u;
-	bool isHit_ = false;
 
 public:
 	/// <summary>
@@ -21,23 +26,7 @@ public:
 	void Update();
 
 	/// <summary>
-	/// 描画
-	/// </summary>
-	void Draw(const KamataEngine::Camera& camera);
-
-	/// <summary>
-	/// ワールド座標を取得
-	/// </summary>
-	KamataEngine::Vector3 GetWorldPosition();
-
-	/// <summary>
-	/// AABBを取得
-	/// </summary>
-	AABB GetAABB();
-
-	/// <summary>
-	/// ゴールに接触したかを取得する
+	/// 描画内容をスナップショットへ記録
 	/// </summary>
-	/// <returns>接触していたらtrue</returns>
-	bool IsHit() const { return isHit_; }
+	void Draw(RenderSnapshot& snapshot);
 };
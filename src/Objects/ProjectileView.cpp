@@ -0,0 +1,51 @@
+#include "Objects/ProjectileView.h"
+#include "Render/RenderSnapshot.h"
+#include "Render/StageDraw.h"
+#include "Sim/SimShooterEnemy.h"
+#include "Utils/SimConvert.h"
+#include "Utils/WorldTransformBatch.h"
+
+using namespace KamataEngine;
+
+void ProjectileView::Initialize(KamataEngine::Model* model, uint32_t textureHandle) {
+	model_ = model;
+	textureHandle_ = textureHandle;
+	activeCount_ = 0;
+}
+
+void ProjectileView::Update(const std::vector<SimShooterEnemy>& shooterEnemies, float alpha, const ViewCulling::Rect& visibleRect) {
+	activeCount_ = 0;
+	for (const SimShooterEnemy& enemy : shooterEnemies) {
+		for (const SimProjectile& projectile : enemy.GetProjectiles()) {
+			SimVector3 position;
+			if (!StageDraw::ComputeProjectilePosition(projectile, alpha, visibleRect, position)) {
+				continue;
+			}
+
+			if (activeCount_ == worldTransforms_.size()) {
+				auto newTransform = std::make_unique<WorldTransform>();
+				newTransform->Initialize();
+				newTransform->scale_ = {SimProjectile::kScale, SimProjectile::kScale, SimProjectile::kScale};
+				worldTransforms_.push_back(std::move(newTransform));
+			}
+
+			WorldTransform& worldTransform = *worldTransforms_[activeCount_++];
+			worldTransform.translation_ = ToVector3(position);
+		}
+	}
+}
+
+void ProjectileView::AddTransforms(WorldTransformBatch& batch) {
+	for (size_t i = 0; i < activeCount_; ++i) {
+		batch.Add(*worldTransforms_[i]);
+	}
+}
+
+void ProjectileView::Draw(RenderSnapshot& snapshot) {
+	if (!model_) {
+		return;
+	}
+	for (size_t i = 0; i < activeCount_; ++i) {
+		snapshot.AddModel(model_, *worldTransforms_[i], textureHandle_);
+	}
+}
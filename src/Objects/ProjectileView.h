@@ -0,0 +1,49 @@
+#pragma once
+#include "KamataEngine.h"
+#include "Utils/ViewCulling.h"
+#include <memory>
+#include <vector>
+
+class SimShooterEnemy;
+class RenderSnapshot;
+class WorldTransformBatch;
+
+/// <summary>
+/// 敵の弾（表示側）
+/// 生存している弾の数だけワールド変換を用意し、使い回して描画する
+/// </summary>
+class ProjectileView {
+private:
+	KamataEngine::Model* model_ = nullptr;
+	uint32_t textureHandle_ = 0u;
+
+	// 弾のワールド変換（足りなくなったときだけ追加する）
+	std::vector<std::unique_ptr<KamataEngine::WorldTransform>> worldTransforms_;
+	// このフレームで使用している数
+	size_t activeCount_ = 0;
+
+public:
+	/// <summary>
+	/// 初期化
+	/// </summary>
+	void Initialize(KamataEngine::Model* model, uint32_t textureHandle);
+
+	/// <summary>
+	/// 更新（全シューターの生存している弾のうち、カメラに映るものをワールド変換へ反映）
+	/// 弾は等速なので、直前のステップの位置は速度から逆算して補間する
+	/// </summary>
+	/// <param name="shooterEnemies">シューターのリスト</param>
+	/// <param name="alpha">直前のステップから現在のステップへの補間係数 [0, 1]</param>
+	/// <param name="visibleRect">カメラに映る範囲（外の弾は描画しない）</param>
+	void Update(const std::vector<SimShooterEnemy>& shooterEnemies, float alpha = 1.0f, const ViewCulling::Rect& visibleRect = ViewCulling::Rect::Infinite());
+
+	/// <summary>
+	/// 行列をまとめて計算してもらうため、使用中のワールド変換を加える
+	/// </summary>
+	void AddTransforms(WorldTransformBatch& batch);
+
+	/// <summary>
+	/// 描画内容をスナップショットへ記録
+	/// </summary>
+	void Draw(RenderSnapshot& snapshot);
+};
@@ -0,0 +1,35 @@
+#include "Render/ModelInstances.h"
+#include "Render/RenderSnapshot.h"
+
+using namespace KamataEngine;
+
+void ModelInstances::Initialize(Model* model) {
+	model_ = model;
+	textureHandle_ = 0u;
+	hasTexture_ = false;
+	matrices_.clear();
+	worldTransforms_.clear();
+}
+
+void ModelInstances::Initialize(Model* model, uint32_t textureHandle) {
+	Initialize(model);
+	textureHandle_ = textureHandle;
+	hasTexture_ = true;
+}
+
+void ModelInstances::Add(const Matrix4x4& matWorld) { matrices_.push_back(RenderSnapshot::ToRenderMatrix(matWorld)); }
+
+void ModelInstances::Build() {
+	// 足りない分だけ作り、全て転送し直す（ステージの読み込み時に一度だけ呼ばれる想定）
+	while (worldTransforms_.size() < matrices_.size()) {
+		auto worldTransform = std::make_unique<WorldTransform>();
+		worldTransform->Initialize();
+		worldTransforms_.push_back(std::move(worldTransform));
+	}
+	worldTransforms_.resize(matrices_.size());
+
+	for (size_t i = 0; i < matrices_.size(); ++i) {
+		worldTransforms_[i]->matWorld_ = RenderSnapshot::ToMatrix4x4(matrices_[i]);
+		worldTransforms_[i]->TransferMatrix();
+	}
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include "KamataEngine.h"
+#include "Render/RenderBackend.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/// <summary>
+/// 同じモデル・同じテクスチャで描く、動かない物の集まり（ステージのブロックなど）
+/// ワールド行列を1つの配列（インスタンスバッファ）にまとめて持ち、定数バッファへの転送は Build の1回だけにする。
+/// スナップショットには集まり全体を1件のコマンドとして記録する
+/// </summary>
+class ModelInstances {
+public:
+	/// <summary>
+	/// 初期化（モデル既定のテクスチャで描く）
+	/// </summary>
+	void Initialize(KamataEngine::Model* model);
+
+	/// <summary>
+	/// 初期化（テクスチャ指定）
+	/// </summary>
+	void Initialize(KamataEngine::Model* model, uint32_t textureHandle);
+
+	/// <summary>
+	/// 1つ加える（Build を呼ぶまで描画には反映されない）
+	/// </summary>
+	void Add(const KamataEngine::Matrix4x4& matWorld);
+
+	/// <summary>
+	/// 加えた行列を描画用のワールド変換へ転送する（描画側が使っていないときに呼ぶこと）
+	/// </summary>
+	void Build();
+
+	KamataEngine::Model* GetModel() const { return model_; }
+	uint32_t GetTextureHandle() const { return textureHandle_; }
+	bool HasTexture() const { return hasTexture_; }
+	size_t GetCount() const { return worldTransforms_.size(); }
+	const KamataEngine::WorldTransform& GetWorldTransform(size_t index) const { return *worldTransforms_[index]; }
+	// インスタンスバッファ（行列の配列）
+	const std::vector<RenderMatrix>& GetMatrices() const { return matrices_; }
+
+private:
+	KamataEngine::Model* model_ = nullptr;
+	uint32_t textureHandle_ = 0u;
+	bool hasTexture_ = false;
+
+	std::vector<RenderMatrix> matrices_;
+	// 転送済みのワールド変換（matrices_ と同じ順）
+	std::vector<std::unique_ptr<KamataEngine::WorldTransform>> worldTransforms_;
+};
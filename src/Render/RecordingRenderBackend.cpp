@@ -0,0 +1,86 @@
+#include "Render/RecordingRenderBackend.h"
+
+void RecordingRenderBackend::Clear() {
+	records_.clear();
+	frames_.clear();
+	hasPrevious_ = false;
+}
+
+void RecordingRenderBackend::BeginFrame(const RenderMatrix& matView, const RenderMatrix& matProjection) {
+	matView_ = matView;
+	matProjection_ = matProjection;
+	frames_.emplace_back();
+	hasPrevious_ = false;
+}
+
+void RecordingRenderBackend::DrawModel(const ModelDraw& draw) {
+	FrameSummary& frame = frames_.back();
+	++frame.modelDrawCount;
+	if (draw.isInstance) {
+		++frame.instanceDrawCount;
+	}
+	if (!hasPrevious_ || draw.model != previousModel_ || draw.hasTexture != previousHasTexture_ || draw.textureHandle != previousTextureHandle_) {
+		++frame.stateChangeCount;
+	}
+	hasPrevious_ = true;
+	previousModel_ = draw.model;
+	previousTextureHandle_ = draw.textureHandle;
+	previousHasTexture_ = draw.hasTexture;
+
+	if (!recordsDraws_) {
+		return;
+	}
+	DrawRecord& record = records_.emplace_back();
+	record.type = DrawRecord::Type::kModel;
+	record.frame = static_cast<uint32_t>(frames_.size() - 1);
+	record.model = draw.model;
+	if (draw.matWorld) {
+		record.matWorld = *draw.matWorld;
+	}
+	record.isInstance = draw.isInstance;
+	record.textureHandle = draw.textureHandle;
+	record.hasTexture = draw.hasTexture;
+	record.hasColor = draw.hasColor;
+	record.color = draw.color;
+}
+
+void RecordingRenderBackend::DrawSprites(const SpriteBatch& spriteBatch, const SpriteBatch::DrawRange& range) {
+	FrameSummary& frame = frames_.back();
+	frame.spriteQuadCount += range.quadCount;
+	++frame.spriteBatchCount;
+	++frame.stateChangeCount;
+	// スプライトの後のモデルは必ず状態が変わったものとして数える
+	hasPrevious_ = false;
+
+	if (!recordsDraws_) {
+		return;
+	}
+	const std::vector<SpriteBatch::Quad>& quads = spriteBatch.GetQuads();
+	for (uint32_t i = range.firstQuad; i < range.firstQuad + range.quadCount; ++i) {
+		const SpriteBatch::Quad& quad = quads[i];
+		DrawRecord& record = records_.emplace_back();
+		record.type = DrawRecord::Type::kSprite;
+		record.frame = static_cast<uint32_t>(frames_.size() - 1);
+		record.textureHandle = range.textureHandle;
+		record.hasTexture = true;
+		record.hasColor = true;
+		record.color = quad.color;
+		record.left = quad.left;
+		record.top = quad.top;
+		record.width = quad.width;
+		record.height = quad.height;
+		record.texcoord = quad.texcoord;
+	}
+}
+
+void RecordingRenderBackend::EndFrame() {}
+
+size_t RecordingRenderBackend::CountModelDraws(const void* model, int64_t frame) const {
+	size_t count = 0;
+	for (const DrawRecord& record : records_) {
+		if (record.type == DrawRecord::Type::kModel && record.model == model && (frame < 0 || record.frame == static_cast<uint64_t>(frame))) {
+			++count;
+		}
+	}
+	return count;
+}
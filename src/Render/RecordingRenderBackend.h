@@ -0,0 +1,97 @@
+#pragma once
+#include "Render/RenderBackend.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// 描かずに、描画の流れ（モデル・テクスチャ・行列・色）をメモリに記録する RenderBackend
+/// GPU の無い環境（Linux の CI など）で、シーンごとの描画の数を確かめたり、記録と再生にかかる CPU 時間を計ったりするのに使う
+/// </summary>
+class RecordingRenderBackend : public RenderBackend {
+public:
+	/// <summary>
+	/// 描画1回分の記録
+	/// </summary>
+	struct DrawRecord {
+		enum class Type : uint8_t {
+			kModel,
+			kSprite,
+		};
+		Type type = Type::kModel;
+		// 何フレーム目か（Clear してから 0, 1, ...）
+		uint32_t frame = 0;
+
+		// --- モデル ---
+		const void* model = nullptr;
+		RenderMatrix matWorld = {};
+		// 動かないモデルの集まりから描いたか
+		bool isInstance = false;
+
+		// --- 共通（スプライトは hasTexture が常に true） ---
+		uint32_t textureHandle = 0u;
+		bool hasTexture = false;
+		bool hasColor = false;
+		SpriteBatch::Color color = {1.0f, 1.0f, 1.0f, 1.0f};
+
+		// --- スプライト（画面のピクセル） ---
+		float left = 0.0f;
+		float top = 0.0f;
+		float width = 0.0f;
+		float height = 0.0f;
+		SpriteBatch::TexCoordRect texcoord = SpriteBatch::kFullTexture;
+	};
+
+	/// <summary>
+	/// 1フレーム分の集計
+	/// </summary>
+	struct FrameSummary {
+		uint32_t modelDrawCount = 0;
+		// そのうち動かないモデルの集まりから描いた数
+		uint32_t instanceDrawCount = 0;
+		uint32_t spriteQuadCount = 0;
+		// スプライトの描画（DrawSprites）の数
+		uint32_t spriteBatchCount = 0;
+		// 直前の描画とモデル・テクスチャが変わった回数（スプライトは DrawSprites ごと）
+		uint32_t stateChangeCount = 0;
+	};
+
+	/// <summary>
+	/// 記録を全て捨てる（確保済みの容量は再利用する）
+	/// </summary>
+	void Clear();
+
+	/// <summary>
+	/// 描画ごとの記録を残すか（false なら集計だけする。速さを計るとき用）
+	/// </summary>
+	void SetRecordsDraws(bool recordsDraws) { recordsDraws_ = recordsDraws; }
+
+	void BeginFrame(const RenderMatrix& matView, const RenderMatrix& matProjection) override;
+	void DrawModel(const ModelDraw& draw) override;
+	void DrawSprites(const SpriteBatch& spriteBatch, const SpriteBatch::DrawRange& range) override;
+	void EndFrame() override;
+
+	/// <summary>
+	/// 記録のうち、model で描いた数を数える（frame が負なら全てのフレーム）
+	/// </summary>
+	size_t CountModelDraws(const void* model, int64_t frame = -1) const;
+
+	const std::vector<DrawRecord>& GetRecords() const { return records_; }
+	const std::vector<FrameSummary>& GetFrames() const { return frames_; }
+	// 最後に BeginFrame に渡されたカメラ行列
+	const RenderMatrix& GetMatView() const { return matView_; }
+	const RenderMatrix& GetMatProjection() const { return matProjection_; }
+
+private:
+	std::vector<DrawRecord> records_;
+	std::vector<FrameSummary> frames_;
+	RenderMatrix matView_ = {};
+	RenderMatrix matProjection_ = {};
+	bool recordsDraws_ = true;
+
+	// 直前のモデル描画の状態（stateChangeCount 用）
+	bool hasPrevious_ = false;
+	const void* previousModel_ = nullptr;
+	uint32_t previousTextureHandle_ = 0u;
+	bool previousHasTexture_ = false;
+};
@@ -0,0 +1,63 @@
+#pragma once
+#include "Render/SpriteBatch.h"
+#include <cstdint>
+
+class ModelInstances;
+
+/// <summary>
+/// 行列1つ分（エンジンの Matrix4x4 と同じ並び）
+/// </summary>
+struct RenderMatrix {
+	float m[4][4];
+};
+
+/// <summary>
+/// 描画の呼び出し先
+/// RenderCommandList::Replay はこの呼び出しだけを使うので、エンジンで実際に描くもの（SnapshotRenderer）と、
+/// 描画の流れをメモリに記録するだけのもの（RecordingRenderBackend）を差し替えられる。
+/// エンジンの型を使わない（モデルは中身を見ないポインタのまま渡す）ので、エンジンの無い環境でもビルドできる
+/// </summary>
+class RenderBackend {
+public:
+	/// <summary>
+	/// モデル描画1回分
+	/// </summary>
+	struct ModelDraw {
+		// モデル（ゲームでは KamataEngine::Model*。記録するときは見分けるのにだけ使う）
+		void* model = nullptr;
+		const RenderMatrix* matWorld = nullptr;
+		uint32_t textureHandle = 0u;
+		// テクスチャを差し替えるか（false ならモデル既定のテクスチャ）
+		bool hasTexture = false;
+		// 色を乗算するか
+		bool hasColor = false;
+		SpriteBatch::Color color = {1.0f, 1.0f, 1.0f, 1.0f};
+		// 動かないモデルの集まりから描くか
+		bool isInstance = false;
+		// そのときの集まりと番号（集まりは行列を転送済み。エンジンで描くときに使う。無ければ nullptr）
+		const ModelInstances* instances = nullptr;
+		uint32_t instanceIndex = 0;
+	};
+
+	virtual ~RenderBackend() = default;
+
+	/// <summary>
+	/// 1フレームの描画を始める
+	/// </summary>
+	virtual void BeginFrame(const RenderMatrix& matView, const RenderMatrix& matProjection) = 0;
+
+	/// <summary>
+	/// モデルを1つ描く
+	/// </summary>
+	virtual void DrawModel(const ModelDraw& draw) = 0;
+
+	/// <summary>
+	/// スプライトの1つの範囲（同じテクスチャの四角形の並び）を描く
+	/// </summary>
+	virtual void DrawSprites(const SpriteBatch& spriteBatch, const SpriteBatch::DrawRange& range) = 0;
+
+	/// <summary>
+	/// 1フレームの描画を終える
+	/// </summary>
+	virtual void EndFrame() = 0;
+};
@@ -0,0 +1,177 @@
+#include "Render/RenderCommandList.h"
+#include <algorithm>
+#include <bit>
+
+void RenderCommandList::Clear() {
+	commands_.clear();
+	spriteBatch_.Clear();
+}
+
+void RenderCommandList::SetCamera(const RenderMatrix& matView, const RenderMatrix& matProjection) {
+	matView_ = matView;
+	matProjection_ = matProjection;
+}
+
+void RenderCommandList::AddModel(void* model, const RenderMatrix& matWorld) {
+	if (!model) {
+		return;
+	}
+	RenderCommand& command = commands_.emplace_back();
+	command.type = RenderCommand::Type::kModel;
+	command.model = model;
+	command.matWorld = matWorld;
+}
+
+void RenderCommandList::AddModel(void* model, const RenderMatrix& matWorld, uint32_t textureHandle) {
+	if (!model) {
+		return;
+	}
+	RenderCommand& command = commands_.emplace_back();
+	command.type = RenderCommand::Type::kModel;
+	command.model = model;
+	command.matWorld = matWorld;
+	command.textureHandle = textureHandle;
+	command.hasTexture = true;
+}
+
+void RenderCommandList::AddColoredModel(void* model, const RenderMatrix& matWorld, const SpriteBatch::Color& color) {
+	if (!model) {
+		return;
+	}
+	RenderCommand& command = commands_.emplace_back();
+	command.type = RenderCommand::Type::kModel;
+	command.model = model;
+	command.matWorld = matWorld;
+	command.hasColor = true;
+	command.color = color;
+}
+
+void RenderCommandList::AddColoredModel(void* model, const RenderMatrix& matWorld, uint32_t textureHandle, const SpriteBatch::Color& color) {
+	if (!model) {
+		return;
+	}
+	RenderCommand& command = commands_.emplace_back();
+	command.type = RenderCommand::Type::kModel;
+	command.model = model;
+	command.matWorld = matWorld;
+	command.textureHandle = textureHandle;
+	command.hasTexture = true;
+	command.hasColor = true;
+	command.color = color;
+}
+
+void RenderCommandList::AddInstances(
+    void* model, bool hasTexture, uint32_t textureHandle, const RenderMatrix* matrices, size_t totalCount, size_t first, size_t count,
+    const ModelInstances* instances) {
+	if (!model || first >= totalCount || count == 0) {
+		return;
+	}
+	RenderCommand& command = commands_.emplace_back();
+	command.type = RenderCommand::Type::kModelInstances;
+	command.model = model;
+	command.textureHandle = textureHandle;
+	command.hasTexture = hasTexture;
+	command.instances = instances;
+	command.instanceMatrices = matrices;
+	command.firstInstance = static_cast<uint32_t>(first);
+	command.instanceCount = static_cast<uint32_t>((std::min)(count, totalCount - first));
+}
+
+void RenderCommandList::AddSprite(uint32_t textureHandle, float left, float top, float width, float height, const SpriteBatch::Color& color) {
+	spriteBatch_.Add(textureHandle, left, top, width, height, color);
+}
+
+void RenderCommandList::AddSprite(const SpriteBatch::TextureRegion& region, float left, float top, float width, float height, const SpriteBatch::Color& color) {
+	spriteBatch_.Add(region, left, top, width, height, color);
+}
+
+RenderCommandList::SortGroup RenderCommandList::GetSortGroup(const RenderCommand& command) {
+	// 色のアルファが 1 未満のものは、奥から順に描かないと後ろの物が透けない
+	if (command.type == RenderCommand::Type::kModel && command.hasColor && command.color.a < 1.0f) {
+		return SortGroup::kTransparent;
+	}
+	return SortGroup::kOpaque;
+}
+
+void RenderCommandList::Sort() {
+	sortModels_.clear();
+	for (size_t i = 0; i < commands_.size(); ++i) {
+		RenderCommand& command = commands_[i];
+		SortGroup group = GetSortGroup(command);
+		uint64_t key = static_cast<uint64_t>(group) << kSortKeyGroupShift | (static_cast<uint64_t>(i) & kSortKeySequenceMask);
+
+		if (group == SortGroup::kOpaque) {
+			auto found = std::find(sortModels_.begin(), sortModels_.end(), command.model);
+			uint64_t modelIndex = static_cast<uint64_t>(found - sortModels_.begin());
+			if (found == sortModels_.end()) {
+				sortModels_.push_back(command.model);
+			}
+			// 既定のテクスチャは 0、指定したものは番号 + 1
+			uint64_t textureKey = command.hasTexture ? (static_cast<uint64_t>(command.textureHandle) + 1) & 0xFFFF : 0;
+			key |= (modelIndex & 0xFFFF) << kSortKeyModelShift | textureKey << kSortKeyTextureShift;
+		} else if (group == SortGroup::kTransparent) {
+			// ビュー空間の Z（カメラからの距離）を、大きい順に並ぶ整数にする
+			float depth = command.matWorld.m[3][0] * matView_.m[0][2] + command.matWorld.m[3][1] * matView_.m[1][2] + command.matWorld.m[3][2] * matView_.m[2][2] +
+			              matView_.m[3][2];
+			uint32_t bits = std::bit_cast<uint32_t>(depth);
+			uint32_t ordered = (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+			key |= static_cast<uint64_t>(~ordered) << kSortKeyDepthShift;
+		}
+		command.sortKey = key;
+	}
+	std::sort(commands_.begin(), commands_.end(), [](const RenderCommand& a, const RenderCommand& b) { return a.sortKey < b.sortKey; });
+
+	spriteBatch_.Build();
+}
+
+RenderCommandList::ReplayStatistics RenderCommandList::Replay(RenderBackend& backend) const {
+	ReplayStatistics statistics;
+	statistics.commandCount = static_cast<uint32_t>(commands_.size());
+
+	backend.BeginFrame(matView_, matProjection_);
+
+	// 直前のコマンドの描画の状態（集計用）
+	const RenderCommand* previous = nullptr;
+	for (const RenderCommand& command : commands_) {
+		if (!previous || command.model != previous->model || command.hasTexture != previous->hasTexture || command.textureHandle != previous->textureHandle) {
+			++statistics.stateGroupCount;
+		}
+		previous = &command;
+
+		RenderBackend::ModelDraw draw;
+		draw.model = command.model;
+		draw.textureHandle = command.textureHandle;
+		draw.hasTexture = command.hasTexture;
+		if (command.type == RenderCommand::Type::kModel) {
+			draw.matWorld = &command.matWorld;
+			draw.hasColor = command.hasColor;
+			draw.color = command.color;
+			backend.DrawModel(draw);
+			++statistics.drawCallCount;
+		} else {
+			// 行列は集まりのものをそのまま渡す（エンジンの Model にインスタンス描画が無いので、描画の呼び出し自体は1つずつ）
+			draw.isInstance = true;
+			draw.instances = command.instances;
+			uint32_t end = command.firstInstance + command.instanceCount;
+			for (uint32_t i = command.firstInstance; i < end; ++i) {
+				draw.matWorld = &command.instanceMatrices[i];
+				draw.instanceIndex = i;
+				backend.DrawModel(draw);
+			}
+			statistics.drawCallCount += command.instanceCount;
+			statistics.instanceDrawCount += command.instanceCount;
+		}
+	}
+
+	// 範囲ごとにテクスチャが1つなので、テクスチャの切り替えは範囲の数だけになる
+	for (const SpriteBatch::DrawRange& range : spriteBatch_.GetRanges()) {
+		backend.DrawSprites(spriteBatch_, range);
+		statistics.drawCallCount += range.quadCount;
+		++statistics.stateGroupCount;
+	}
+	statistics.spriteQuadCount = static_cast<uint32_t>(spriteBatch_.GetQuadCount());
+	statistics.spriteBatchCount = static_cast<uint32_t>(spriteBatch_.GetRanges().size());
+
+	backend.EndFrame();
+	return statistics;
+}
@@ -0,0 +1,162 @@
+#pragma once
+#include "Render/RenderBackend.h"
+#include "Render/SpriteBatch.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// 描画コマンド1件分（モデル描画に必要な値のコピー）
+/// </summary>
+struct RenderCommand {
+	enum class Type : uint8_t {
+		kModel,
+		kModelInstances,
+	};
+	Type type = Type::kModel;
+
+	// --- モデル（集まりのときは集まりのモデル・テクスチャ） ---
+	void* model = nullptr;
+	RenderMatrix matWorld = {};
+	uint32_t textureHandle = 0u;
+	// テクスチャを差し替えるか（false ならモデル既定のテクスチャ）
+	bool hasTexture = false;
+	// 色を乗算するか（ObjectColor を使う）
+	bool hasColor = false;
+
+	// --- 動かないモデルの集まり（行列は ModelInstances が転送済みのものを使う） ---
+	const ModelInstances* instances = nullptr;
+	// 集まりの行列の配列（instances と同じ順）
+	const RenderMatrix* instanceMatrices = nullptr;
+	// 描く範囲（firstInstance 番目から instanceCount 個）
+	uint32_t firstInstance = 0;
+	uint32_t instanceCount = 0;
+
+	// 色 RGBA（hasColor のときのみ使う）
+	SpriteBatch::Color color = {1.0f, 1.0f, 1.0f, 1.0f};
+
+	// 並べ替えの順（RenderCommandList::Sort で決まる。小さい方が先に描かれる）
+	uint64_t sortKey = 0;
+};
+
+/// <summary>
+/// 1フレーム分の描画コマンドの並び（RenderSnapshot の、エンジンに依存しない部分）
+/// 記録し終えたら Sort で描画の状態ごとにまとめ、Replay で RenderBackend へ流す。
+/// エンジンの型を使わないので、描画の数・並び・記録と再生の速さを Linux でも確かめられる
+/// </summary>
+class RenderCommandList {
+public:
+	// --- 並べ替えの順（上位ビットから） ---
+	// 描き方のグループ（2ビット）: 不透明なモデル → 半透明のモデル
+	//   不透明: モデル（16ビット。このフレームで最初に出てきた順の番号） → テクスチャ（16ビット） → 記録した順
+	//   半透明: カメラからの距離（32ビット。遠い順） → 記録した順
+	static inline const uint32_t kSortKeyGroupShift = 62;
+	static inline const uint32_t kSortKeyModelShift = 46;
+	static inline const uint32_t kSortKeyTextureShift = 30;
+	static inline const uint32_t kSortKeyDepthShift = 30;
+	static inline const uint64_t kSortKeySequenceMask = (1ull << 30) - 1;
+
+	enum class SortGroup : uint8_t {
+		kOpaque,
+		kTransparent,
+	};
+
+	/// <summary>
+	/// Replay 1回分の集計
+	/// </summary>
+	struct ReplayStatistics {
+		// コマンド数
+		uint32_t commandCount = 0;
+		// モデル・スプライトを描いた回数（スプライトは四角形ごと）
+		uint32_t drawCallCount = 0;
+		// そのうち動かないモデルの集まりから描いた数
+		uint32_t instanceDrawCount = 0;
+		// スプライトの四角形の数
+		uint32_t spriteQuadCount = 0;
+		// スプライトをテクスチャごとにまとめた描画の数（SpriteBatch::DrawRange の数）
+		uint32_t spriteBatchCount = 0;
+		// 描画の状態（モデル・テクスチャ・スプライトのテクスチャ）が変わった回数（Sort で並べていれば、使った組み合わせの数になる）
+		uint32_t stateGroupCount = 0;
+	};
+
+	/// <summary>
+	/// 記録内容を破棄する（確保済みの容量は再利用する）
+	/// </summary>
+	void Clear();
+
+	/// <summary>
+	/// カメラ行列を記録する
+	/// </summary>
+	void SetCamera(const RenderMatrix& matView, const RenderMatrix& matProjection);
+
+	/// <summary>
+	/// モデル描画を記録する（モデル既定のテクスチャ）
+	/// </summary>
+	void AddModel(void* model, const RenderMatrix& matWorld);
+
+	/// <summary>
+	/// モデル描画を記録する（テクスチャ指定）
+	/// </summary>
+	void AddModel(void* model, const RenderMatrix& matWorld, uint32_t textureHandle);
+
+	/// <summary>
+	/// 色付きのモデル描画を記録する（モデル既定のテクスチャ）
+	/// </summary>
+	void AddColoredModel(void* model, const RenderMatrix& matWorld, const SpriteBatch::Color& color);
+
+	/// <summary>
+	/// 色付きのモデル描画を記録する（テクスチャ指定）
+	/// </summary>
+	void AddColoredModel(void* model, const RenderMatrix& matWorld, uint32_t textureHandle, const SpriteBatch::Color& color);
+
+	/// <summary>
+	/// 同じモデル・テクスチャで描く行列の並びのうち、first 番目から count 個を1件として記録する（並びは描画が終わるまで変更しないこと）
+	/// </summary>
+	/// <param name="matrices">行列の並び（totalCount 個）</param>
+	/// <param name="instances">行列を転送済みの集まり（エンジンで描くときに使う。無ければ nullptr）</param>
+	void AddInstances(
+	    void* model, bool hasTexture, uint32_t textureHandle, const RenderMatrix* matrices, size_t totalCount, size_t first, size_t count,
+	    const ModelInstances* instances);
+
+	/// <summary>
+	/// スプライト描画を記録する（画面の left, top に width, height の大きさで、テクスチャ全体を貼る。Sort で SpriteBatch にまとめる）
+	/// 後から記録したものが上に重なる
+	/// </summary>
+	void AddSprite(uint32_t textureHandle, float left, float top, float width, float height, const SpriteBatch::Color& color);
+
+	/// <summary>
+	/// テクスチャの一部（UiAtlas の領域など）を貼ったスプライト描画を記録する
+	/// </summary>
+	void AddSprite(const SpriteBatch::TextureRegion& region, float left, float top, float width, float height, const SpriteBatch::Color& color);
+
+	/// <summary>
+	/// 記録したコマンドを並べ替えの順に並べる（SetCamera の後、全て記録し終えてから呼ぶ）
+	/// 同じモデル・テクスチャの描画が続き、モデルとスプライトの切り替え（PreDraw/PostDraw）は最大1回になる
+	/// スプライトは SpriteBatch::Build で重なり方を保ったままテクスチャごとにまとめる
+	/// </summary>
+	void Sort();
+
+	/// <summary>
+	/// コマンドを並んでいる順に backend へ流す（モデルを全て描いた後にスプライトを描く）
+	/// </summary>
+	ReplayStatistics Replay(RenderBackend& backend) const;
+
+	/// <summary>
+	/// コマンドの描き方のグループ
+	/// </summary>
+	static SortGroup GetSortGroup(const RenderCommand& command);
+
+	const std::vector<RenderCommand>& GetCommands() const { return commands_; }
+	// スプライト（Sort 後は描く順に並んでいる）
+	const SpriteBatch& GetSpriteBatch() const { return spriteBatch_; }
+	const RenderMatrix& GetMatView() const { return matView_; }
+	const RenderMatrix& GetMatProjection() const { return matProjection_; }
+
+private:
+	std::vector<RenderCommand> commands_;
+	SpriteBatch spriteBatch_;
+	// Sort でモデルに番号を付けるための表（確保済みの容量は再利用する）
+	std::vector<const void*> sortModels_;
+	RenderMatrix matView_ = {};
+	RenderMatrix matProjection_ = {};
+};
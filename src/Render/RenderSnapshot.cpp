@@ -0,0 +1,53 @@
+#include "Render/RenderSnapshot.h"
+#include "Render/ModelInstances.h"
+#include <bit>
+
+using namespace KamataEngine;
+
+static_assert(sizeof(RenderMatrix) == sizeof(Matrix4x4), "RenderMatrix はエンジンの Matrix4x4 と同じ並びにすること");
+
+namespace {
+
+SpriteBatch::Color ToColor(const Vector4& color) { return {color.x, color.y, color.z, color.w}; }
+
+} // namespace
+
+RenderMatrix RenderSnapshot::ToRenderMatrix(const Matrix4x4& matrix) { return std::bit_cast<RenderMatrix>(matrix); }
+
+Matrix4x4 RenderSnapshot::ToMatrix4x4(const RenderMatrix& matrix) { return std::bit_cast<Matrix4x4>(matrix); }
+
+void RenderSnapshot::SetCamera(const Camera& camera) { SetCamera(ToRenderMatrix(camera.matView), ToRenderMatrix(camera.matProjection)); }
+
+void RenderSnapshot::AddModel(Model* model, const WorldTransform& worldTransform) { AddModel(static_cast<void*>(model), ToRenderMatrix(worldTransform.matWorld_)); }
+
+void RenderSnapshot::AddModel(Model* model, const WorldTransform& worldTransform, uint32_t textureHandle) {
+	AddModel(static_cast<void*>(model), ToRenderMatrix(worldTransform.matWorld_), textureHandle);
+}
+
+void RenderSnapshot::AddColoredModel(Model* model, const WorldTransform& worldTransform, const Vector4& color) {
+	AddColoredModel(static_cast<void*>(model), ToRenderMatrix(worldTransform.matWorld_), ToColor(color));
+}
+
+void RenderSnapshot::AddColoredModel(Model* model, const WorldTransform& worldTransform, uint32_t textureHandle, const Vector4& color) {
+	AddColoredModel(static_cast<void*>(model), ToRenderMatrix(worldTransform.matWorld_), textureHandle, ToColor(color));
+}
+
+void RenderSnapshot::AddInstances(const ModelInstances& instances) { AddInstances(instances, 0, instances.GetCount()); }
+
+void RenderSnapshot::AddInstances(const ModelInstances& instances, size_t first, size_t count) {
+	AddInstances(
+	    static_cast<void*>(instances.GetModel()), instances.HasTexture(), instances.GetTextureHandle(), instances.GetMatrices().data(), instances.GetCount(), first,
+	    count, &instances);
+}
+
+void RenderSnapshot::AddSprite(uint32_t textureHandle, const Vector2& position, const Vector2& size, const Vector4& color) {
+	AddSprite(textureHandle, position.x, position.y, size.x, size.y, ToColor(color));
+}
+
+void RenderSnapshot::AddSprite(const SpriteBatch::TextureRegion& region, const Vector2& position, const Vector4& color) {
+	AddSprite(region, position.x, position.y, region.width, region.height, ToColor(color));
+}
+
+void RenderSnapshot::AddSprite(const SpriteBatch::TextureRegion& region, const Vector2& position, const Vector2& size, const Vector4& color) {
+	AddSprite(region, position.x, position.y, size.x, size.y, ToColor(color));
+}
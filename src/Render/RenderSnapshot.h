@@ -0,0 +1,84 @@
+#pragma once
+#include "KamataEngine.h"
+#include "Render/RenderCommandList.h"
+#include <cstdint>
+
+class ModelInstances;
+
+/// <summary>
+/// 1フレーム分の描画内容のスナップショット
+/// 更新側が記録し、描画側（SnapshotRenderer）が再生する。
+/// 記録中はエンジンの描画オブジェクトに一切触れないので、別スレッドで記録できる
+/// 記録し終えたら Sort で描画の状態ごとにまとめる（並べ替えの順は RenderCommandList::kSortKey～ を参照）
+/// スプライトはコマンドにせず SpriteBatch へ四角形としてため、モデルを全て描いた後にテクスチャごとにまとめて描く
+/// ここではエンジンの型で受け取って RenderCommandList に記録するだけで、並べ替え・再生は RenderCommandList が行う
+/// </summary>
+class RenderSnapshot : public RenderCommandList {
+public:
+	using RenderCommandList::AddColoredModel;
+	using RenderCommandList::AddInstances;
+	using RenderCommandList::AddModel;
+	using RenderCommandList::AddSprite;
+	using RenderCommandList::SetCamera;
+
+	/// <summary>
+	/// カメラ行列を記録する
+	/// </summary>
+	void SetCamera(const KamataEngine::Camera& camera);
+
+	/// <summary>
+	/// モデル描画を記録する（モデル既定のテクスチャ）
+	/// </summary>
+	void AddModel(KamataEngine::Model* model, const KamataEngine::WorldTransform& worldTransform);
+
+	/// <summary>
+	/// モデル描画を記録する（テクスチャ指定）
+	/// </summary>
+	void AddModel(KamataEngine::Model* model, const KamataEngine::WorldTransform& worldTransform, uint32_t textureHandle);
+
+	/// <summary>
+	/// 色付きのモデル描画を記録する（モデル既定のテクスチャ）
+	/// </summary>
+	void AddColoredModel(KamataEngine::Model* model, const KamataEngine::WorldTransform& worldTransform, const KamataEngine::Vector4& color);
+
+	/// <summary>
+	/// 色付きのモデル描画を記録する（テクスチャ指定）
+	/// </summary>
+	void AddColoredModel(KamataEngine::Model* model, const KamataEngine::WorldTransform& worldTransform, uint32_t textureHandle, const KamataEngine::Vector4& color);
+
+	/// <summary>
+	/// 動かないモデルの集まりをまとめて1件として記録する（集まりは描画が終わるまで変更しないこと）
+	/// </summary>
+	void AddInstances(const ModelInstances& instances);
+
+	/// <summary>
+	/// 動かないモデルの集まりのうち、first 番目から count 個だけを1件として記録する（画面に映る範囲だけ描くときなど）
+	/// </summary>
+	void AddInstances(const ModelInstances& instances, size_t first, size_t count);
+
+	/// <summary>
+	/// スプライト描画を記録する（画面の position に size の大きさで、テクスチャ全体を貼る。Sort で SpriteBatch にまとめる）
+	/// 後から記録したものが上に重なる
+	/// </summary>
+	void AddSprite(uint32_t textureHandle, const KamataEngine::Vector2& position, const KamataEngine::Vector2& size, const KamataEngine::Vector4& color);
+
+	/// <summary>
+	/// テクスチャの一部（UiAtlas の領域など）を貼ったスプライト描画を記録する（サイズは領域の大きさのまま）
+	/// </summary>
+	void AddSprite(const SpriteBatch::TextureRegion& region, const KamataEngine::Vector2& position, const KamataEngine::Vector4& color);
+
+	/// <summary>
+	/// テクスチャの一部（UiAtlas の領域など）を貼ったスプライト描画を記録する（サイズ指定）
+	/// </summary>
+	void AddSprite(const SpriteBatch::TextureRegion& region, const KamataEngine::Vector2& position, const KamataEngine::Vector2& size, const KamataEngine::Vector4& color);
+
+	/// <summary>
+	/// エンジンの行列を RenderMatrix に変える（並びは同じ）
+	/// </summary>
+	static RenderMatrix ToRenderMatrix(const KamataEngine::Matrix4x4& matrix);
+
+	/// <summary>
+	/// RenderMatrix をエンジンの行列に変える
+	/// </summary>
+	static KamataEngine::Matrix4x4 ToMatrix4x4(const RenderMatrix& matrix);
+};
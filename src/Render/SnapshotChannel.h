@@ -0,0 +1,66 @@
+#pragma once
+#include "Render/RenderSnapshot.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+/// <summary>
+/// 更新スレッド（書き込み1本）と描画スレッド（読み込み1本）の間で
+/// RenderSnapshot を受け渡すロックフリーのSPSCキュー（2枚のダブルバッファ）
+/// 書き込み側がフレーム N+1 を記録している間に、読み込み側はフレーム N を再生できる
+/// </summary>
+class SnapshotChannel {
+public:
+	// バッファの枚数
+	static inline const uint32_t kSlotCount = 2;
+
+	/// <summary>
+	/// 書き込み用のスナップショットを取得する（空きが無ければ nullptr）
+	/// 取得したスナップショットは Clear 済み
+	/// </summary>
+	RenderSnapshot* BeginWrite() {
+		uint32_t write = writeCount_.load(std::memory_order_relaxed);
+		if (write - readCount_.load(std::memory_order_acquire) >= kSlotCount) {
+			return nullptr;
+		}
+		RenderSnapshot* snapshot = &slots_[write % kSlotCount];
+		snapshot->Clear();
+		return snapshot;
+	}
+
+	/// <summary>
+	/// 書き込み完了（読み込み側へ公開する）
+	/// </summary>
+	void EndWrite() { writeCount_.fetch_add(1, std::memory_order_release); }
+
+	/// <summary>
+	/// 読み込み用のスナップショットを取得する（無ければ nullptr）
+	/// </summary>
+	const RenderSnapshot* BeginRead() {
+		uint32_t read = readCount_.load(std::memory_order_relaxed);
+		if (read == writeCount_.load(std::memory_order_acquire)) {
+			return nullptr;
+		}
+		return &slots_[read % kSlotCount];
+	}
+
+	/// <summary>
+	/// 読み込み完了（スロットを書き込み側へ返す）
+	/// </summary>
+	void EndRead() { readCount_.fetch_add(1, std::memory_order_release); }
+
+	// 読み込めるスナップショットが無いか
+	bool IsEmpty() const { return readCount_.load(std::memory_order_acquire) == writeCount_.load(std::memory_order_acquire); }
+
+	/// <summary>
+	/// 未読のスナップショットを破棄する（両スレッドが止まっているときに呼ぶこと）
+	/// </summary>
+	void Reset() { readCount_.store(writeCount_.load(std::memory_order_acquire), std::memory_order_release); }
+
+private:
+	std::array<RenderSnapshot, kSlotCount> slots_;
+	// 書き込み済み数（書き込み側のみ更新）
+	std::atomic<uint32_t> writeCount_ = 0;
+	// 読み込み済み数（読み込み側のみ更新）
+	std::atomic<uint32_t> readCount_ = 0;
+};
@@ -0,0 +1,163 @@
+#include "Render/SnapshotRenderer.h"
+#include "Render/ModelInstances.h"
+#include "Render/RenderSnapshot.h"
+#include <chrono>
+#include <cstring>
+
+using namespace KamataEngine;
+
+SnapshotRenderer* SnapshotRenderer::GetInstance() {
+	static SnapshotRenderer instance;
+	return &instance;
+}
+
+WorldTransform& SnapshotRenderer::AcquireWorldTransform(size_t index) {
+	while (worldTransformPool_.size() <= index) {
+		auto worldTransform = std::make_unique<WorldTransform>();
+		worldTransform->Initialize();
+		// matWorld_ と定数バッファの中身を必ずそろえておく（Execute は matWorld_ を見て転送を省く）
+		worldTransform->TransferMatrix();
+		worldTransformPool_.push_back(std::move(worldTransform));
+	}
+	return *worldTransformPool_[index];
+}
+
+ObjectColor& SnapshotRenderer::AcquireObjectColor(size_t index) {
+	while (objectColorPool_.size() <= index) {
+		auto objectColor = std::make_unique<ObjectColor>();
+		objectColor->Initialize();
+		objectColorPool_.push_back(std::move(objectColor));
+	}
+	return *objectColorPool_[index];
+}
+
+Sprite& SnapshotRenderer::AcquireSprite(uint32_t textureHandle, size_t index) {
+	std::vector<std::unique_ptr<Sprite>>& pool = spritePool_[textureHandle];
+	while (pool.size() <= index) {
+		pool.emplace_back(Sprite::Create(textureHandle, {0.0f, 0.0f}));
+	}
+	return *pool[index];
+}
+
+void SnapshotRenderer::SwitchPass(Pass next) {
+	if (currentPass_ == next) {
+		return;
+	}
+
+	// 前のパスを閉じる
+	if (currentPass_ == Pass::kModel) {
+		Model::PostDraw();
+	} else if (currentPass_ == Pass::kSprite) {
+		Sprite::PostDraw();
+	}
+
+	// 次のパスを開く
+	DirectXCommon* dxCommon = DirectXCommon::GetInstance();
+	if (next == Pass::kModel) {
+		Model::PreDraw(dxCommon->GetCommandList());
+		++statistics_.passCount;
+	} else if (next == Pass::kSprite) {
+		Sprite::PreDraw(dxCommon->GetCommandList());
+		++statistics_.passCount;
+	}
+
+	currentPass_ = next;
+}
+
+void SnapshotRenderer::Execute(const RenderCommandList& snapshot) {
+	auto startTime = std::chrono::steady_clock::now();
+	statistics_ = {};
+
+	RenderCommandList::ReplayStatistics replay = snapshot.Replay(*this);
+	statistics_.commandCount = replay.commandCount;
+	statistics_.drawCallCount = replay.drawCallCount;
+	statistics_.instanceDrawCount = replay.instanceDrawCount;
+	statistics_.spriteQuadCount = replay.spriteQuadCount;
+	statistics_.spriteBatchCount = replay.spriteBatchCount;
+	statistics_.stateGroupCount = replay.stateGroupCount;
+
+	statistics_.submitMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+void SnapshotRenderer::BeginFrame(const RenderMatrix& matView, const RenderMatrix& matProjection) {
+	if (!camera_) {
+		camera_ = std::make_unique<Camera>();
+		camera_->Initialize();
+	}
+	camera_->matView = RenderSnapshot::ToMatrix4x4(matView);
+	camera_->matProjection = RenderSnapshot::ToMatrix4x4(matProjection);
+	camera_->TransferMatrix();
+
+	worldTransformIndex_ = 0;
+	objectColorIndex_ = 0;
+	spriteUseCounts_.clear();
+}
+
+void SnapshotRenderer::DrawModel(const ModelDraw& draw) {
+	SwitchPass(Pass::kModel);
+	Model* model = static_cast<Model*>(draw.model);
+
+	if (draw.instances) {
+		// 行列は ModelInstances::Build で転送済みなので、比較も転送もせずに描くだけ
+		const WorldTransform& worldTransform = draw.instances->GetWorldTransform(draw.instanceIndex);
+		if (draw.hasTexture) {
+			model->Draw(worldTransform, *camera_, draw.textureHandle);
+		} else {
+			model->Draw(worldTransform, *camera_);
+		}
+		return;
+	}
+
+	// 前のフレームにこの枠へ転送した行列と同じなら転送しない
+	// （スナップショットは毎フレーム同じ順に記録されるので、動かないブロックなどは同じ枠に同じ行列が来る）
+	WorldTransform& worldTransform = AcquireWorldTransform(worldTransformIndex_++);
+	if (std::memcmp(&worldTransform.matWorld_, draw.matWorld, sizeof(Matrix4x4)) != 0) {
+		worldTransform.matWorld_ = RenderSnapshot::ToMatrix4x4(*draw.matWorld);
+		worldTransform.TransferMatrix();
+		++statistics_.transferCount;
+	}
+
+	ObjectColor* objectColor = nullptr;
+	if (draw.hasColor) {
+		objectColor = &AcquireObjectColor(objectColorIndex_++);
+		objectColor->SetColor({draw.color.r, draw.color.g, draw.color.b, draw.color.a});
+	}
+
+	if (draw.hasTexture) {
+		model->Draw(worldTransform, *camera_, draw.textureHandle, objectColor);
+	} else {
+		model->Draw(worldTransform, *camera_, objectColor);
+	}
+}
+
+void SnapshotRenderer::DrawSprites(const SpriteBatch& spriteBatch, const SpriteBatch::DrawRange& range) {
+	SwitchPass(Pass::kSprite);
+
+	// エンジンの Sprite は1枚ずつ頂点バッファを持つので、四角形ごとにプールのスプライトへ写して描く。
+	// （同じスプライトを1フレームで2回書き換えると先の描画も後の内容になるので、テクスチャごとに使った数を数えて別のものを使う）
+	size_t& useCount = spriteUseCounts_[range.textureHandle];
+	const std::vector<SpriteBatch::Quad>& quads = spriteBatch.GetQuads();
+	for (uint32_t i = range.firstQuad; i < range.firstQuad + range.quadCount; ++i) {
+		const SpriteBatch::Quad& quad = quads[i];
+		Sprite& sprite = AcquireSprite(range.textureHandle, useCount++);
+		// アトラスの領域なら貼る場所をピクセルで指定する
+		if (quad.textureWidth > 0.0f) {
+			sprite.SetTextureRect(
+			    {quad.texcoord.left * quad.textureWidth, quad.texcoord.top * quad.textureHeight},
+			    {(quad.texcoord.right - quad.texcoord.left) * quad.textureWidth, (quad.texcoord.bottom - quad.texcoord.top) * quad.textureHeight});
+		}
+		sprite.SetPosition({quad.left, quad.top});
+		sprite.SetSize({quad.width, quad.height});
+		sprite.SetColor({quad.color.r, quad.color.g, quad.color.b, quad.color.a});
+		sprite.Draw();
+	}
+}
+
+void SnapshotRenderer::EndFrame() { SwitchPass(Pass::kNone); }
+
+void SnapshotRenderer::Finalize() {
+	worldTransformPool_.clear();
+	objectColorPool_.clear();
+	spritePool_.clear();
+	camera_.reset();
+}
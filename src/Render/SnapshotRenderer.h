@@ -0,0 +1,100 @@
+#pragma once
+#include "KamataEngine.h"
+#include "Render/RenderBackend.h"
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+class RenderCommandList;
+
+/// <summary>
+/// RenderSnapshot を再生して実際に描画する（KamataEngine で描く RenderBackend）
+/// 更新側のワールド変換とは別に、描画専用のワールド変換・色・カメラを持つので、
+/// 再生中に更新側が次のフレームを計算していても干渉しない
+/// </summary>
+class SnapshotRenderer : public RenderBackend {
+public:
+	/// <summary>
+	/// 直前の Execute 1回分の集計（デバッグ表示用）
+	/// </summary>
+	struct Statistics {
+		// スナップショットのコマンド数
+		uint32_t commandCount = 0;
+		// Model::Draw / Sprite::Draw を呼んだ回数
+		uint32_t drawCallCount = 0;
+		// そのうち ModelInstances から描いた数
+		uint32_t instanceDrawCount = 0;
+		// ワールド変換の定数バッファを転送した回数
+		uint32_t transferCount = 0;
+		// スプライトの四角形の数
+		uint32_t spriteQuadCount = 0;
+		// スプライトをテクスチャごとにまとめた描画の数（SpriteBatch::DrawRange の数）
+		uint32_t spriteBatchCount = 0;
+		// PreDraw を呼んだ回数
+		uint32_t passCount = 0;
+		// 描画の状態（パス・モデル・テクスチャ）が変わった回数（RenderSnapshot::Sort で並べていれば、使った組み合わせの数になる）
+		uint32_t stateGroupCount = 0;
+		// Execute にかかった CPU 時間（ミリ秒）
+		double submitMilliseconds = 0.0;
+	};
+
+	// シングルトン取得
+	static SnapshotRenderer* GetInstance();
+
+	/// <summary>
+	/// スナップショットを描画する（メインスレッドから呼ぶこと）
+	/// </summary>
+	void Execute(const RenderCommandList& snapshot);
+
+	// --- RenderBackend（Execute から呼ばれる） ---
+	void BeginFrame(const RenderMatrix& matView, const RenderMatrix& matProjection) override;
+	void DrawModel(const ModelDraw& draw) override;
+	void DrawSprites(const SpriteBatch& spriteBatch, const SpriteBatch::DrawRange& range) override;
+	void EndFrame() override;
+
+	const Statistics& GetStatistics() const { return statistics_; }
+
+	/// <summary>
+	/// 描画用リソースの解放（エンジン終了前に呼ぶこと）
+	/// </summary>
+	void Finalize();
+
+private:
+	SnapshotRenderer() = default;
+	~SnapshotRenderer() override = default;
+	SnapshotRenderer(const SnapshotRenderer&) = delete;
+	SnapshotRenderer& operator=(const SnapshotRenderer&) = delete;
+
+	// 描画パスの種類
+	enum class Pass {
+		kNone,
+		kModel,
+		kSprite,
+	};
+
+	// 必要ならパスを切り替える（PreDraw/PostDraw の組を最小限にする）
+	void SwitchPass(Pass next);
+
+	// 描画専用のワールド変換（足りなければ増やし、以降は使い回す）
+	// matWorld_ には最後に転送した行列が残っているので、同じ行列なら転送を省ける
+	KamataEngine::WorldTransform& AcquireWorldTransform(size_t index);
+	// 描画専用の色変更オブジェクト
+	KamataEngine::ObjectColor& AcquireObjectColor(size_t index);
+	// 描画専用のスプライト（テクスチャごとに、1フレームで使う数だけ持つ）
+	KamataEngine::Sprite& AcquireSprite(uint32_t textureHandle, size_t index);
+
+	std::vector<std::unique_ptr<KamataEngine::WorldTransform>> worldTransformPool_;
+	std::vector<std::unique_ptr<KamataEngine::ObjectColor>> objectColorPool_;
+	std::unordered_map<uint32_t, std::vector<std::unique_ptr<KamataEngine::Sprite>>> spritePool_;
+	// DrawSpriteBatch でテクスチャごとに使ったスプライトの数（確保済みの容量は再利用する）
+	std::unordered_map<uint32_t, size_t> spriteUseCounts_;
+	std::unique_ptr<KamataEngine::Camera> camera_;
+
+	// このフレームで次に使うワールド変換・色の番号
+	size_t worldTransformIndex_ = 0;
+	size_t objectColorIndex_ = 0;
+
+	Pass currentPass_ = Pass::kNone;
+
+	Statistics statistics_;
+};
@@ -0,0 +1,108 @@
+#include "Render/SpriteBatch.h"
+#include <algorithm>
+
+namespace {
+
+// 2つの四角形が重なるか（辺が接しているだけなら重ならない）
+bool Overlaps(const SpriteBatch::Quad& a, const SpriteBatch::Quad& b) {
+	return a.left < b.left + b.width && b.left < a.left + a.width && a.top < b.top + b.height && b.top < a.top + a.height;
+}
+
+} // namespace
+
+void SpriteBatch::Clear() {
+	quads_.clear();
+	vertices_.clear();
+	ranges_.clear();
+	layerCount_ = 0;
+}
+
+void SpriteBatch::Add(uint32_t textureHandle, float left, float top, float width, float height, const Color& color, const TexCoordRect& texcoord) {
+	if (width <= 0.0f || height <= 0.0f) {
+		return;
+	}
+	Quad& quad = quads_.emplace_back();
+	quad.textureHandle = textureHandle;
+	quad.left = left;
+	quad.top = top;
+	quad.width = width;
+	quad.height = height;
+	quad.texcoord = texcoord;
+	quad.color = color;
+	quad.sequence = static_cast<uint32_t>(quads_.size() - 1);
+}
+
+void SpriteBatch::Add(const TextureRegion& region, float left, float top, float width, float height, const Color& color) {
+	if (region.textureWidth <= 0.0f || region.textureHeight <= 0.0f) {
+		return;
+	}
+	TexCoordRect texcoord = {
+	    region.x / region.textureWidth, region.y / region.textureHeight, (region.x + region.width) / region.textureWidth,
+	    (region.y + region.height) / region.textureHeight};
+	size_t count = quads_.size();
+	Add(region.textureHandle, left, top, width, height, color, texcoord);
+	if (quads_.size() != count) {
+		quads_.back().textureWidth = region.textureWidth;
+		quads_.back().textureHeight = region.textureHeight;
+	}
+}
+
+void SpriteBatch::Build() {
+	// 層を決める（先に加えた四角形と重なるなら、別のテクスチャはその1つ上、同じテクスチャは同じ層以上）
+	// HUD・UI の四角形は1フレームに数十個なので、総当たりで調べる
+	layerCount_ = 0;
+	for (size_t i = 0; i < quads_.size(); ++i) {
+		Quad& quad = quads_[i];
+		quad.layer = 0;
+		for (size_t j = 0; j < i; ++j) {
+			const Quad& below = quads_[j];
+			if (Overlaps(below, quad)) {
+				uint32_t layer = below.layer + (below.textureHandle != quad.textureHandle ? 1 : 0);
+				quad.layer = (std::max)(quad.layer, layer);
+			}
+		}
+		layerCount_ = (std::max)(layerCount_, quad.layer + 1);
+	}
+
+	std::sort(quads_.begin(), quads_.end(), [](const Quad& a, const Quad& b) {
+		if (a.layer != b.layer) {
+			return a.layer < b.layer;
+		}
+		if (a.textureHandle != b.textureHandle) {
+			return a.textureHandle < b.textureHandle;
+		}
+		return a.sequence < b.sequence;
+	});
+
+	vertices_.clear();
+	vertices_.reserve(quads_.size() * kVerticesPerQuad);
+	ranges_.clear();
+	for (size_t i = 0; i < quads_.size(); ++i) {
+		const Quad& quad = quads_[i];
+		float right = quad.left + quad.width;
+		float bottom = quad.top + quad.height;
+		const TexCoordRect& uv = quad.texcoord;
+		const Color& c = quad.color;
+		vertices_.push_back({{quad.left, quad.top}, {uv.left, uv.top}, {c.r, c.g, c.b, c.a}});
+		vertices_.push_back({{right, quad.top}, {uv.right, uv.top}, {c.r, c.g, c.b, c.a}});
+		vertices_.push_back({{quad.left, bottom}, {uv.left, uv.bottom}, {c.r, c.g, c.b, c.a}});
+		vertices_.push_back({{right, bottom}, {uv.right, uv.bottom}, {c.r, c.g, c.b, c.a}});
+
+		// 同じテクスチャが続くなら（層をまたいでも）同じ描画にする
+		if (!ranges_.empty() && ranges_.back().textureHandle == quad.textureHandle) {
+			++ranges_.back().quadCount;
+		} else {
+			ranges_.push_back({quad.textureHandle, static_cast<uint32_t>(i), 1});
+		}
+	}
+}
+
+void SpriteBatch::BuildIndices(uint32_t quadCount, std::vector<uint16_t>& outIndices) {
+	outIndices.clear();
+	outIndices.reserve(static_cast<size_t>(quadCount) * kIndicesPerQuad);
+	for (uint32_t i = 0; i < quadCount; ++i) {
+		uint16_t base = static_cast<uint16_t>(i * kVerticesPerQuad);
+		outIndices.insert(outIndices.end(), {base, static_cast<uint16_t>(base + 1), static_cast<uint16_t>(base + 2), static_cast<uint16_t>(base + 2),
+		                                     static_cast<uint16_t>(base + 1), static_cast<uint16_t>(base + 3)});
+	}
+}
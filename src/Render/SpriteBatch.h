@@ -0,0 +1,115 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// 画面上の四角形（HUD・UI・フェードなど）を1フレーム分ためて、1つの頂点配列にまとめる
+/// Build で「重なり方が変わらない範囲で」テクスチャごとに並べ替え、同じテクスチャが続く範囲（DrawRange）を1回の描画にする。
+/// 後から加えた四角形が、先に加えた別のテクスチャの四角形と重なるときは、その上の層に置く（重ならなければ同じ層にまとめる）。
+/// 同じテクスチャ同士は加えた順のまま描くので、重なっていても見た目は変わらない。
+/// エンジンに依存しないので、描画の数や並びを Linux でも確かめられる。
+/// 座標は画面のピクセル（左上が原点、右・下が正）
+/// </summary>
+class SpriteBatch {
+public:
+	// 四角形1つあたりの頂点数・インデックス数（頂点は 左上・右上・左下・右下 の順）
+	static inline const uint32_t kVerticesPerQuad = 4;
+	static inline const uint32_t kIndicesPerQuad = 6;
+
+	struct Color {
+		float r, g, b, a;
+	};
+
+	/// <summary>
+	/// テクスチャのどこを貼るか（0 ～ 1）
+	/// </summary>
+	struct TexCoordRect {
+		float left, top, right, bottom;
+	};
+	static inline const TexCoordRect kFullTexture = {0.0f, 0.0f, 1.0f, 1.0f};
+
+	/// <summary>
+	/// テクスチャの一部（アトラスの領域など。位置と大きさはピクセル）
+	/// </summary>
+	struct TextureRegion {
+		uint32_t textureHandle = 0;
+		float textureWidth = 0.0f;
+		float textureHeight = 0.0f;
+		float x = 0.0f;
+		float y = 0.0f;
+		float width = 0.0f;
+		float height = 0.0f;
+	};
+
+	struct Vertex {
+		float position[2];
+		float texcoord[2];
+		float color[4];
+	};
+
+	struct Quad {
+		uint32_t textureHandle = 0;
+		float left = 0.0f;
+		float top = 0.0f;
+		float width = 0.0f;
+		float height = 0.0f;
+		TexCoordRect texcoord = kFullTexture;
+		// テクスチャの一部を貼るときのテクスチャの大きさ（ピクセル。0 ならテクスチャ全体を貼る）
+		float textureWidth = 0.0f;
+		float textureHeight = 0.0f;
+		Color color = {1.0f, 1.0f, 1.0f, 1.0f};
+		// 重なりから決まる層（Build で決まる。小さい方が先に描かれる）
+		uint32_t layer = 0;
+		// 加えた順
+		uint32_t sequence = 0;
+	};
+
+	/// <summary>
+	/// 1回の描画（同じテクスチャの四角形 firstQuad 番目から quadCount 個。頂点は firstQuad * kVerticesPerQuad 番目から）
+	/// </summary>
+	struct DrawRange {
+		uint32_t textureHandle = 0;
+		uint32_t firstQuad = 0;
+		uint32_t quadCount = 0;
+	};
+
+	/// <summary>
+	/// ためた内容を破棄する（確保済みの容量は再利用する）
+	/// </summary>
+	void Clear();
+
+	/// <summary>
+	/// 四角形を加える（Build を呼ぶまで頂点配列には反映されない。幅・高さが 0 以下のものは無視する）
+	/// </summary>
+	void Add(uint32_t textureHandle, float left, float top, float width, float height, const Color& color, const TexCoordRect& texcoord = kFullTexture);
+
+	/// <summary>
+	/// テクスチャの一部を貼った四角形を加える
+	/// </summary>
+	void Add(const TextureRegion& region, float left, float top, float width, float height, const Color& color);
+
+	/// <summary>
+	/// 層・テクスチャ・加えた順に並べ、頂点配列と描画の範囲を作る（全て加え終えてから呼ぶ）
+	/// </summary>
+	void Build();
+
+	/// <summary>
+	/// quadCount 個分のインデックス（2つの三角形 左上・右上・左下 / 左下・右上・右下）を作る（全フレームで共通。16ビットなので 16384 個まで）
+	/// </summary>
+	static void BuildIndices(uint32_t quadCount, std::vector<uint16_t>& outIndices);
+
+	// Build 後は描く順に並んでいる
+	const std::vector<Quad>& GetQuads() const { return quads_; }
+	// 頂点配列（GetQuads と同じ順。動的な頂点バッファへそのまま書き込める）
+	const std::vector<Vertex>& GetVertices() const { return vertices_; }
+	const std::vector<DrawRange>& GetRanges() const { return ranges_; }
+	size_t GetQuadCount() const { return quads_.size(); }
+	uint32_t GetLayerCount() const { return layerCount_; }
+
+private:
+	std::vector<Quad> quads_;
+	std::vector<Vertex> vertices_;
+	std::vector<DrawRange> ranges_;
+	uint32_t layerCount_ = 0;
+};
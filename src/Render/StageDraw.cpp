@@ -0,0 +1,151 @@
+#include "Render/StageDraw.h"
+#include "Sim/SimPlayer.h"
+#include "Sim/SimProjectile.h"
+#include "System/GameTime.h"
+#include "Utils/Easing.h"
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace StageDraw {
+
+float StepCameraRoll(float currentRoll, float targetRoll) {
+	float diff = std::fmod(targetRoll - currentRoll + std::numbers::pi_v<float>, 2.0f * std::numbers::pi_v<float>) - std::numbers::pi_v<float>;
+	return currentRoll + diff * 0.2f;
+}
+
+float GetGoalCameraOffsetZ(float goalCameraTimer) {
+	float t = std::clamp(goalCameraTimer / kGoalCameraZoomDuration, 0.0f, 1.0f);
+	return Lerp(-kCameraDistance, -kGoalCameraDistance, t);
+}
+
+void ComputeVisibleArea(
+    const RenderMatrix& matView, const RenderMatrix& matProjection, float blockWidth, float blockHeight, uint32_t columnCount, uint32_t rowCount,
+    ViewCulling::Rect& outRect, ViewCulling::TileRange& outTiles) {
+	ViewCulling::ComputeVisibleRect(matView, matProjection, kCullingNearZ, kCullingFarZ, outRect);
+	outTiles = ViewCulling::ToTileRange(outRect, blockWidth, blockHeight, columnCount, rowCount);
+}
+
+BlockRange AddVisibleBlocks(
+    RenderCommandList& list, void* model, bool hasTexture, uint32_t textureHandle, const std::vector<RenderMatrix>& matrices,
+    const std::vector<uint32_t>& columnOffsets, const ViewCulling::TileRange& tiles, const ModelInstances* instances) {
+	// 列ごとに並べてあるので、映っている列の範囲は連続している
+	BlockRange range;
+	if (tiles.IsEmpty()) {
+		return range;
+	}
+	range.first = columnOffsets[tiles.firstColumn];
+	range.count = columnOffsets[tiles.lastColumn + 1] - range.first;
+	list.AddInstances(model, hasTexture, textureHandle, matrices.data(), matrices.size(), range.first, range.count, instances);
+	return range;
+}
+
+bool IsPlayerDrawn(const SimPlayer& player) {
+	if (!player.GetIsAlive()) {
+		return false;
+	}
+	// 無敵時間中は 0.2 秒ごとに表示/非表示を切り替える
+	float invincibleTimer = player.GetInvincibleTimer();
+	return !(invincibleTimer > 0.0f && std::fmod(invincibleTimer, 0.2f) < 0.1f);
+}
+
+bool IsSwordDrawn(const SimPlayer& player) { return IsPlayerDrawn(player) && (player.GetIsAttacking() || player.GetIsMeleeAttacking()); }
+
+bool IsEnemyVisible(const EnemyHotState& hot, const EnemyHotState& previous, const ViewCulling::Rect& visibleRect) {
+	return visibleRect.Contains(ToFloat(hot.translation.x), ToFloat(hot.translation.y), kEnemyCullingMargin) ||
+	       visibleRect.Contains(ToFloat(previous.translation.x), ToFloat(previous.translation.y), kEnemyCullingMargin);
+}
+
+bool ComputeProjectilePosition(const SimProjectile& projectile, float alpha, const ViewCulling::Rect& visibleRect, SimVector3& outPosition) {
+	if (!projectile.IsAlive()) {
+		return false;
+	}
+	// 現在の位置から戻す時間（秒）
+	const float rewindTime = GameTime::GetDeltaTime() * (1.0f - alpha);
+	outPosition = projectile.GetWorldPosition() - projectile.GetVelocity() * rewindTime;
+	return visibleRect.Contains(ToFloat(outPosition.x), ToFloat(outPosition.y), SimProjectile::kScale);
+}
+
+SpriteBatch::TextureRegion GetAtlasRegion(UiAtlasTable::Region region, uint32_t atlasTextureHandle) {
+	const UiAtlasTable::Entry& entry = UiAtlasTable::kEntries[static_cast<size_t>(region)];
+	SpriteBatch::TextureRegion textureRegion;
+	textureRegion.textureHandle = atlasTextureHandle;
+	textureRegion.textureWidth = static_cast<float>(UiAtlasTable::kWidth);
+	textureRegion.textureHeight = static_cast<float>(UiAtlasTable::kHeight);
+	textureRegion.x = static_cast<float>(entry.x);
+	textureRegion.y = static_cast<float>(entry.y);
+	textureRegion.width = static_cast<float>(entry.width);
+	textureRegion.height = static_cast<float>(entry.height);
+	return textureRegion;
+}
+
+float StepHeartScale(float scale, bool isFilled) {
+	float targetScale = isFilled ? 1.0f : 0.0f;
+	if (scale < targetScale) {
+		return std::fminf(scale + kHeartScaleSpeed, targetScale); // 回復時：大きくする
+	}
+	return std::fmaxf(scale - kHeartScaleSpeed, targetScale); // ダメージ時：小さくする
+}
+
+uint32_t AddHearts(RenderCommandList& list, uint32_t atlasTextureHandle, const float (&scales)[kHeartCount]) {
+	const SpriteBatch::TextureRegion heart = GetAtlasRegion(UiAtlasTable::Region::kHeart, atlasTextureHandle);
+	uint32_t spriteCount = 0;
+	for (int i = 0; i < kHeartCount; ++i) {
+		float left = kHeartLeft + float(i) * kHeartSpacing;
+
+		// 背景（黒いハート）はずっとサイズ固定。元の画像の色に黒を乗算する
+		list.AddSprite(heart, left, kHeartTop, kHeartSize, kHeartSize, {0.0f, 0.0f, 0.0f, 1.0f});
+		++spriteCount;
+
+		// 赤いハートは大きさが 0 より大きいときだけ、中心に向かって縮むように描く
+		if (scales[i] > 0.0f) {
+			float currentSize = kHeartSize * scales[i];
+			float offset = (kHeartSize - currentSize) / 2.0f;
+			list.AddSprite(heart, left + offset, kHeartTop + offset, currentSize, currentSize, {1.0f, 1.0f, 1.0f, 1.0f});
+			++spriteCount;
+		}
+	}
+	return spriteCount;
+}
+
+uint32_t AddInputGuide(RenderCommandList& list, uint32_t atlasTextureHandle, bool isGamepad, const bool (&isPressed)[kInputGuideCount]) {
+	using Region = UiAtlasTable::Region;
+	const Region keyboardRegions[kInputGuideCount] = {Region::kKeyJ, Region::kKeySpace, Region::kKeyEsc};
+	const Region gamepadRegions[kInputGuideCount] = {Region::kButtonA, Region::kButtonX, Region::kButtonSelect};
+	const float positions[kInputGuideCount][2] = {{64.0f, 600.0f}, {192.0f, 600.0f}, {64.0f, 128.0f}};
+	const SpriteBatch::Color pressedColor = {0.5f, 0.5f, 0.5f, 1.0f};
+	const SpriteBatch::Color releasedColor = {1.0f, 1.0f, 1.0f, 1.0f};
+
+	for (uint32_t i = 0; i < kInputGuideCount; ++i) {
+		SpriteBatch::TextureRegion region = GetAtlasRegion(isGamepad ? gamepadRegions[i] : keyboardRegions[i], atlasTextureHandle);
+		list.AddSprite(region, positions[i][0], positions[i][1], region.width, region.height, isPressed[i] ? pressedColor : releasedColor);
+	}
+	return kInputGuideCount;
+}
+
+uint32_t AddStageNumber(RenderCommandList& list, uint32_t atlasTextureHandle, int stageNo) {
+	const SpriteBatch::Color white = {1.0f, 1.0f, 1.0f, 1.0f};
+	auto addRegion = [&](UiAtlasTable::Region region, float left, float top) {
+		SpriteBatch::TextureRegion textureRegion = GetAtlasRegion(region, atlasTextureHandle);
+		list.AddSprite(textureRegion, left, top, textureRegion.width, textureRegion.height, white);
+	};
+
+	// 「STAGE 1-」の画像を画面中央より少し左に表示
+	const float textLeft = 400.0f;
+	const float textTop = 300.0f;
+	addRegion(UiAtlasTable::Region::kStageText, textLeft, textTop);
+
+	// 「STAGE 1-」の右側に数字を表示（2桁なら10の位から、数字の画像の幅ずつずらす）
+	float numberWidth = static_cast<float>(UiAtlasTable::kEntries[static_cast<size_t>(UiAtlasTable::Region::kNumber0)].width);
+	float numberLeft = textLeft + 340.0f;
+	auto toNumberRegion = [](int digit) { return static_cast<UiAtlasTable::Region>(static_cast<uint32_t>(UiAtlasTable::Region::kNumber0) + static_cast<uint32_t>(digit)); };
+	if (stageNo >= 10) {
+		addRegion(toNumberRegion(stageNo / 10), numberLeft, textTop);
+		addRegion(toNumberRegion(stageNo % 10), numberLeft + numberWidth, textTop);
+		return 3;
+	}
+	addRegion(toNumberRegion(stageNo), numberLeft, textTop);
+	return 2;
+}
+
+} // namespace StageDraw
@@ -0,0 +1,157 @@
+#pragma once
+#include "Render/RenderCommandList.h"
+#include "Render/UiAtlasTable.h"
+#include "Sim/SimEnemyData.h"
+#include "Sim/SimMath.h"
+#include "Utils/FastMath.h"
+#include "Utils/SimdMath.h"
+#include "Utils/ViewCulling.h"
+#include <cstdint>
+#include <vector>
+
+class ModelInstances;
+class SimPlayer;
+class SimProjectile;
+
+/// <summary>
+/// ゲーム画面（GameScene）の描画の決め方のうち、エンジンに依存しない部分
+/// カメラの動き・映る範囲・何を描くかの判定・ブロックの範囲・HUD の四角形の並べ方をここにまとめ、
+/// GameScene と tools/RenderStreamBench の両方から呼ぶ（ベンチが数える描画の数が、ゲームの描画の流れと同じになる）
+/// </summary>
+namespace StageDraw {
+
+// --- カメラ ---
+// プレイヤーからカメラまでの距離（通常時）
+inline constexpr float kCameraDistance = 30.0f;
+// ゴール演出で近づいたときの距離と、近づくのにかける時間（秒）
+inline constexpr float kGoalCameraDistance = 10.0f;
+inline constexpr float kGoalCameraZoomDuration = 0.5f;
+// 映る範囲を求める奥行き（ブロック・敵・弾が置かれる範囲）
+inline constexpr float kCullingNearZ = -2.0f;
+inline constexpr float kCullingFarZ = 2.0f;
+// 敵の大きさの半分（中心がこれだけ外にあっても映っているとする）
+inline constexpr float kEnemyCullingMargin = 2.0f;
+
+// --- HUD ---
+// ハートの数と、左上の位置・間隔・大きさ
+inline constexpr int kHeartCount = 3;
+inline constexpr float kHeartLeft = 64.0f;
+inline constexpr float kHeartTop = 50.0f;
+inline constexpr float kHeartSpacing = 60.0f;
+inline constexpr float kHeartSize = 50.0f;
+// ハートが大きく・小さくなる速さ（1フレームあたり）
+inline constexpr float kHeartScaleSpeed = 0.05f;
+// キー・ボタン表示の数（位置の順は 左下・右下・左上）
+inline constexpr uint32_t kInputGuideCount = 3;
+
+/// <summary>
+/// 映っている列のブロックの範囲（集まりの first 番目から count 個）
+/// </summary>
+struct BlockRange {
+	uint32_t first = 0;
+	uint32_t count = 0;
+};
+
+/// <summary>
+/// カメラのロール（Z 軸回りの角度）を目標の角度へ近づける（1フレーム分。一番近い向きから回る）
+/// </summary>
+float StepCameraRoll(float currentRoll, float targetRoll);
+
+/// <summary>
+/// ゴール演出中のカメラのオフセットの Z（演出が始まってからの時間で、通常の距離から近づく）
+/// </summary>
+float GetGoalCameraOffsetZ(float goalCameraTimer);
+
+/// <summary>
+/// target を offset だけ離れた位置から見るビュー行列（offset と上向きはロールで回す）
+/// </summary>
+template<typename Vec3>
+RenderMatrix MakeCameraView(const Vec3& target, const Vec3& offset, float roll) {
+	float sinValue = 0.0f;
+	float cosValue = 0.0f;
+	FastMath::SinCos(roll, sinValue, cosValue);
+	const RenderMatrix rollMatrix = {{{cosValue, sinValue, 0.0f, 0.0f}, {-sinValue, cosValue, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 0.0f, 1.0f}}};
+	Vec3 rotatedOffset = SimdMath::TransformNormal(offset, rollMatrix);
+	Vec3 rotatedUpVector = SimdMath::TransformNormal(Vec3{0.0f, 1.0f, 0.0f}, rollMatrix);
+	Vec3 cameraPosition = {target.x + rotatedOffset.x, target.y + rotatedOffset.y, target.z + rotatedOffset.z};
+	return SimdMath::MakeLookAt<RenderMatrix>(cameraPosition, target, rotatedUpVector);
+}
+
+/// <summary>
+/// カメラに映る範囲と、そこにかかるマップチップの範囲を求める（求められないときは全て映っているとする）
+/// </summary>
+void ComputeVisibleArea(
+    const RenderMatrix& matView, const RenderMatrix& matProjection, float blockWidth, float blockHeight, uint32_t columnCount, uint32_t rowCount,
+    ViewCulling::Rect& outRect, ViewCulling::TileRange& outTiles);
+
+/// <summary>
+/// 映っている列のブロックを1件として記録する（ブロックの行列は列ごとに並べ、各列の始まりを columnOffsets に持っておく）
+/// </summary>
+/// <param name="matrices">ブロックの行列の並び</param>
+/// <param name="columnOffsets">各列の最初のブロックが何番目か（列の数 + 1 個。最後は全体の数）</param>
+/// <param name="instances">行列を転送済みの集まり（エンジンで描くときに使う。無ければ nullptr）</param>
+/// <returns>記録した範囲</returns>
+BlockRange AddVisibleBlocks(
+    RenderCommandList& list, void* model, bool hasTexture, uint32_t textureHandle, const std::vector<RenderMatrix>& matrices,
+    const std::vector<uint32_t>& columnOffsets, const ViewCulling::TileRange& tiles, const ModelInstances* instances);
+
+/// <summary>
+/// プレイヤーを描くか（死んでいるとき・無敵時間中の点滅で消えているときは描かない）
+/// </summary>
+bool IsPlayerDrawn(const SimPlayer& player);
+
+/// <summary>
+/// 剣を描くか（プレイヤーを描き、攻撃中のとき）
+/// </summary>
+bool IsSwordDrawn(const SimPlayer& player);
+
+/// <summary>
+/// 敵がカメラに映っているか
+/// 補間の途中でも映る範囲から出ないよう、直前と現在の位置のどちらかがかかっていれば映っているとする
+/// </summary>
+bool IsEnemyVisible(const EnemyHotState& hot, const EnemyHotState& previous, const ViewCulling::Rect& visibleRect);
+
+/// <summary>
+/// 敵を描くか（死んでいる・映っていないときは描かない）
+/// </summary>
+inline bool IsEnemyDrawn(const EnemyHotState& hot, bool isVisible) { return hot.state != EnemyState::kDead && isVisible; }
+
+/// <summary>
+/// 弾を描く位置（直前のステップとの間を補間したもの）を求め、描くかを返す（死んでいる・映っていない弾は描かない）
+/// 弾は等速なので、直前のステップの位置は速度から逆算する
+/// </summary>
+/// <param name="alpha">直前のステップから現在のステップへの補間係数 [0, 1]</param>
+bool ComputeProjectilePosition(const SimProjectile& projectile, float alpha, const ViewCulling::Rect& visibleRect, SimVector3& outPosition);
+
+/// <summary>
+/// アトラスの領域（UiAtlas::Get と同じ。テクスチャはエンジンで読み込んだものの番号を渡す）
+/// </summary>
+SpriteBatch::TextureRegion GetAtlasRegion(UiAtlasTable::Region region, uint32_t atlasTextureHandle);
+
+/// <summary>
+/// ハートの大きさを、体力が残っていれば 1、無ければ 0 へ近づける（1フレーム分）
+/// </summary>
+float StepHeartScale(float scale, bool isFilled);
+
+/// <summary>
+/// HUD のハート（背景の黒いハートと、大きさに合わせて中心へ縮む赤いハート）を記録する
+/// </summary>
+/// <returns>記録したスプライトの数</returns>
+uint32_t AddHearts(RenderCommandList& list, uint32_t atlasTextureHandle, const float (&scales)[kHeartCount]);
+
+/// <summary>
+/// キー・ボタン表示を記録する（押されているものは暗くする）
+/// キーボードは J（攻撃）・Space（ジャンプ）・Esc、コントローラは A（ジャンプ）・X（攻撃）・START/SELECT
+/// </summary>
+/// <param name="isGamepad">コントローラの表示にするか</param>
+/// <param name="isPressed">位置の順（左下・右下・左上）に、押されているか</param>
+/// <returns>記録したスプライトの数</returns>
+uint32_t AddInputGuide(RenderCommandList& list, uint32_t atlasTextureHandle, bool isGamepad, const bool (&isPressed)[kInputGuideCount]);
+
+/// <summary>
+/// ステージ開始時の「STAGE 1-」とステージ番号を記録する
+/// </summary>
+/// <returns>記録したスプライトの数</returns>
+uint32_t AddStageNumber(RenderCommandList& list, uint32_t atlasTextureHandle, int stageNo);
+
+} // namespace StageDraw
@@ -0,0 +1,34 @@
+#include "Render/UiAtlas.h"
+#include "Render/StageDraw.h"
+
+using namespace KamataEngine;
+
+UiAtlas* UiAtlas::GetInstance() {
+	static UiAtlas instance;
+	return &instance;
+}
+
+void UiAtlas::Load() {
+	if (isLoaded_) {
+		return;
+	}
+	textureHandle_ = TextureManager::Load(UiAtlasTable::kTexturePath);
+	isLoaded_ = true;
+}
+
+SpriteBatch::TextureRegion UiAtlas::Get(Region region) const { return StageDraw::GetAtlasRegion(region, textureHandle_); }
+
+Vector2 UiAtlas::GetSize(Region region) const {
+	const UiAtlasTable::Entry& entry = UiAtlasTable::kEntries[static_cast<size_t>(region)];
+	return {static_cast<float>(entry.width), static_cast<float>(entry.height)};
+}
+
+Sprite* UiAtlas::CreateSprite(Region region, const Vector2& position) const {
+	const UiAtlasTable::Entry& entry = UiAtlasTable::kEntries[static_cast<size_t>(region)];
+	Sprite* sprite = Sprite::Create(textureHandle_, position);
+	if (sprite) {
+		sprite->SetTextureRect({static_cast<float>(entry.x), static_cast<float>(entry.y)}, {static_cast<float>(entry.width), static_cast<float>(entry.height)});
+		sprite->SetSize(GetSize(region));
+	}
+	return sprite;
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include "KamataEngine.h"
+#include "Render/SpriteBatch.h"
+#include "Render/UiAtlasTable.h"
+
+/// <summary>
+/// HUD・UI の画像をまとめたアトラス（tools/AtlasPacker で作る Resources/atlas/ui.png）
+/// 画像ごとに読み込む代わりに、この1枚を1回だけ読み込み、領域（UiAtlasTable::Region）で貼る場所を選ぶ。
+/// 全ての HUD・UI が同じテクスチャになるので、SpriteBatch で1回の描画にまとまる
+/// </summary>
+class UiAtlas {
+public:
+	using Region = UiAtlasTable::Region;
+
+	// シングルトン取得
+	static UiAtlas* GetInstance();
+
+	/// <summary>
+	/// アトラスを読み込む（2回目以降は何もしない）
+	/// </summary>
+	void Load();
+
+	/// <summary>
+	/// 領域（RenderSnapshot::AddSprite に渡す）
+	/// </summary>
+	SpriteBatch::TextureRegion Get(Region region) const;
+
+	/// <summary>
+	/// 領域の元の画像の大きさ（ピクセル）
+	/// </summary>
+	KamataEngine::Vector2 GetSize(Region region) const;
+
+	/// <summary>
+	/// 領域を貼ったスプライトを作る（大きさは元の画像と同じ。スナップショットを通さずに描くとき用）
+	/// </summary>
+	KamataEngine::Sprite* CreateSprite(Region region, const KamataEngine::Vector2& position) const;
+
+	/// <summary>
+	/// 数字（0 ～ 9）の領域
+	/// </summary>
+	static Region GetNumberRegion(int digit) { return static_cast<Region>(static_cast<uint32_t>(Region::kNumber0) + static_cast<uint32_t>(digit)); }
+
+	uint32_t GetTextureHandle() const { return textureHandle_; }
+
+private:
+	UiAtlas() = default;
+	~UiAtlas() = default;
+	UiAtlas(const UiAtlas&) = delete;
+	UiAtlas& operator=(const UiAtlas&) = delete;
+
+	uint32_t textureHandle_ = 0;
+	bool isLoaded_ = false;
+};
@@ -0,0 +1,75 @@
+#pragma once
+#include <cstdint>
+
+// atlas_packer が生成したファイル（手で書き換えないこと。元の画像を変えたら atlas_packer を実行し直す）
+
+/// <summary>
+/// HUD・UI の画像をまとめたアトラス（Resources/atlas/ui.png）の領域の表
+/// </summary>
+namespace UiAtlasTable {
+
+// TextureManager::Load に渡すパス
+inline constexpr const char* kTexturePath = "atlas/ui.png";
+inline constexpr uint32_t kWidth = 1024;
+inline constexpr uint32_t kHeight = 512;
+
+enum class Region : uint32_t {
+	kNumber0, // number/0.png
+	kNumber1, // number/1.png
+	kNumber2, // number/2.png
+	kNumber3, // number/3.png
+	kNumber4, // number/4.png
+	kNumber5, // number/5.png
+	kNumber6, // number/6.png
+	kNumber7, // number/7.png
+	kNumber8, // number/8.png
+	kNumber9, // number/9.png
+	kStageText, // number/STAGE1.png
+	kHeart, // HUD/HP.png
+	kKeyJ, // HUD/J.png
+	kKeySpace, // HUD/SPACE.png
+	kKeyEsc, // HUD/ESC.png
+	kButtonA, // HUD/A.png
+	kButtonX, // HUD/X.png
+	kButtonSelect, // HUD/select.png
+	kPause, // UI/pause.png
+	kArrow, // UI/arrow.png
+	kWhite, // (solid white)
+	kCount,
+};
+
+// 領域の位置と大きさ（ピクセル。左上が原点）
+struct Entry {
+	uint32_t x;
+	uint32_t y;
+	uint32_t width;
+	uint32_t height;
+};
+
+// Region の順
+inline constexpr Entry kEntries[] = {
+    {932, 212, 64, 64}, // kNumber0
+    {780, 284, 64, 64}, // kNumber1
+    {852, 284, 64, 64}, // kNumber2
+    {924, 284, 64, 64}, // kNumber3
+    {780, 356, 64, 64}, // kNumber4
+    {852, 356, 64, 64}, // kNumber5
+    {924, 356, 64, 64}, // kNumber6
+    {780, 428, 64, 64}, // kNumber7
+    {852, 428, 64, 64}, // kNumber8
+    {924, 428, 64, 64}, // kNumber9
+    {4, 444, 384, 64}, // kStageText
+    {780, 4, 128, 128}, // kHeart
+    {396, 444, 64, 64}, // kKeyJ
+    {780, 140, 224, 64}, // kKeySpace
+    {780, 212, 144, 64}, // kKeyEsc
+    {468, 444, 64, 64}, // kButtonA
+    {540, 444, 64, 64}, // kButtonX
+    {612, 444, 64, 64}, // kButtonSelect
+    {4, 4, 768, 432}, // kPause
+    {684, 444, 80, 32}, // kArrow
+    {1012, 4, 4, 4}, // kWhite
+};
+static_assert(sizeof(kEntries) / sizeof(kEntries[0]) == static_cast<size_t>(Region::kCount));
+
+} // namespace UiAtlasTable
@@ -3,164 +3,164 @@
 #include "Effects/Fade.h"
 #include "Effects/Skydome.h"
 #include "HUD/HUD.h"
-#include "Objects/ChasingEnemy.h"
-#include "Objects/Enemy.h"
 #include "Objects/Goal.h"
 #include "Objects/Player.h"
-#include "Objects/ShooterEnemy.h"
+#include "Objects/ProjectileView.h"
+#include "Render/SnapshotRenderer.h"
+#include "Render/StageDraw.h"
+#include "Render/UiAtlas.h"
 #include "System/CameraController.h"
 #include "System/GameTime.h"
 #include "System/Gamepad.h"
+#include "System/JobSystem.h"
 #include "System/MapChipField.h"
 #include "UI/UI.h"
+#include "Utils/AffineMatrix.h"
 #include "Utils/Easing.h"
+#include "Utils/SimConvert.h"
 #include "Utils/TransformUpdater.h"
 #include <Windows.h>
 #include <algorithm>
 #include <cstdio>
+#include <ctime>
+#include <filesystem>
 #include <imgui.h>
 #include "StageData.h"
 #include "Scenes/SoundData.h"
 
 using namespace KamataEngine;
 
-/// <summary>
-/// AABB同士の交差判定
-/// </summary>
-bool IsColliding(const AABB& aabb1, const AABB& aabb2) {
-	if ((aabb1.min.x <= aabb2.max.x && aabb1.max.x >= aabb2.min.x) && (aabb1.min.y <= aabb2.max.y && aabb1.max.y >= aabb2.min.y) && (aabb1.min.z <= aabb2.max.z && aabb1.max.z >= aabb2.min.z)) {
-		return true;
-	}
-	return false;
-}
-
-void GameScene::Reset() {
+void GameScene::ResetViews() {
 
 	isPaused_ = false;
-	// --- 1. プレイヤーの再配置と初期化 ---
-	Vector3 playerPosition = mapChipField_->GetMapChipPositionByIndex(1, 9); // フォールバック
-
-	MapChipField::IndexSet startIdx;
-	if (mapChipField_->FindFirstIndexByType(MapChipType::kPlayerStart, startIdx)) {
-		playerPosition = mapChipField_->GetMapChipPositionByIndex(startIdx.xIndex, startIdx.yIndex);
-	}
-
-	// プレイヤーの状態をリセット（Initialize済みのインスタンスを再設定）
-	player_->Initialize(playerModel_, playerTextureHandle_, swordModel_, swordTextureHandle_, &camera_, playerPosition);
-	player_->SetMapChipField(mapChipField_);
-
-	// --- 2. 敵の全削除と再生成 ---
-	// 既存の敵を削除
-	for (Enemy* enemy : enemies_) {
-		delete enemy;
-	}
-	enemies_.clear();
-
-	for (ChasingEnemy* enemy : chasingEnemies_) {
-		delete enemy;
-	}
-	chasingEnemies_.clear();
-
-	for (ShooterEnemy* enemy : shooterEnemies_) {
-		delete enemy;
-	}
-	shooterEnemies_.clear();
-
-	// マップから敵を生成
-	for (uint32_t y = 0; y < mapChipField_->GetNumBlockVertical(); ++y) {
-		for (uint32_t x = 0; x < mapChipField_->GetNumBlockHorizontal(); ++x) {
-			MapChipType t = mapChipField_->GetMapChipTypeByIndex(x, y);
-			if (t == MapChipType::kEnemy) {
-				Vector3 enemyPosition = mapChipField_->GetMapChipPositionByIndex(x, y);
-				Enemy* newEnemy = new Enemy();
-				newEnemy->Initialize(enemyModel_, enemyTextureHandle_, &camera_, enemyPosition);
-				newEnemy->SetMapChipField(mapChipField_);
-				newEnemy->SetSpawnIndex(mapChipField_->GetMapChipIndexSetByPosition(enemyPosition));
-				enemies_.push_back(newEnemy);
-			} else if (t == MapChipType::kChasingEnemy) {
-				Vector3 enemyPosition = mapChipField_->GetMapChipPositionByIndex(x, y);
-				ChasingEnemy* newEnemy = new ChasingEnemy();
-				newEnemy->Initialize(chasingEnemyModel_, chasingEnemyTextureHandle_, &camera_, enemyPosition);
-				newEnemy->SetTargetPlayer(player_);
-				chasingEnemies_.push_back(newEnemy);
-			} else if (t == MapChipType::kShooter) {
-				Vector3 enemyPosition = mapChipField_->GetMapChipPositionByIndex(x, y);
-				ShooterEnemy* newEnemy = new ShooterEnemy();
-				newEnemy->Initialize(shooterEnemyModel_, projectileModel_, shooterEnemyTextureHandle_, projectileTextureHandle_, &camera_, enemyPosition);
-				newEnemy->SetMapChipField(mapChipField_);
-				newEnemy->SetPlayer(player_);
-				shooterEnemies_.push_back(newEnemy);
-			}
-		}
-	}
+	// --- 1. プレイヤーの表示を再設定 ---
+	player_->Initialize(playerModel_, playerTextureHandle_, swordModel_, swordTextureHandle_, &world_.GetPlayer());
 
-	// --- 3. カメラとゴールのリセット ---
-	// ゴール位置の再取得と設定（マップチップにゴールがあればそれを優先）
-	Vector3 goalPosition;
-
-	// 全マップを走査して kGoal を探し、見つかった中で「最も右側(x 最大)」を採用する
-	bool foundGoal = false;
-	MapChipField::IndexSet bestGoalIdx = {0, 0};
-	for (uint32_t y = 0; y < mapChipField_->GetNumBlockVertical(); ++y) {
-		for (uint32_t x = 0; x < mapChipField_->GetNumBlockHorizontal(); ++x) {
-			if (mapChipField_->GetMapChipTypeByIndex(x, y) == MapChipType::kGoal) {
-				if (!foundGoal || x > bestGoalIdx.xIndex || (x == bestGoalIdx.xIndex && y > bestGoalIdx.yIndex)) {
-					bestGoalIdx.xIndex = x;
-					bestGoalIdx.yIndex = y;
-					foundGoal = true;
-				}
-			}
-		}
+	// --- 2. 敵の表示を作り直す（シミュレーション側のリストと同じ並びにする） ---
+	enemyViews_.clear();
+	enemyViews_.resize(world_.GetEnemies().size());
+	for (EnemyView& view : enemyViews_) {
+		view.Initialize(enemyModel_, enemyTextureHandle_, SimEnemy::GetArchetype());
 	}
 
-	if (foundGoal) {
-		goalPosition = mapChipField_->GetMapChipPositionByIndex(bestGoalIdx.xIndex, bestGoalIdx.yIndex);
-		// デバッグ出力
-		{
-			std::string msg = "Map goal found at index x=" + std::to_string(bestGoalIdx.xIndex) + ", y=" + std::to_string(bestGoalIdx.yIndex) + "\n";
-			OutputDebugStringA(msg.c_str());
-			std::string posMsg = "Map goal world pos x=" + std::to_string(goalPosition.x) + ", y=" + std::to_string(goalPosition.y) + "\n";
-			OutputDebugStringA(posMsg.c_str());
-		}
-	} else {
-		// 互換性のために従来のフォールバック（ステージによる固定位置）を残す
-		switch (currentStageNo_) {
-		case 1:
-			goalPosition = mapChipField_->GetMapChipPositionByIndex(49, 3);
-			break;
-		case 2:
-		case 3:
-			goalPosition = mapChipField_->GetMapChipPositionByIndex(37, 10);
-			break;
-		default:
-			goalPosition = mapChipField_->GetMapChipPositionByIndex(5, 4);
-			break;
-		}
-		// デバッグ出力（フォールバック使用）
-		{
-			std::string msg = "No map goal found: using fallback for stage " + std::to_string(currentStageNo_) + "\n";
-			OutputDebugStringA(msg.c_str());
-		}
+	chasingEnemyViews_.clear();
+	chasingEnemyViews_.resize(world_.GetChasingEnemies().size());
+	for (EnemyView& view : chasingEnemyViews_) {
+		view.Initialize(chasingEnemyModel_, chasingEnemyTextureHandle_, SimChasingEnemy::GetArchetype());
 	}
 
-	// ゴールインスタンスがあれば再初期化（位置のみ更新）
-	if (goal_) {
-		goal_->Initialize(goalModel_, goalPosition);
+	shooterEnemyViews_.clear();
+	shooterEnemyViews_.resize(world_.GetShooterEnemies().size());
+	for (EnemyView& view : shooterEnemyViews_) {
+		view.Initialize(shooterEnemyModel_, shooterEnemyTextureHandle_, SimShooterEnemy::GetArchetype());
 	}
 
+	projectileView_->Initialize(projectileModel_, projectileTextureHandle_);
+
+	// --- 3. カメラとゴールのリセット ---
+	goal_->Initialize(goalModel_, ToVector3(world_.GetGoalPosition()));
+
 	// カメラコントローラーのリセット
 	cameraController_->SetTarget(player_);
 	cameraController_->Reset();
 	cameraTargetAngleZ_ = 0.0f;
-	cameraController_->targetOffset = {0, 0, -30.0f}; // カメラ距離の初期化
-
-	// --- 4. フェーズと演出のリセット ---
-	// デフォルトではリトライ用のフェードイン
-	phase_ = Phase::kFadeIn;
-	stageStartTimer_ = 0.0f;
+	cameraController_->targetOffset = {0, 0, -StageDraw::kCameraDistance}; // カメラ距離の初期化
 
+	// --- 4. 演出のリセット ---
 	// FadeIn開始状態（真っ黒）にする
 	fade_->Start(Fade::Status::FadeIn, 1.0f);
+
+	// 作り直した直後は補間しない
+	SavePreviousViewStates();
+}
+
+void GameScene::SavePreviousViewStates() {
+	player_->SavePreviousState();
+
+	const std::vector<SimEnemy>& enemies = world_.GetEnemies();
+	for (size_t i = 0; i < enemyViews_.size(); ++i) {
+		enemyViews_[i].SavePreviousState(enemies[i].GetHotState());
+	}
+	const std::vector<SimChasingEnemy>& chasingEnemies = world_.GetChasingEnemies();
+	for (size_t i = 0; i < chasingEnemyViews_.size(); ++i) {
+		chasingEnemyViews_[i].SavePreviousState(chasingEnemies[i].GetHotState());
+	}
+	const std::vector<SimShooterEnemy>& shooterEnemies = world_.GetShooterEnemies();
+	for (size_t i = 0; i < shooterEnemyViews_.size(); ++i) {
+		shooterEnemyViews_[i].SavePreviousState(shooterEnemies[i].GetHotState());
+	}
+}
+
+void GameScene::SyncViews(float alpha) {
+	player_->Update(alpha);
+	goal_->Update();
+
+	// カメラはプレイヤーの表示位置を追うので、プレイヤーの後・敵の前に動かす（映る範囲を敵の判定に使う）
+	UpdateCamera();
+
+	// 敵の姿勢の補間は互いに独立しているので並列に行う（画面の外の敵は補間しない）
+	JobSystem* jobSystem = JobSystem::GetInstance();
+	const std::vector<SimEnemy>& enemies = world_.GetEnemies();
+	jobSystem->ParallelFor(static_cast<uint32_t>(enemyViews_.size()), kEntityGrainSize, [&](uint32_t begin, uint32_t end) {
+		for (uint32_t i = begin; i < end; ++i) {
+			enemyViews_[i].UpdateVisibility(enemies[i].GetHotState(), visibleRect_);
+			enemyViews_[i].Update(enemies[i].GetHotState(), alpha);
+		}
+	});
+	const std::vector<SimChasingEnemy>& chasingEnemies = world_.GetChasingEnemies();
+	jobSystem->ParallelFor(static_cast<uint32_t>(chasingEnemyViews_.size()), kEntityGrainSize, [&](uint32_t begin, uint32_t end) {
+		for (uint32_t i = begin; i < end; ++i) {
+			chasingEnemyViews_[i].UpdateVisibility(chasingEnemies[i].GetHotState(), visibleRect_);
+			chasingEnemyViews_[i].Update(chasingEnemies[i].GetHotState(), alpha);
+		}
+	});
+	const std::vector<SimShooterEnemy>& shooterEnemies = world_.GetShooterEnemies();
+	jobSystem->ParallelFor(static_cast<uint32_t>(shooterEnemyViews_.size()), kEntityGrainSize, [&](uint32_t begin, uint32_t end) {
+		for (uint32_t i = begin; i < end; ++i) {
+			shooterEnemyViews_[i].UpdateVisibility(shooterEnemies[i].GetHotState(), visibleRect_);
+			shooterEnemyViews_[i].Update(shooterEnemies[i].GetHotState(), alpha);
+		}
+	});
+
+	projectileView_->Update(shooterEnemies, alpha, visibleRect_);
+
+	// 毎フレーム動くもの（剣・敵・弾・パーティクル）の行列はまとめて計算する
+	dynamicTransformBatch_.Clear();
+	player_->AddTransforms(dynamicTransformBatch_);
+	for (size_t i = 0; i < enemyViews_.size(); ++i) {
+		enemyViews_[i].AddTransform(dynamicTransformBatch_, enemies[i].GetHotState());
+	}
+	for (size_t i = 0; i < chasingEnemyViews_.size(); ++i) {
+		chasingEnemyViews_[i].AddTransform(dynamicTransformBatch_, chasingEnemies[i].GetHotState());
+	}
+	for (size_t i = 0; i < shooterEnemyViews_.size(); ++i) {
+		shooterEnemyViews_[i].AddTransform(dynamicTransformBatch_, shooterEnemies[i].GetHotState());
+	}
+	projectileView_->AddTransforms(dynamicTransformBatch_);
+	if (deathParticles_) {
+		deathParticles_->AddTransforms(dynamicTransformBatch_);
+	}
+	dynamicTransformBatch_.Update();
+}
+
+void GameScene::UpdateCamera() {
+	if (isDebugCameraActive_) {
+		debugCamera_->Update();
+		camera_.matView = debugCamera_->GetCamera().matView;
+		camera_.matProjection = debugCamera_->GetCamera().matProjection;
+		camera_.TransferMatrix();
+	} else {
+		// プレイヤーの表示位置を、ロールで回したオフセットだけ離れて見る（ベンチと同じ式）
+		camera_.rotation_.z = StageDraw::StepCameraRoll(camera_.rotation_.z, cameraTargetAngleZ_);
+		camera_.matView = RenderSnapshot::ToMatrix4x4(StageDraw::MakeCameraView(player_->GetWorldPosition(), cameraController_->targetOffset, camera_.rotation_.z));
+		camera_.UpdateProjectionMatrix();
+		camera_.TransferMatrix();
+	}
+
+	// 描画に使う行列から映る範囲を求める（求められないときは全て映っているとする）
+	StageDraw::ComputeVisibleArea(
+	    RenderSnapshot::ToRenderMatrix(camera_.matView), RenderSnapshot::ToRenderMatrix(camera_.matProjection), ToFloat(mapChipField_->GetBlockWidth()),
+	    ToFloat(mapChipField_->GetBlockHeight()), mapChipField_->GetNumBlockHorizontal(), mapChipField_->GetNumBlockVertical(), visibleRect_, visibleTiles_);
 }
 
 void GameScene::Initialize(int stageNo) {
@@ -190,7 +190,6 @@ void GameScene::Initialize(int stageNo) {
 	swordModel_ = Model::CreateFromOBJ("sword", true);
 	// フォルダ名 "clearText" を指定（その中の clearText.obj が読み込まれます）
 	clearModel_ = Model::CreateFromOBJ("clearText", true);
-	objectColorClear_.Initialize();
 	colorClear_ = {3.0f, 3.0f, 0.0f, 1.0f};
 
 	// ロードに失敗していないかログを出すと確実です 🔍
@@ -200,14 +199,8 @@ void GameScene::Initialize(int stageNo) {
 
 	clearWorldTransform_.Initialize();
 
-	jHandle_ = TextureManager::GetInstance()->Load("HUD/J.png");
-	spaceHandle_ = TextureManager::GetInstance()->Load("HUD/space.png");
-	escHandle_ = TextureManager::GetInstance()->Load("HUD/esc.png");
-
-	// --- コントローラ用スプライトをロード ---
-	aHandle_ = TextureManager::GetInstance()->Load("HUD/A.png");
-	xHandle_ = TextureManager::GetInstance()->Load("HUD/X.png");
-	selectHandle_ = TextureManager::GetInstance()->Load("HUD/select.png");
+	// キー・ボタンの表示は UiAtlas の領域（キーボードは J / space / esc、コントローラは A / X / select）
+	UiAtlas::GetInstance()->Load();
 
 	// --- 2. 座標変換・カメラの基本初期化 ---
 	worldTransform_.Initialize();
@@ -219,13 +212,14 @@ void GameScene::Initialize(int stageNo) {
 	std::string mapFileName = "Resources/stage/stage" + std::to_string(stageNo) + ".csv";
 	mapChipField_->LoadMapChipCsv(mapFileName);
 
-	// --- 4. オブジェクトのインスタンス生成 (配置はResetで行う) ---
-	player_ = new Player(); // 中身はResetで初期化される
+	// --- 4. オブジェクトのインスタンス生成 (配置はResetViewsで行う) ---
+	player_ = new Player(); // 中身はResetViewsで初期化される
+	projectileView_ = new ProjectileView();
 
 	deathParticles_ = new DeathParticles();
 	deathParticles_->Initialize(particleModel_, particleTextureHandle, &camera_, {0, 0, 0});
 
-	goal_ = new Goal(); // 中身はResetで初期化される
+	goal_ = new Goal(); // 中身はResetViewsで初期化される
 
 	// ブロック生成 (マップ依存なのでここで生成)
 	GenerateBlocks();
@@ -256,46 +250,19 @@ void GameScene::Initialize(int stageNo) {
 	HUD_ = new HUD;
 	HUD_->Initialize();
 
-	jSprite_ = Sprite::Create(jHandle_, {64, 600});
-	if (jSprite_) {
-		jSprite_->SetSize({64, 64});
-	}
-	spaceSprite_ = Sprite::Create(spaceHandle_, {192, 600});
-	if (spaceSprite_) {
-		spaceSprite_->SetSize({224, 64});
-	}
-	escSprite_ = Sprite::Create(escHandle_, {64, 128});
-	if (escSprite_) {
-		escSprite_->SetSize({144, 64});
-	}
-
-	// コントローラ用スプライト生成
-	if (aHandle_)
-		aSprite_ = Sprite::Create(aHandle_, {64, 600});
-	if (xHandle_)
-		xSprite_ = Sprite::Create(xHandle_, {64, 600});
-	if (selectHandle_)
-		selectSprite_ = Sprite::Create(selectHandle_, {64, 128});
-	if (aSprite_)
-		aSprite_->SetSize({64, 64});
-	if (xSprite_)
-		xSprite_->SetSize({64, 64});
-	if (selectSprite_)
-		selectSprite_->SetSize({64, 64});
-
 	// 初期入力はキーボードと見なす
 	lastInputIsGamepad_ = false;
 
 	finished_ = false;
 
-	// --- 5. 共通初期化処理の呼び出し ---
-	// 敵の生成、プレイヤー・カメラの配置リセットなどを実行
-	Reset();
-
-	// --- 6. Initialize特有の上書き設定 ---
-	// Resetではリトライ用に FadeIn になるが、
-	// ステージ開始時は「ステージ番号表示演出」を行いたいので上書きする
-	phase_ = Phase::kStageStart;
+	// --- 5. シミュレーションの初期化と表示側の配置 ---
+	// 敵の生成・プレイヤーの配置はシミュレーション側で行い、ステージ開始演出から始まる
+	world_.Initialize(mapChipField_, stageNo);
+	inputRecording_.Start(stageNo);
+	hashLog_.Start(stageNo);
+	rollbackBuffer_.Initialize(world_);
+	ResetViews();
+	SyncViews(1.0f);
 
 	// BGMの再生開始 (ループフラグをtrueにする)
 	auto audio = Audio::GetInstance();
@@ -344,7 +311,8 @@ void GameScene::Update() {
 
 		if (confirm) {
 			if (pauseMenuIndex_ == 0) {
-				Reset();
+				// リスタートも入力として次のステップで処理する（リプレイで再現できるように）
+				pendingTriggers_ = static_cast<uint8_t>(SimButton::kRestart);
 				isPaused_ = false;
 				return;
 			}
@@ -356,128 +324,102 @@ void GameScene::Update() {
 			isPaused_ = false;
 		}
 
+		// ポーズ中に押されたボタンはゲームに渡さない
+		pendingTriggers_ = 0;
 		return; // ポーズ中は以下のゲームロジック（フェーズ処理）をスキップ
 	}
 
-	// --- フェーズごとの処理 ---
-	switch (phase_) {
-	case Phase::kStageStart:
-		// ★ステージ開始演出（暗転＆番号表示）
-		stageStartTimer_ += GameTime::GetDeltaTime();
+	// --- シミュレーションを固定ステップで進める ---
+	// 押した瞬間の入力は、ステップが進まないフレームでも取りこぼさないように貯めておき、
+	// 次に進める最初のステップにだけ渡す
+	SimInput input = MakeSimInput();
+	pendingTriggers_ |= input.triggered;
 
-		// フェードのUpdateは呼ばず、真っ黒の状態を維持する
+	const uint32_t stepCount = GameTime::GetStepCount();
+	for (uint32_t step = 0; step < stepCount && !finished_; ++step) {
+		input.triggered = pendingTriggers_;
+		pendingTriggers_ = 0;
 
-		cameraController_->Update(); // カメラは動かしておく
+		// 描画時の補間の始点として、進める前の状態を保存する
+		SavePreviousViewStates();
 
-		// 3秒経過したらフェードイン開始
-		if (stageStartTimer_ >= 3.0f) {
-			phase_ = Phase::kFadeIn;
-			// Startは既にInitialize/Resetで呼ばれているので、ここで再度呼ぶ必要はない
-			// （counterが0のままなので、ここからUpdateを呼べばフェードインが始まる）
+		// 演出はシミュレーションを進める前のフェーズに合わせて更新する
+		const SimPhase prePhase = world_.GetPhase();
+		rollbackBuffer_.Save(world_);
+		simEvents_.clear();
+		world_.Step(input, simEvents_);
+		inputRecording_.Push(input);
+		if (kSaveInputRecording) {
+			hashLog_.Push(world_.ComputeStateHash());
 		}
-		break;
 
-	case Phase::kFadeIn:
-		// フェード更新（徐々に明るくなる）
-		fade_->Update();
-		if (fade_->IsFinished()) {
-			phase_ = Phase::kPlay;
+		// リセットされた場合は表示側も作り直す（このステップの演出は行わない）
+		bool isReset = std::any_of(simEvents_.begin(), simEvents_.end(), [](const SimEvent& event) { return event.type == SimEventType::kReset; });
+		if (isReset) {
+			ResetViews();
+		} else {
+			UpdatePhaseEffects(prePhase);
 		}
-		cameraController_->Update();
-		break;
 
-	case Phase::kPlay: {
-		// ポーズ中はゲームプレイ更新を停止してImGuiでメニュー表示
-		if (isPaused_) {
-			// UI にポーズ入力を処理させる
-			bool confirm = false;
-			bool cancel = false;
-			UI_->HandlePauseInput(pauseMenuIndex_, confirm, cancel);
-
-			if (confirm) {
-				if (pauseMenuIndex_ == 0) {
-					Reset();
-					isPaused_ = false;
-					showControls_ = false;
-					return;
-				} else if (pauseMenuIndex_ == 1) {
-					finished_ = true;
-				}
-			}
-			if (cancel) {
-				// キャンセル（ESC 相当）はポーズ解除
-				isPaused_ = false;
-				showControls_ = false;
-			}
+		HandleSimEvents();
+	}
 
 #ifdef _DEBUG
-			ImGui::Begin("ポーズメニュー");
-			ImGui::Text("ポーズ中");
-			if (ImGui::Button("操作確認")) {
-				showControls_ = !showControls_;
-			}
-			if (showControls_) {
-				ImGui::Separator();
-				ImGui::TextWrapped("操作方法:\n← → : 移動\nSPACE : ジャンプ\nR : リセット\nESC : ポーズ切替");
-			}
-			ImGui::Separator();
-			ImGui::Text("↑/↓ で選択, SPACE/Enter で決定");
-			if (ImGui::Selectable("1: リスタート", pauseMenuIndex_ == 0)) {
-				pauseMenuIndex_ = 0;
-				Reset();
-				isPaused_ = false;
-				showControls_ = false;
-				ImGui::End();
-				return;
-			}
-			if (ImGui::Selectable("2: ステージセレクトに戻る", pauseMenuIndex_ == 1)) {
-				pauseMenuIndex_ = 1;
-				finished_ = true;
-			}
-			ImGui::End();
-#endif
-			break;
+	if (Input::GetInstance()->TriggerKey(DIK_0)) {
+		if (isDebugCameraActive_) {
+			isDebugCameraActive_ = false;
+		} else {
+			isDebugCameraActive_ = true;
 		}
+	}
+#endif
 
-		GameTime::Update();
+	// 直前のステップと現在のステップの間を補間して表示側へ反映する（カメラもここで動かす）
+	SyncViews(GameTime::GetAlpha());
 
-		if (Input::GetInstance()->TriggerKey(DIK_R)) {
-			Reset();
-			return;
-		}
+	// --- 共通更新 ---
 
-		Vector3 gravityVector = {0.0f, -Player::GetGravityAcceleration(), 0.0f};
+	// ブロックは動かないので、行列は GenerateBlocks で一度だけ計算・転送している
 
-		// タイムスケールの計算
-		float timeScale = 1.0f; // 通常は1倍速
-		if (player_->GetIsDeadAnimating()) {
-			timeScale = 0.2f; // 死亡演出中は0.2倍速（スローモーション）
-		}
+	skydome_->Update();
 
-		// ★変更: timeScale と3種の敵リストを渡す
-		player_->Update(gravityVector, cameraTargetAngleZ_, enemies_, chasingEnemies_, shooterEnemies_, timeScale);
+	HUD_->Update(player_);
+	if (isPaused_) {
+		UI_->Update();
+	}
+}
 
-		goal_->Update();
+SimInput GameScene::MakeSimInput() const {
+	Input* input = Input::GetInstance();
+	Gamepad* gamepad = Gamepad::GetInstance();
+
+	SimInput simInput;
+	simInput.SetHeld(SimButton::kRight, input->PushKey(DIK_D) || gamepad->IsPressed(XINPUT_GAMEPAD_DPAD_RIGHT) || gamepad->GetLeftThumbXf() > kGamepadStickThreshold);
+	simInput.SetHeld(SimButton::kLeft, input->PushKey(DIK_A) || gamepad->IsPressed(XINPUT_GAMEPAD_DPAD_LEFT) || gamepad->GetLeftThumbXf() < -kGamepadStickThreshold);
+	simInput.SetTriggered(SimButton::kJump, input->TriggerKey(DIK_SPACE) || gamepad->IsTriggered(XINPUT_GAMEPAD_A));
+	simInput.SetTriggered(SimButton::kAttack, input->TriggerKey(DIK_J) || gamepad->IsTriggered(XINPUT_GAMEPAD_X));
+	simInput.SetTriggered(SimButton::kReset, input->TriggerKey(DIK_R));
+	return simInput;
+}
 
-		for (Enemy* enemy : enemies_) {
-			enemy->Update();
-		}
-		for (ChasingEnemy* enemy : chasingEnemies_) {
-			enemy->Update();
-		}
-		for (ShooterEnemy* enemy : shooterEnemies_) {
-			enemy->Update();
-		}
+void GameScene::UpdatePhaseEffects(SimPhase phase) {
+	switch (phase) {
+	case SimPhase::kStageStart:
+		// フェードのUpdateは呼ばず、真っ黒の状態を維持する
+		cameraController_->Update(); // カメラは動かしておく
+		break;
 
+	case SimPhase::kFadeIn:
+		// フェード更新（徐々に明るくなる）
+		fade_->Update();
 		cameraController_->Update();
-		CheckAllCollisions();
-		ChangePhase();
 		break;
-	}
-	case Phase::kGoalAnimation:
-		// プレイヤーの演出更新（重力などは演出内で制御）
-		player_->UpdateGoalAnimation();
 
+	case SimPhase::kPlay:
+		cameraController_->Update();
+		break;
+
+	case SimPhase::kGoalAnimation:
 		// --- クリアモデルの「奥から手前」演出更新 ---
 		{
 			// 演出の時間を 1.0秒 と定義
@@ -488,7 +430,8 @@ void GameScene::Update() {
 			// ★ポイント1：EaseOutBack を使って「弾む」ような動きにする
 			float easedT = EaseOutBack(t);
 
-			Vector3 playerPos = player_->GetWorldPosition();
+			// 表示側の補間はステップの後にまとめて行うので、シミュレーションの現在位置を使う
+			Vector3 playerPos = ToVector3(world_.GetPlayer().GetTranslation());
 
 			// ★ポイント2：スケールを 0.0 から 1.0 へ（飛び出す感）
 			clearWorldTransform_.scale_ = {easedT, easedT, easedT};
@@ -506,352 +449,249 @@ void GameScene::Update() {
 			clearWorldTransform_.rotation_ = {0.0f, 0.0f, 0.0f};
 
 			// 行列更新
-			TransformUpdater::WorldTransformUpdate(clearWorldTransform_);
-			clearWorldTransform_.TransferMatrix();
+			TransformUpdater::UpdateMatrix(clearWorldTransform_);
 		}
 
 		// カメラを滑らかに近づける処理 (線形補間)
 		{
-			goalCameraTimer_ += 1.0f / 60.0f;
-
-			// 0.5秒かけて近づく
-			float duration = 0.5f;
-			float t = std::clamp(goalCameraTimer_ / duration, 0.0f, 1.0f);
-
-			// Z軸のオフセットを変化させる
-			// -30.0f (通常) → -10.0f (アップ)
-			float startZ = -30.0f;
-			float endZ = -10.0f;
-
-			// Lerpで補間 (t をそのまま使うと線形補間になります)
-			cameraController_->targetOffset.z = Lerp(startZ, endZ, t);
+			goalCameraTimer_ += GameTime::GetDeltaTime();
 
-			// 必要に応じて高さ(Y)も調整したい場合はここに追加
-			// cameraController_->targetOffset.y = Lerp(0.0f, 2.0f, t);
+			// Z軸のオフセットを -30.0f (通常) → -10.0f (アップ) へ 0.5秒かけて変化させる
+			cameraController_->targetOffset.z = StageDraw::GetGoalCameraOffsetZ(goalCameraTimer_);
 		}
 
 		// カメラはプレイヤーを追い続ける
 		cameraController_->Update();
-
-		// プレイヤーの演出が終わったらフェードアウトへ
-		if (player_->GetGoalAnimationPhase() == GoalAnimationPhase::kEnd) {
-			phase_ = Phase::kFadeOut;
-			fade_->Start(Fade::Status::FadeOut, 1.0f);
-		}
 		break;
-	case Phase::kDeath:
+
+	case SimPhase::kDeath:
 		deathParticles_->Update();
-		if (deathParticles_ && deathParticles_->IsFinished()) {
-			phase_ = Phase::kDeathFadeOut;
-			fade_->Start(Fade::Status::FadeOut, 1.0f);
-		}
 		break;
-	case Phase::kDeathFadeOut:
+
+	case SimPhase::kDeathFadeOut:
+	case SimPhase::kFadeOut:
 		fade_->Update();
-		if (fade_->IsFinished()) {
-			Reset();
-		}
 		break;
-	case Phase::kFadeOut:
-		fade_->Update();
-		if (fade_->IsFinished()) {
-			// ★追加：シーン終了直前に、今のステージをクリア済みにする ✨
-			// currentStageNo_ は 1から始まるので、-1 して配列のインデックス(0～2)に合わせる
-			if (currentStageNo_ >= 1 && currentStageNo_ <= 3) {
-				StageData::isCleared[currentStageNo_ - 1] = true;
-			}
-			finished_ = true;
-		}
+
+	case SimPhase::kCleared:
 		break;
 	}
+}
 
-	// --- 共通更新 ---
+void GameScene::HandleSimEvents() {
+	Audio* audio = Audio::GetInstance();
 
-	for (std::vector<WorldTransform*>& worldTransformBlockLine : worldTransformBlocks_) {
-		for (WorldTransform* worldTransformBlock : worldTransformBlockLine) {
-			if (worldTransformBlock == nullptr) {
-				continue;
-			}
-			TransformUpdater::WorldTransformUpdate(*worldTransformBlock);
-			worldTransformBlock->TransferMatrix();
-		}
-	}
+	for (const SimEvent& event : simEvents_) {
+		switch (event.type) {
+		case SimEventType::kPlayerJump:
+			audio->PlayWave(SoundData::sePlayerJump, false);
+			break;
 
-	skydome_->Update();
+		case SimEventType::kPlayerAttack:
+			audio->PlayWave(SoundData::sePlayerAttack, false);
+			break;
 
-#ifdef _DEBUG
-	if (Input::GetInstance()->TriggerKey(DIK_0)) {
-		if (isDebugCameraActive_) {
-			isDebugCameraActive_ = false;
-		} else {
-			isDebugCameraActive_ = true;
+		case SimEventType::kPlayerDamage:
+			audio->PlayWave(SoundData::sePlayerDamage, false);
+			break;
+
+		case SimEventType::kEnemyDeath: {
+			uint32_t voiceHandle = audio->PlayWave(SoundData::seEnemyDeath, false);
+			audio->SetVolume(voiceHandle, 1.0f);
+			break;
 		}
-	}
-#endif
 
-	if (isDebugCameraActive_) {
-		debugCamera_->Update();
-		camera_.matView = debugCamera_->GetCamera().matView;
-		camera_.matProjection = debugCamera_->GetCamera().matProjection;
-		camera_.TransferMatrix();
-	} else {
-		Vector3 targetPosition = player_->GetWorldPosition();
-		Vector3 baseOffset = cameraController_->targetOffset;
-		float currentAngle = camera_.rotation_.z;
-		float diff = std::fmod(cameraTargetAngleZ_ - currentAngle + std::numbers::pi_v<float>, 2.0f * std::numbers::pi_v<float>) - std::numbers::pi_v<float>;
-		float lerpedAngle = currentAngle + diff * 0.2f;
-		camera_.rotation_.z = lerpedAngle;
-		Matrix4x4 rollMatrix = TransformUpdater::MakeRoteZMatrix(camera_.rotation_.z);
-		Vector3 rotatedOffset = TransformUpdater::TransformNormal(baseOffset, rollMatrix);
-		Vector3 rotatedUpVector = TransformUpdater::TransformNormal({0.0f, 1.0f, 0.0f}, rollMatrix);
-		Vector3 cameraPosition = targetPosition + rotatedOffset;
-		camera_.matView = TransformUpdater::MakeLookAtMatrix(cameraPosition, targetPosition, rotatedUpVector);
-		camera_.UpdateProjectionMatrix();
-		camera_.TransferMatrix();
-	}
+		case SimEventType::kPhaseChanged:
+			switch (event.phase) {
+			case SimPhase::kGoalAnimation:
+				// カメラ演出用タイマーのリセット
+				goalCameraTimer_ = 0.0f;
+				break;
+			case SimPhase::kDeath:
+				deathParticles_->Start(ToVector3(event.position));
+				break;
+			case SimPhase::kDeathFadeOut:
+			case SimPhase::kFadeOut:
+				fade_->Start(Fade::Status::FadeOut, 1.0f);
+				break;
+			case SimPhase::kCleared:
+				// シーン終了直前に、今のステージをクリア済みにする
+				// currentStageNo_ は 1から始まるので、-1 して配列のインデックス(0～2)に合わせる
+				if (currentStageNo_ >= 1 && currentStageNo_ <= 3) {
+					StageData::isCleared[currentStageNo_ - 1] = true;
+				}
+				finished_ = true;
+				break;
+			default:
+				break;
+			}
+			break;
 
-	HUD_->Update();
-	if (isPaused_) {
-		UI_->Update();
+		case SimEventType::kReset:
+			// 表示側の作り直しは Update で済ませている
+			break;
+		}
 	}
-
-	objectColorClear_.SetColor(colorClear_);
 }
 
 void GameScene::Draw() {
-	KamataEngine::DirectXCommon* dxCommon = KamataEngine::DirectXCommon::GetInstance();
+	BuildSnapshot(snapshot_);
+	SnapshotRenderer::GetInstance()->Execute(snapshot_);
+}
 
-	// 3Dモデル描画前処理
-	KamataEngine::Model::PreDraw(dxCommon->GetCommandList());
+void GameScene::BuildSnapshot(RenderSnapshot& snapshot) {
+	snapshot.Clear();
+	snapshot.SetCamera(camera_);
 
-	for (std::vector<WorldTransform*>& worldTransformBlockLine : worldTransformBlocks_) {
-		for (WorldTransform* worldTransformBlock : worldTransformBlockLine) {
-			if (worldTransformBlock == nullptr) {
-				continue;
-			}
-			cubeModel_->Draw(*worldTransformBlock, camera_);
-		}
-	}
+	// ブロックは映っている列の範囲を合わせて1件
+	StageDraw::AddVisibleBlocks(
+	    snapshot, blockInstances_.GetModel(), blockInstances_.HasTexture(), blockInstances_.GetTextureHandle(), blockInstances_.GetMatrices(), blockColumnOffsets_,
+	    visibleTiles_, &blockInstances_);
 
-	player_->Draw();
+	player_->Draw(snapshot);
 
-	goal_->Draw(camera_);
+	goal_->Draw(snapshot);
 
-	for (Enemy* enemy : enemies_) {
-		enemy->Draw();
+	const std::vector<SimEnemy>& enemies = world_.GetEnemies();
+	for (size_t i = 0; i < enemyViews_.size(); ++i) {
+		enemyViews_[i].Draw(snapshot, enemies[i].GetHotState());
 	}
-	for (ChasingEnemy* enemy : chasingEnemies_) {
-		enemy->Draw();
+	const std::vector<SimChasingEnemy>& chasingEnemies = world_.GetChasingEnemies();
+	for (size_t i = 0; i < chasingEnemyViews_.size(); ++i) {
+		chasingEnemyViews_[i].Draw(snapshot, chasingEnemies[i].GetHotState());
 	}
-	for (ShooterEnemy* enemy : shooterEnemies_) {
-		enemy->Draw();
+	const std::vector<SimShooterEnemy>& shooterEnemies = world_.GetShooterEnemies();
+	for (size_t i = 0; i < shooterEnemyViews_.size(); ++i) {
+		shooterEnemyViews_[i].Draw(snapshot, shooterEnemies[i].GetHotState());
 	}
+	// 弾は本体が死んでいても描画する
+	projectileView_->Draw(snapshot);
 
 	if (deathParticles_) {
-		deathParticles_->Draw();
+		deathParticles_->Draw(snapshot);
 	}
 
-	skydome_->Draw();
-
-	// 3Dモデル描画後処理
-	KamataEngine::Model::PostDraw();
+	skydome_->Draw(snapshot);
 
-	KamataEngine::Model::PreDraw(dxCommon->GetCommandList());
-
-	if (phase_ == Phase::kGoalAnimation) {
-		clearModel_->Draw(clearWorldTransform_, camera_, &objectColorClear_);
+	if (world_.GetPhase() == SimPhase::kGoalAnimation) {
+		snapshot.AddColoredModel(clearModel_, clearWorldTransform_, colorClear_);
 	}
 
-	KamataEngine::Model::PostDraw();
-
 	// フェード（黒い背景）を描画
-	fade_->Draw();
+	fade_->Draw(snapshot);
 
 	// ステージ開始時は、フェードの上から文字を表示する
-	if (phase_ == Phase::kStageStart) {
-		HUD_->DrawStageNumber(currentStageNo_);
+	if (world_.GetPhase() == SimPhase::kStageStart) {
+		HUD_->DrawStageNumber(snapshot, currentStageNo_);
 	}
 
-	Sprite::PreDraw(dxCommon->GetCommandList());
+	// キー・ボタン表示（押されているものは暗く表示する。並べ方は StageDraw::AddInputGuide）
+	bool isPressed[StageDraw::kInputGuideCount] = {};
 	if (!lastInputIsGamepad_) {
-		// キーボード表示（既存）
-		if (Input::GetInstance()->PushKey(DIK_J)) {
-			jSprite_->SetColor({0.5f, 0.5f, 0.5f, 1.0f});
-		} else {
-			jSprite_->SetColor({1.0f, 1.0f, 1.0f, 1.0f});
-		}
-		jSprite_->Draw();
-		if (Input::GetInstance()->PushKey(DIK_SPACE)) {
-			spaceSprite_->SetColor({0.5f, 0.5f, 0.5f, 1.0f});
-		} else {
-			spaceSprite_->SetColor({1.0f, 1.0f, 1.0f, 1.0f});
-		}
-		spaceSprite_->Draw();
-		if (Input::GetInstance()->PushKey(DIK_ESCAPE)) {
-			escSprite_->SetColor({0.5f, 0.5f, 0.5f, 1.0f});
-		} else {
-			escSprite_->SetColor({1.0f, 1.0f, 1.0f, 1.0f});
-		}
-		escSprite_->Draw();
+		// キーボード表示（J・Space・Esc）
+		Input* input = Input::GetInstance();
+		isPressed[0] = input->PushKey(DIK_J);
+		isPressed[1] = input->PushKey(DIK_SPACE);
+		isPressed[2] = input->PushKey(DIK_ESCAPE);
 	} else {
-		// コントローラ表示
-		// A (ジャンプ/決定)
-		if (Gamepad::GetInstance()->IsPressed(XINPUT_GAMEPAD_A)) {
-			aSprite_->SetColor({0.5f, 0.5f, 0.5f, 1.0f});
-		} else {
-			aSprite_->SetColor({1.0f, 1.0f, 1.0f, 1.0f});
-		}
-		aSprite_->SetPosition({64, 600});
-		aSprite_->Draw();
-
-		// X (攻撃)
-		if (Gamepad::GetInstance()->IsPressed(XINPUT_GAMEPAD_X)) {
-			xSprite_->SetColor({0.5f, 0.5f, 0.5f, 1.0f});
-		} else {
-			xSprite_->SetColor({1.0f, 1.0f, 1.0f, 1.0f});
-		}
-		xSprite_->SetPosition({192, 600});
-		xSprite_->Draw();
-
-		// START / SELECT 表示（select.png）
-		if (Gamepad::GetInstance()->IsPressed(XINPUT_GAMEPAD_START) || Gamepad::GetInstance()->IsPressed(XINPUT_GAMEPAD_BACK)) {
-			selectSprite_->SetColor({0.5f, 0.5f, 0.5f, 1.0f});
-		} else {
-			selectSprite_->SetColor({1.0f, 1.0f, 1.0f, 1.0f});
-		}
-		selectSprite_->SetPosition({64, 128});
-		selectSprite_->Draw();
+		// コントローラ表示（A (ジャンプ/決定)・X (攻撃)・START / SELECT）
+		Gamepad* gamepad = Gamepad::GetInstance();
+		isPressed[0] = gamepad->IsPressed(XINPUT_GAMEPAD_A);
+		isPressed[1] = gamepad->IsPressed(XINPUT_GAMEPAD_X);
+		isPressed[2] = gamepad->IsPressed(XINPUT_GAMEPAD_START) || gamepad->IsPressed(XINPUT_GAMEPAD_BACK);
 	}
-	Sprite::PostDraw();
+	StageDraw::AddInputGuide(snapshot, UiAtlas::GetInstance()->GetTextureHandle(), lastInputIsGamepad_, isPressed);
 
-	HUD_->Draw(player_);
+	HUD_->Draw(snapshot);
 	if (isPaused_) {
-		UI_->Draw(pauseMenuIndex_);
+		UI_->Draw(snapshot, pauseMenuIndex_);
 	}
+
+	// 同じモデル・テクスチャの描画をまとめ、モデル → スプライトの順に並べる
+	snapshot.Sort();
 }
 
 void GameScene::GenerateBlocks() {
 	uint32_t numBlockVirtical = mapChipField_->GetNumBlockVertical();
 	uint32_t numBlockHorizontal = mapChipField_->GetNumBlockHorizontal();
-	worldTransformBlocks_.resize(numBlockVirtical);
-	for (uint32_t i = 0; i < numBlockVirtical; ++i) {
-		worldTransformBlocks_[i].resize(numBlockHorizontal);
-	}
 
-	for (uint32_t i = 0; i < numBlockVirtical; ++i) {
-		for (uint32_t j = 0; j < numBlockHorizontal; ++j) {
+	// ブロックの行列を1つの配列（インスタンスバッファ）に並べ、ここで一度だけ転送する
+	// 映っている列だけを続けて描けるよう、列ごとに並べて各列の始まりを覚えておく
+	blockInstances_.Initialize(cubeModel_);
+	blockColumnOffsets_.clear();
+	uint32_t blockCount = 0;
+	for (uint32_t j = 0; j < numBlockHorizontal; ++j) {
+		blockColumnOffsets_.push_back(blockCount);
+		for (uint32_t i = 0; i < numBlockVirtical; ++i) {
 			if (mapChipField_->GetMapChipTypeByIndex(j, i) == MapChipType::kBlock) {
-				WorldTransform* worldTransform = new WorldTransform();
-				worldTransform->Initialize();
-				worldTransformBlocks_[i][j] = worldTransform;
-				worldTransformBlocks_[i][j]->translation_ = mapChipField_->GetMapChipPositionByIndex(j, i);
+				Matrix4x4 matWorld;
+				AffineMatrix::MakeTranslate(matWorld, ToVector3(mapChipField_->GetMapChipPositionByIndex(j, i)));
+				blockInstances_.Add(matWorld);
+				++blockCount;
 			}
 		}
 	}
+	blockColumnOffsets_.push_back(blockCount);
+	blockInstances_.Build();
 }
 
-void GameScene::CheckAllCollisions() {
-	AABB aabb1, aabb2;
-
-	if (player_->GetIsInvincible() == false) {
-		aabb1 = player_->GetAABB();
-
-		for (Enemy* enemy : enemies_) {
-			if (player_->GetIsAlive() && enemy->GetIsAlive()) {
-				aabb2 = enemy->GetAABB();
-				if (IsColliding(aabb1, aabb2)) {
-					player_->OnCollision(enemy->GetWorldTransform());
-					enemy->OnCollision(player_);
-				}
-			}
-		}
-
-		for (ChasingEnemy* enemy : chasingEnemies_) {
-			if (player_->GetIsAlive() && enemy->GetIsAlive()) {
-				aabb2 = enemy->GetAABB();
-				if (IsColliding(aabb1, aabb2)) {
-					player_->OnCollision(enemy->GetWorldTransform());
-					enemy->OnCollision(player_);
-				}
-			}
-		}
+void GameScene::SaveInputRecording() const {
+	if (inputRecording_.GetStepCount() == 0) {
+		return;
+	}
 
-		for (ShooterEnemy* enemy : shooterEnemies_) {
-			if (player_->GetIsAlive() && enemy->GetIsAlive()) {
-				aabb2 = enemy->GetAABB();
-				if (IsColliding(aabb1, aabb2)) {
-					player_->OnCollision(enemy->GetWorldTransform());
-					enemy->OnCollision(player_);
-				}
+	// Replays/stage1_20250101_120000.rep（状態ハッシュは .hash）のような名前で保存する
+	std::time_t now = std::time(nullptr);
+	std::tm localTime = {};
+	localtime_s(&localTime, &now);
+	char timeText[32] = {};
+	std::strftime(timeText, sizeof(timeText), "%Y%m%d_%H%M%S", &localTime);
 
-				const auto& projectiles = enemy->GetProjectiles();
-				for (const auto& projectile : projectiles) {
-					if (projectile->IsAlive()) {
-						aabb2 = projectile->GetAABB();
-						if (IsColliding(aabb1, aabb2)) {
-							player_->OnCollision(projectile->GetWorldTransform());
-							projectile->OnCollision();
-						}
-					}
-				}
-			}
-		}
+	std::filesystem::create_directories("Replays");
+	std::string basePath = "Replays/stage" + std::to_string(currentStageNo_) + "_" + timeText;
+	if (!inputRecording_.SaveToFile(basePath + ".rep")) {
+		OutputDebugStringA(("Error: 入力の記録を保存できませんでした: " + basePath + ".rep\n").c_str());
 	}
-
-	if (player_->GetIsAttacking() == true) {
-		aabb1 = player_->GetAABB();
-		for (Enemy* enemy : enemies_) {
-			aabb2 = enemy->GetAABB();
-			if (IsColliding(aabb1, aabb2)) {
-				enemy->SetIsAlive(false);
-			}
-		}
-		for (ChasingEnemy* enemy : chasingEnemies_) {
-			aabb2 = enemy->GetAABB();
-			if (IsColliding(aabb1, aabb2)) {
-				enemy->SetIsAlive(false);
-			}
-		}
-		for (ShooterEnemy* enemy : shooterEnemies_) {
-			aabb2 = enemy->GetAABB();
-			if (IsColliding(aabb1, aabb2)) {
-				enemy->SetIsAlive(false);
-			}
-		}
+	if (!hashLog_.SaveToFile(basePath + ".hash")) {
+		OutputDebugStringA(("Error: 状態ハッシュを保存できませんでした: " + basePath + ".hash\n").c_str());
 	}
+}
 
-	aabb1 = player_->GetAABB();
-	aabb2 = goal_->GetAABB();
-
-	// 修正: 死亡演出中や既に死亡状態のときはゴール判定を無視する
-	if (IsColliding(aabb1, aabb2)) {
-		if (phase_ == Phase::kPlay && player_->GetIsAlive() && !player_->GetIsDeadAnimating()) {
-			phase_ = Phase::kGoalAnimation;
-			player_->StartGoalAnimation();
-			// カメラ演出用タイマーのリセット
-			goalCameraTimer_ = 0.0f;
-		}
+bool GameScene::RollbackSimulation(uint32_t frame) {
+	if (!rollbackBuffer_.Load(frame, world_)) {
+		return false;
 	}
+	// 記録は Initialize からの通算ステップ数と同じ数だけ積んでいるので、そのまま同じフレームまで戻せる
+	inputRecording_.Truncate(frame);
+	hashLog_.Truncate(frame);
+	return true;
 }
 
-void GameScene::ChangePhase() {
-	switch (phase_) {
-	case Phase::kPlay:
-		if (!player_->GetIsAlive()) {
-			phase_ = Phase::kDeath;
-			deathParticles_->Start(player_->GetWorldPosition());
+void GameScene::ResimulateSimulation(const std::vector<SimInput>& inputs) {
+	bool isReset = false;
+	for (const SimInput& input : inputs) {
+		rollbackBuffer_.Save(world_);
+		simEvents_.clear();
+		world_.Step(input, simEvents_);
+		inputRecording_.Push(input);
+		if (kSaveInputRecording) {
+			hashLog_.Push(world_.ComputeStateHash());
 		}
-		break;
-	case Phase::kDeath:
-		break;
+		isReset |= std::any_of(simEvents_.begin(), simEvents_.end(), [](const SimEvent& event) { return event.type == SimEventType::kReset; });
 	}
+	simEvents_.clear();
+
+	// 敵の数が変わっている可能性があるので、リセットをまたいだときは表示側を作り直す
+	if (isReset) {
+		ResetViews();
+	}
+	// 補間は進め直した後の状態から始める
+	SavePreviousViewStates();
 }
 
 GameScene::~GameScene() {
-	for (std::vector<WorldTransform*>& worldTransformBlockLine : worldTransformBlocks_) {
-		for (WorldTransform* worldTransformBlock : worldTransformBlockLine) {
-			delete worldTransformBlock;
-		}
+	if (kSaveInputRecording) {
+		SaveInputRecording();
 	}
 
 	delete clearModel_;
@@ -863,17 +703,8 @@ GameScene::~GameScene() {
 	if (shooterEnemyModel_ && shooterEnemyModel_ != enemyModel_) {
 		delete shooterEnemyModel_;
 	}
-	for (Enemy* enemy : enemies_) {
-		delete enemy;
-	}
-	for (ChasingEnemy* enemy : chasingEnemies_) {
-		delete enemy;
-	}
-	for (ShooterEnemy* enemy : shooterEnemies_) {
-		delete enemy;
-	}
-
 	delete player_;
+	delete projectileView_;
 	delete goal_;
 	delete skydome_;
 	delete debugCamera_;
@@ -1,12 +1,19 @@
 #pragma once
 #include "Effects/Fade.h"
 #include "KamataEngine.h"
-#include <list>
+#include "Objects/EnemyView.h"
+#include "Render/ModelInstances.h"
+#include "Render/RenderSnapshot.h"
+#include "Sim/InputRecording.h"
+#include "Sim/SimRollback.h"
+#include "Sim/SimStateHash.h"
+#include "Sim/SimWorld.h"
+#include "Utils/ViewCulling.h"
+#include "Utils/WorldTransformBatch.h"
+#include <vector>
 
 class Player;
-class Enemy;
-class ChasingEnemy;
-class ShooterEnemy;
+class ProjectileView;
 class Skydome;
 class MapChipField;
 class CameraController;
@@ -33,17 +40,6 @@ private:
 	// カメラの目標角度 Z軸
 	float cameraTargetAngleZ_ = 0.0f;
 
-	// kStageStart
-	enum class Phase {
-		kStageStart, // ステージ開始（暗転・番号表示）
-		kFadeIn,     // フェードイン
-		kPlay,       // ゲームプレイ
-		kGoalAnimation,
-		kDeath,      // デス演出
-		kDeathFadeOut,
-		kFadeOut, // フェードアウト
-	};
-
 	// テクスチャハンドル
 	uint32_t uvCheckerTextureHandle_ = 0;
 	uint32_t playerTextureHandle_ = 0;
@@ -70,19 +66,43 @@ private:
 
 	KamataEngine::WorldTransform worldTransform_;
 	KamataEngine::Camera camera_;
-	std::vector<std::vector<KamataEngine::WorldTransform*>> worldTransformBlocks_;
+	// ステージのブロック（動かないので、行列は GenerateBlocks で一度だけ計算・転送する）
+	// 列ごとに並べ、映っている列の範囲だけを描く
+	ModelInstances blockInstances_;
+	// 各列の最初のブロックが blockInstances_ の何番目か（列の数 + 1 個。最後は全体の数）
+	std::vector<uint32_t> blockColumnOffsets_;
 	KamataEngine::DebugCamera* debugCamera_ = nullptr;
 	bool isDebugCameraActive_ = false;
 
-	// 色変更オブジェクト
-	KamataEngine::ObjectColor objectColorClear_;
-	// 色の数値
+	// クリア文字の色（描画時に ObjectColor へ反映される）
 	KamataEngine::Vector4 colorClear_;
 
+	// ゲームの挙動（エンジンに依存しないシミュレーション）
+	SimWorld world_;
+	// このステップでシミュレーションが発行したイベント
+	std::vector<SimEvent> simEvents_;
+	// まだシミュレーションに渡していない「押した瞬間」の入力（SimInput::triggered と同じビット）
+	uint8_t pendingTriggers_ = 0;
+
+	// シミュレーションに渡した入力の記録（リプレイ用）
+	InputRecording inputRecording_;
+	// 各ステップ後の状態ハッシュ（ヘッドレス再生と結果が一致するかの確認用）
+	SimHashLog hashLog_;
+	// 直近のステップを進める前の状態（ロールバック用）
+	SimRollbackBuffer rollbackBuffer_;
+	// 記録をシーン終了時に Replays フォルダへ保存するか（保存する場合は状態ハッシュも取る）
+#ifdef _DEBUG
+	static inline const bool kSaveInputRecording = true;
+#else
+	static inline const bool kSaveInputRecording = false;
+#endif
+
+	// 表示側（シミュレーションの状態を描画する）
 	Player* player_ = nullptr;
-	std::list<Enemy*> enemies_;
-	std::list<ChasingEnemy*> chasingEnemies_;
-	std::list<ShooterEnemy*> shooterEnemies_;
+	std::vector<EnemyView> enemyViews_;
+	std::vector<EnemyView> chasingEnemyViews_;
+	std::vector<EnemyView> shooterEnemyViews_;
+	ProjectileView* projectileView_ = nullptr;
 	Skydome* skydome_ = nullptr;
 	MapChipField* mapChipField_;
 	CameraController* cameraController_ = nullptr;
@@ -92,27 +112,11 @@ private:
 	bool isGoal_ = false;
 
 	Fade* fade_ = nullptr;
-	Phase phase_ = {};
 	bool finished_ = false;
 
 	HUD* HUD_ = nullptr;
 	UI* UI_ = nullptr;
 
-	uint32_t jHandle_;
-	KamataEngine::Sprite* jSprite_ = {};
-	uint32_t spaceHandle_;
-	KamataEngine::Sprite* spaceSprite_ = {};
-	uint32_t escHandle_;
-	KamataEngine::Sprite* escSprite_ = nullptr;
-
-	// --- controller UI (追加) ---
-	uint32_t aHandle_ = 0;
-	KamataEngine::Sprite* aSprite_ = nullptr;
-	uint32_t xHandle_ = 0;
-	KamataEngine::Sprite* xSprite_ = nullptr;
-	uint32_t selectHandle_ = 0;
-	KamataEngine::Sprite* selectSprite_ = nullptr;
-
 	// 最終入力デバイス（true = game-pad, false = keyboard）
 	bool lastInputIsGamepad_ = false;
 	// スティック検出閾値
@@ -125,23 +129,95 @@ private:
 
 	// 現在のステージ番号
 	int currentStageNo_ = 1;
-	// ステージ開始時のタイマー
-	float stageStartTimer_ = 0.0f;
 
 	// ゴール演出中のカメラ用タイマー
 	float goalCameraTimer_ = 0.0f;
 
-	void CheckAllCollisions();
-	void ChangePhase();
-	void Reset();
+	// --- 並列更新（JobSystem）の分割単位 ---
+	// 敵の姿勢の補間
+	static inline const uint32_t kEntityGrainSize = 16;
+
+	// --- 画面外の物を描画・更新から外す（カリング） ---
+	// カメラに映る範囲（SyncViews でカメラを動かした直後に求める）
+	ViewCulling::Rect visibleRect_ = ViewCulling::Rect::Infinite();
+	// 映っているマップチップの範囲
+	ViewCulling::TileRange visibleTiles_ = {};
+	// 映る範囲を求める奥行き・敵の余白は StageDraw（ベンチと同じ判定を使う）
+
+	// 同期描画（Draw）用のスナップショット
+	RenderSnapshot snapshot_;
+
+	// 毎フレーム動くもののワールド変換（SyncViews で行列をまとめて計算する）
+	WorldTransformBatch dynamicTransformBatch_;
+
+	/// <summary>
+	/// キーボード・ゲームパッドの状態からシミュレーションへの入力を作る
+	/// </summary>
+	SimInput MakeSimInput() const;
+
+	/// <summary>
+	/// 入力の記録と状態ハッシュを Replays フォルダへ保存する
+	/// </summary>
+	void SaveInputRecording() const;
+
+	/// <summary>
+	/// シミュレーションのリセットに合わせて表示側（敵・カメラ・フェードなど）を作り直す
+	/// </summary>
+	void ResetViews();
+
+	/// <summary>
+	/// 描画時の補間の始点として、表示側に現在のシミュレーションの状態を保存させる
+	/// </summary>
+	void SavePreviousViewStates();
+
+	/// <summary>
+	/// シミュレーションの状態を表示側のワールド変換へ反映する
+	/// </summary>
+	/// <param name="alpha">直前のステップから現在のステップへの補間係数 [0, 1]</param>
+	void SyncViews(float alpha);
+
+	/// <summary>
+	/// プレイヤーを追うカメラ（またはデバッグカメラ）の行列を更新し、映る範囲を求め直す
+	/// </summary>
+	void UpdateCamera();
+
+	/// <summary>
+	/// フェーズごとの演出（カメラ・フェード・パーティクル）を1ステップ分更新する
+	/// </summary>
+	void UpdatePhaseEffects(SimPhase phase);
+
+	/// <summary>
+	/// シミュレーションが発行したイベントに応じて音や演出を開始する
+	/// </summary>
+	void HandleSimEvents();
 
 public:
 	void Initialize(int stageNo = 1);
 	void Update();
 	void Draw();
+	/// <summary>
+	/// 現在のフレームの描画内容をスナップショットへ記録する
+	/// エンジンの描画オブジェクトには触れないので、更新スレッドから呼んでよい
+	/// </summary>
+	void BuildSnapshot(RenderSnapshot& snapshot);
 	void GenerateBlocks();
 	~GameScene();
 
+	/// <summary>
+	/// シミュレーションを、指定したフレームを進める前の状態へ巻き戻す（オンライン対戦のロールバック用）
+	/// 直近 SimRollbackBuffer::kMaxRollbackFrames フレームまで戻せる。入力の記録と状態ハッシュも同じフレームまで戻す
+	/// </summary>
+	/// <returns>古すぎて戻せないときは false（状態は変えない）</returns>
+	bool RollbackSimulation(uint32_t frame);
+
+	/// <summary>
+	/// 巻き戻した状態から、与えた入力で1ステップずつ進め直す（イベントは捨て、演出・音は鳴らさない）
+	/// </summary>
+	void ResimulateSimulation(const std::vector<SimInput>& inputs);
+
+	// 次に進めるシミュレーションのフレーム（ステージ開始からの通算ステップ数）
+	uint32_t GetSimulationFrame() const { return world_.GetFrameCount(); }
+
 	bool GetIsFinished() const { return finished_; }
 	void SetIsFinished(bool finished) { finished_ = finished; }
 };
\ No newline at end of file
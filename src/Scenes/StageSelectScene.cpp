@@ -1,6 +1,8 @@
 #include "StageSelectScene.h"
 #include "Effects/Fade.h"
 #include "Effects/Skydome.h" // Skydomeクラスを使うために必要
+#include "Render/SnapshotRenderer.h"
+#include "Render/UiAtlas.h"
 #include "StageData.h"
 #include "System/Gamepad.h"
 #include "Utils/TransformUpdater.h" // WorldTransformの更新に必要
@@ -23,7 +25,6 @@ void StageSelectScene::Initialize() {
 	crownModel_ = Model::CreateFromOBJ("crown", true); // crown フォルダを用意
 	crownTransform_.Initialize();
 
-	objectColorCrown_.Initialize();
 	crownTransform_.scale_ = {2.0f, 2.0f, 2.0f};
 	colorCrown_ = {50.0f, 50.0f, 0.0f, 1.0f};
 
@@ -31,18 +32,8 @@ void StageSelectScene::Initialize() {
 	uint32_t skydomeTexture = TextureManager::Load("skydome/AL_skysphere.png");
 
 	// ESC スプライト用テクスチャをロード（キーボード用）
-	escHandle_ = TextureManager::GetInstance()->Load("HUD/esc.png");
-	escSprite_ = Sprite::Create(escHandle_, {64, 128});
-	if (escSprite_) {
-		escSprite_->SetSize({144, 64});
-	}
-
-	// コントローラ用 select スプライトをロード
-	selectHandle_ = TextureManager::GetInstance()->Load("HUD/select.png");
-	selectSprite_ = Sprite::Create(selectHandle_, {64, 128});
-	if (selectSprite_) {
-		selectSprite_->SetSize({64, 64});
-	}
+	// ESC（キーボード用）・select（コントローラ用）の表示は UiAtlas の領域
+	UiAtlas::GetInstance()->Load();
 
 	// --- 3Dオブジェクトの生成 ---
 	// 背景天球
@@ -272,10 +263,8 @@ void StageSelectScene::Update() {
 	// 全てのWorldTransformの行列を更新 (変更なし)
 	for (WorldTransform* transform : stageCubeTransforms_) {
 		TransformUpdater::WorldTransformUpdate(*transform);
-		transform->TransferMatrix();
 	}
 	TransformUpdater::WorldTransformUpdate(*cursorTransform_);
-	cursorTransform_->TransferMatrix();
 
 	skydome_->Update();
 	camera_.UpdateMatrix();
@@ -294,83 +283,50 @@ void StageSelectScene::Update() {
 
 	// 行列更新
 	TransformUpdater::WorldTransformUpdate(crownTransform_);
-	crownTransform_.TransferMatrix();
-	objectColorCrown_.SetColor(colorCrown_);
 }
 
 void StageSelectScene::Draw() {
-	KamataEngine::DirectXCommon* dxCommon = KamataEngine::DirectXCommon::GetInstance();
-
-	// 3Dモデル描画の開始
-	Model::PreDraw(dxCommon->GetCommandList());
+	snapshot_.Clear();
+	snapshot_.SetCamera(camera_);
 
 	// 天球の描画
-	skydome_->Draw();
+	skydome_->Draw(snapshot_);
 
-	// 3Dモデル描画の終了
-	Model::PostDraw();
-	// ステージ選択肢の描画
+	// ステージ選択肢の描画（同じモデルなので Sort で続けて描かれる）
 	for (int i = 0; i < maxStages_; ++i) {
-		// 3Dモデル描画の開始
-		Model::PreDraw(dxCommon->GetCommandList());
-		// i番目のTransformを取得
-		WorldTransform* transform = stageCubeTransforms_[i];
-		// i番目のテクスチャハンドルを取得
-		uint32_t textureHandle = stageCubeTextureHandles_[i];
-
-		// 取得したTransformとテクスチャハンドルを使って描画
-		stageCubeModel_->Draw(*transform, camera_, textureHandle);
-
-		cursorModel_->Draw(*cursorTransform_, camera_);
-
-		// クリア済みなら王冠を描画
-		if (StageData::isCleared[selectedStageIndex_]) {
-			if (crownModel_) {
-				crownModel_->Draw(crownTransform_, camera_, &objectColorCrown_);
-			}
-		}
-		// 3Dモデル描画の終了
-		Model::PostDraw();
+		snapshot_.AddModel(stageCubeModel_, *stageCubeTransforms_[i], stageCubeTextureHandles_[i]);
 	}
-	// 3Dモデル描画の開始
-	Model::PreDraw(dxCommon->GetCommandList());
 
 	// カーソルの描画
-	cursorModel_->Draw(*cursorTransform_, camera_);
+	snapshot_.AddModel(cursorModel_, *cursorTransform_);
 
-	// フェードの描画 (必ず一番最後に描画する)
-	fade_->Draw();
+	// クリア済みなら王冠を描画
+	if (StageData::isCleared[selectedStageIndex_] && crownModel_) {
+		snapshot_.AddColoredModel(crownModel_, crownTransform_, colorCrown_);
+	}
 
-	// 3Dモデル描画の終了
-	Model::PostDraw();
+	// フェードの描画 (必ず一番最後に描画する)
+	fade_->Draw(snapshot_);
 
 	// ESC / SELECT スプライトの暗転判定（キーボードは esc.png、コントローラは select.png）
-	Sprite::PreDraw(dxCommon->GetCommandList());
-	{
-		if (gpActive_ && selectSprite_) {
-			// コントローラ用 select 表示 (暗転は START/BACK 押下で反映)
-			Gamepad* gp = Gamepad::GetInstance();
-			if (gp && (gp->IsPressed(XINPUT_GAMEPAD_BACK) || gp->IsPressed(XINPUT_GAMEPAD_START))) {
-				selectSprite_->SetColor({0.5f, 0.5f, 0.5f, 1.0f});
-			} else {
-				selectSprite_->SetColor({1.0f, 1.0f, 1.0f, 1.0f});
-			}
-			selectSprite_->SetPosition({64, 128});
-			selectSprite_->Draw();
-		} else if (escSprite_) {
-			// キーボード用 esc 表示（既存）
-			if (Input::GetInstance()->PushKey(DIK_ESCAPE)) {
-				escSprite_->SetColor({0.5f, 0.5f, 0.5f, 1.0f});
-			} else {
-				escSprite_->SetColor({1.0f, 1.0f, 1.0f, 1.0f});
-			}
-			escSprite_->SetPosition({64, 128});
-			escSprite_->Draw();
-		}
+	const Vector4 pressedColor = {0.5f, 0.5f, 0.5f, 1.0f};
+	const Vector4 releasedColor = {1.0f, 1.0f, 1.0f, 1.0f};
+	if (gpActive_) {
+		// コントローラ用 select 表示 (暗転は START/BACK 押下で反映)
+		Gamepad* gp = Gamepad::GetInstance();
+		bool isPressed = gp && (gp->IsPressed(XINPUT_GAMEPAD_BACK) || gp->IsPressed(XINPUT_GAMEPAD_START));
+		snapshot_.AddSprite(UiAtlas::GetInstance()->Get(UiAtlas::Region::kButtonSelect), {64, 128}, isPressed ? pressedColor : releasedColor);
+	} else {
+		// キーボード用 esc 表示（既存）
+		snapshot_.AddSprite(UiAtlas::GetInstance()->Get(UiAtlas::Region::kKeyEsc), {64, 128}, Input::GetInstance()->PushKey(DIK_ESCAPE) ? pressedColor : releasedColor);
 	}
-	Sprite::PostDraw();
+
+	// PreDraw/PostDraw はモデルとスプライトで1回ずつにする
+	snapshot_.Sort();
+	SnapshotRenderer::GetInstance()->Execute(snapshot_);
 }
 
+
 StageSelectScene::~StageSelectScene() {
 	// モデルの解放
 	delete skydomeModel_;
@@ -388,7 +344,7 @@ StageSelectScene::~StageSelectScene() {
 	// フェードの解放
 	delete fade_;
 
-	// Sprite オブジェクトはエンジン側で管理される実装の可能性が高いため明示削除は行わない（GameScene の実装に合わせる）
+	// スプライトは SnapshotRenderer がまとめて持つので、ここで解放する物は無い
 
 	if (!returnToTitle_) {
 		KamataEngine::Audio::GetInstance()->StopWave(SoundData::bgmVoiceHandle);
@@ -1,5 +1,6 @@
 #pragma once
 #include "KamataEngine.h"
+#include "Render/RenderSnapshot.h"
 #include <vector>
 
 // 前方宣言
@@ -17,6 +18,9 @@ private:
 
 	KamataEngine::Camera camera_;
 
+	// 描画内容（Draw で記録し、SnapshotRenderer でまとめて描く）
+	RenderSnapshot snapshot_;
+
 	// --- 3Dモデル ---
 	KamataEngine::Model* skydomeModel_ = nullptr;
 	KamataEngine::Model* stageCubeModel_ = nullptr;
@@ -24,9 +28,7 @@ private:
 	KamataEngine::Model* crownModel_ = nullptr;
 	KamataEngine::WorldTransform crownTransform_;
 
-	// 色変更オブジェクト
-	KamataEngine::ObjectColor objectColorCrown_;
-	// 色の数値
+	// 王冠の色（描画時に ObjectColor へ反映される）
 	KamataEngine::Vector4 colorCrown_;
 
 	// --- 3Dオブジェクト ---
@@ -61,13 +63,6 @@ private:
 	// 終了フラグ
 	bool finished_ = false;
 
-	// ESC スプライト用 (キーボード)
-	uint32_t escHandle_ = 0;
-	KamataEngine::Sprite* escSprite_ = nullptr;
-	// コントローラ用の select スプライト
-	uint32_t selectHandle_ = 0;
-	KamataEngine::Sprite* selectSprite_ = nullptr;
-
 	bool returnToTitle_ = false; // true の場合、タイトルへ戻る
 
 	std::vector<uint32_t> stageCubeTextureHandles_;
@@ -3,6 +3,7 @@
 
 #include "Scenes/TitleScene.h"
 #include "Effects/Skydome.h"
+#include "Render/SnapshotRenderer.h"
 #include "Utils/TransformUpdater.h"
 #include <cmath>
 // std::minなどは使わず math.h の関数を使うため include は最小限
@@ -94,7 +95,6 @@ void TitleScene::Initialize() {
 	fade_ = new Fade();
 	fade_->Initialize();
 
-	objectColorTitle_.Initialize();
 	colorTitle_ = {0.14f, 1.0f, 0.6f, 1.0f};
 
 	phase_ = Phase::kFadeIn;
@@ -239,21 +239,17 @@ void TitleScene::Update() {
 
 	skydome_->Update();
 	camera_.UpdateMatrix();
-	objectColorTitle_.SetColor(colorTitle_);
 }
 
 // 描画処理
 void TitleScene::Draw() {
-	KamataEngine::DirectXCommon* dxCommon = KamataEngine::DirectXCommon::GetInstance();
+	snapshot_.Clear();
+	snapshot_.SetCamera(camera_);
 
-	KamataEngine::Model::PreDraw(dxCommon->GetCommandList());
-	skydome_->Draw();
-	KamataEngine::Model::PostDraw();
+	skydome_->Draw(snapshot_);
 
-	KamataEngine::Model::PreDraw(dxCommon->GetCommandList());
-
-	modelTitle_->Draw(worldTransformTitle_, camera_, &objectColorTitle_);
-	modelPlayer_->Draw(worldTransformPlayer_, camera_);
+	snapshot_.AddColoredModel(modelTitle_, worldTransformTitle_, colorTitle_);
+	snapshot_.AddModel(modelPlayer_, worldTransformPlayer_);
 
 	// 敵の描画（4体分）
 	for (int i = 0; i < 4; ++i) {
@@ -267,10 +263,12 @@ void TitleScene::Draw() {
 		if (i == 3)
 			currentModel = modelShooterEnemy_; // 4体目もShooter（または通常）
 
-		currentModel->Draw(worldTransformEnemies_[i], camera_);
+		snapshot_.AddModel(currentModel, worldTransformEnemies_[i]);
 	}
 
-	KamataEngine::Model::PostDraw();
+	fade_->Draw(snapshot_);
 
-	fade_->Draw();
-}
\ No newline at end of file
+	// 同じモデルの敵をまとめ、PreDraw/PostDraw はモデルとスプライトで1回ずつにする
+	snapshot_.Sort();
+	SnapshotRenderer::GetInstance()->Execute(snapshot_);
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include "Effects/Fade.h"
 #include "KamataEngine.h"
+#include "Render/RenderSnapshot.h"
 #include <vector>
 
 class Skydome;
@@ -27,9 +28,7 @@ private:
 
 	uint32_t skydomeTextureHandle_ = 0;
 
-	// 色変更オブジェクト
-	KamataEngine::ObjectColor objectColorTitle_;
-	// 色の数値
+	// タイトル文字の色（描画時に ObjectColor へ反映される）
 	KamataEngine::Vector4 colorTitle_;
 
 	// ワールド変換データ
@@ -48,6 +47,9 @@ private:
 	// カメラ
 	KamataEngine::Camera camera_;
 
+	// 描画内容（Draw で記録し、SnapshotRenderer でまとめて描く）
+	RenderSnapshot snapshot_;
+
 	// アニメーション用の角度
 	float viewAngle_ = 0.0f;
 
@@ -0,0 +1,137 @@
+#include "Sim/InputRecording.h"
+#include <fstream>
+#include <iterator>
+
+namespace {
+
+// 7ビットずつ下位から書き出す（最上位ビットが立っていれば続きがある）
+void WriteVarint(std::vector<uint8_t>& bytes, uint64_t value) {
+	while (value >= 0x80) {
+		bytes.push_back(static_cast<uint8_t>(value | 0x80));
+		value >>= 7;
+	}
+	bytes.push_back(static_cast<uint8_t>(value));
+}
+
+bool ReadVarint(const std::vector<uint8_t>& bytes, size_t& offset, uint64_t& value) {
+	value = 0;
+	for (uint32_t shift = 0; shift < 64; shift += 7) {
+		if (offset >= bytes.size()) {
+			return false;
+		}
+		uint8_t byte = bytes[offset++];
+		value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+		if ((byte & 0x80) == 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// held を下位8ビット、triggered を上位8ビットに詰める（triggered が無ければ varint で1バイトになる）
+uint32_t Pack(const SimInput& input) { return static_cast<uint32_t>(input.held) | (static_cast<uint32_t>(input.triggered) << 8); }
+
+SimInput Unpack(uint32_t packed) {
+	SimInput input;
+	input.held = static_cast<uint8_t>(packed & 0xFF);
+	input.triggered = static_cast<uint8_t>((packed >> 8) & 0xFF);
+	return input;
+}
+
+} // namespace
+
+void InputRecording::Start(int stageNo) {
+	stageNo_ = stageNo;
+	inputs_.clear();
+}
+
+std::vector<uint8_t> InputRecording::Serialize() const {
+	std::vector<uint8_t> bytes;
+
+	// --- ヘッダ ---
+	for (uint32_t i = 0; i < 4; ++i) {
+		bytes.push_back(static_cast<uint8_t>(kMagic >> (i * 8)));
+	}
+	WriteVarint(bytes, kVersion);
+	WriteVarint(bytes, static_cast<uint64_t>(stageNo_));
+	WriteVarint(bytes, inputs_.size());
+
+	// --- 本体（ランレングス） ---
+	size_t i = 0;
+	while (i < inputs_.size()) {
+		size_t runEnd = i + 1;
+		while (runEnd < inputs_.size() && inputs_[runEnd] == inputs_[i]) {
+			++runEnd;
+		}
+		WriteVarint(bytes, runEnd - i);
+		WriteVarint(bytes, Pack(inputs_[i]));
+		i = runEnd;
+	}
+	return bytes;
+}
+
+bool InputRecording::Deserialize(const std::vector<uint8_t>& bytes) {
+	inputs_.clear();
+
+	// --- ヘッダ ---
+	if (bytes.size() < 4) {
+		return false;
+	}
+	uint32_t magic = 0;
+	for (uint32_t i = 0; i < 4; ++i) {
+		magic |= static_cast<uint32_t>(bytes[i]) << (i * 8);
+	}
+	if (magic != kMagic) {
+		return false;
+	}
+
+	size_t offset = 4;
+	uint64_t version = 0;
+	uint64_t stageNo = 0;
+	uint64_t stepCount = 0;
+	if (!ReadVarint(bytes, offset, version) || version != kVersion) {
+		return false;
+	}
+	if (!ReadVarint(bytes, offset, stageNo) || !ReadVarint(bytes, offset, stepCount) || stepCount > kMaxStepCount) {
+		return false;
+	}
+	stageNo_ = static_cast<int>(stageNo);
+
+	// --- 本体 ---
+	// 連続回数があるので、ヘッダのステップ数は残りの長さからは決まらない。先に確保せず、読みながら増やす
+	while (inputs_.size() < stepCount) {
+		uint64_t runLength = 0;
+		uint64_t packed = 0;
+		if (!ReadVarint(bytes, offset, runLength) || !ReadVarint(bytes, offset, packed) || runLength == 0 || inputs_.size() + runLength > stepCount) {
+			inputs_.clear();
+			return false;
+		}
+		inputs_.insert(inputs_.end(), static_cast<size_t>(runLength), Unpack(static_cast<uint32_t>(packed)));
+	}
+	// 最後の組の後ろに余りがあれば壊れている
+	if (offset != bytes.size()) {
+		inputs_.clear();
+		return false;
+	}
+	return true;
+}
+
+bool InputRecording::SaveToFile(const std::string& filePath) const {
+	std::ofstream file(filePath, std::ios::binary);
+	if (!file.is_open()) {
+		return false;
+	}
+	std::vector<uint8_t> bytes = Serialize();
+	file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+	return file.good();
+}
+
+bool InputRecording::LoadFromFile(const std::string& filePath) {
+	std::ifstream file(filePath, std::ios::binary);
+	if (!file.is_open()) {
+		inputs_.clear();
+		return false;
+	}
+	std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	return Deserialize(bytes);
+}
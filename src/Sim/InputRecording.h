@@ -0,0 +1,67 @@
+#pragma once
+#include "Sim/SimInput.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// 1プレイ分の入力の記録（1ステップにつき1件の SimInput）
+/// ファイルにはヘッダ（識別子・バージョン・ステージ番号・ステップ数）の後に、
+/// 「同じ入力が続いた回数」と「held / triggered を詰めた値」の組を varint で並べて保存する
+/// </summary>
+class InputRecording {
+public:
+	// ファイルの識別子 "AL4R"
+	static inline const uint32_t kMagic = 0x52344C41;
+	// 形式のバージョン（形式を変えたら上げる）
+	static inline const uint32_t kVersion = 1;
+	// 読み込めるステップ数の上限（60 ステップ/秒で約 77 時間。壊れたファイルで大きな領域を確保しないため）
+	static inline const uint64_t kMaxStepCount = 1ull << 24;
+
+	/// <summary>
+	/// 記録を空にして新しく開始する
+	/// </summary>
+	void Start(int stageNo);
+
+	/// <summary>
+	/// 1ステップ分の入力を追加する
+	/// </summary>
+	void Push(const SimInput& input) { inputs_.push_back(input); }
+
+	/// <summary>
+	/// 先頭から stepCount ステップ分だけを残す（ロールバックで巻き戻したステップを取り消す）
+	/// </summary>
+	void Truncate(size_t stepCount) {
+		if (stepCount < inputs_.size()) {
+			inputs_.resize(stepCount);
+		}
+	}
+
+	/// <summary>
+	/// バイト列へ変換する
+	/// </summary>
+	std::vector<uint8_t> Serialize() const;
+
+	/// <summary>
+	/// バイト列から読み込む（形式が不正なら false を返し、中身は空になる）
+	/// </summary>
+	bool Deserialize(const std::vector<uint8_t>& bytes);
+
+	/// <summary>
+	/// ファイルへ保存する
+	/// </summary>
+	bool SaveToFile(const std::string& filePath) const;
+
+	/// <summary>
+	/// ファイルから読み込む
+	/// </summary>
+	bool LoadFromFile(const std::string& filePath);
+
+	int GetStageNo() const { return stageNo_; }
+	const std::vector<SimInput>& GetInputs() const { return inputs_; }
+	size_t GetStepCount() const { return inputs_.size(); }
+
+private:
+	int stageNo_ = 1;
+	std::vector<SimInput> inputs_;
+};
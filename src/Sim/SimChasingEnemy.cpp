@@ -0,0 +1,138 @@
+#include "Sim/SimChasingEnemy.h"
+#include "System/GameTime.h"
+#include "Utils/Easing.h"
+#include "Utils/FastMath.h"
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace {
+// 追尾する敵のチューニング値
+constexpr const EnemyArchetype& kArchetype = EnemyArchetypes::kChaser;
+} // namespace
+
+void SimChasingEnemy::Initialize(const SimVector3& position) {
+	hot_ = EnemyHotState{};
+	hot_.translation = position;
+	hot_.rotationY = std::numbers::pi_v<float> / 2.0f;
+	hot_.scale = kArchetype.initialScale;
+	hot_.velocity = {-kArchetype.moveSpeed, 0.0f, 0.0f};
+	hot_.state = EnemyState::kAlive;
+}
+
+void SimChasingEnemy::Update(const SimVector3& targetPosition) {
+	if (hot_.state == EnemyState::kDead) return;
+
+	const float dt = GameTime::GetDeltaTime();
+	if (hot_.state == EnemyState::kDying) {
+		float total = kArchetype.deathSpinDuration + kArchetype.deathShrinkDuration;
+		hot_.deathTimer += dt;
+		if (hot_.deathTimer < kArchetype.deathSpinDuration) {
+			hot_.rotationY += kArchetype.deathSpinSpeed * dt;
+		} else {
+			// 小さくなる瞬間のSE！（イベントへの変換は TakeDeathSoundRequest で行う）
+			if (hot_.deathTimer - dt < kArchetype.deathSpinDuration) {
+				hot_.deathSoundRequested = true;
+			}
+			float shrinkElapsed = hot_.deathTimer - kArchetype.deathSpinDuration;
+			float t = std::clamp(shrinkElapsed / kArchetype.deathShrinkDuration, 0.0f, 1.0f);
+			hot_.scale = (1.0f - t) * kArchetype.initialScale;
+		}
+		if (hot_.deathTimer >= total) hot_.state = EnemyState::kDead;
+		return;
+	}
+
+	// 1. まずデフォルトの速度（パトロール）を設定
+	SimReal desiredX = (hot_.lrDirection == EnemyLRDirection::kLeft) ? -kArchetype.moveSpeed : kArchetype.moveSpeed;
+	SimReal desiredY = 0.0f; // Y軸のデフォルト速度は0
+
+	// 2. プレイヤーが範囲内か検知する（★onGroundに関係なく実行）
+	SimVector3 myPos = GetWorldPosition();
+	const SimVector3& pPos = targetPosition;
+	SimReal dx = pPos.x - myPos.x;
+	SimReal dy = pPos.y - myPos.y;
+
+	// 簡易検出（距離矩形）
+	if (Abs(dx) <= kArchetype.detectRange && Abs(dy) <= kArchetype.detectRange) {
+		// 追尾速度と向きを設定
+		desiredX = (dx > 0.0f) ? kArchetype.chaseSpeed : -kArchetype.chaseSpeed;
+		EnemyLRDirection nd = (dx > 0.0f) ? EnemyLRDirection::kRight : EnemyLRDirection::kLeft;
+		if (nd != hot_.lrDirection && hot_.turnTimer >= 1.0f) {
+			hot_.lrDirection = nd;
+			hot_.turnFirstRotationY = hot_.rotationY;
+			hot_.turnTimer = 0.0f;
+		}
+		//   (dx, dy) というベクトルを求める
+		SimReal length = Sqrt(dx * dx + dy * dy);
+
+		// ゼロ除算を避けつつ、正規化して chaseSpeed を掛ける
+		if (length > 0.001f) {
+			SimReal invLength = 1.0f / length;
+			desiredX = (dx * invLength) * kArchetype.chaseSpeed;
+			desiredY = (dy * invLength) * kArchetype.chaseSpeed;
+		} else {
+			// プレイヤーと重なっている場合は停止
+			desiredX = 0.0f;
+			desiredY = 0.0f;
+		}
+	}
+
+	// 3. 速度を決定
+	hot_.velocity.x = desiredX;
+	hot_.velocity.y = desiredY; // ★Y軸の速度を反映
+	hot_.velocity.z = 0;
+
+	// 4. 速度を座標に反映する (★前回の修正点)
+	hot_.translation.x += hot_.velocity.x;
+	hot_.translation.y += hot_.velocity.y; // ★Y軸の座標を更新
+	hot_.translation.z += hot_.velocity.z;
+
+	// 歩行アニメーション
+	hot_.walkTimer += dt;
+	float timeInCycle = std::fmod(hot_.walkTimer, kArchetype.walkMotionTime);
+	float progress = timeInCycle / kArchetype.walkMotionTime;
+	float sinArg = progress * 2.0f * std::numbers::pi_v<float>;
+	float r = (FastMath::Sin(sinArg) + 1.0f) / 2.0f;
+	hot_.rotationX = (1.0f - r) * kArchetype.walkMotionAngleStart + r * kArchetype.walkMotionAngleEnd;
+
+	// 旋回補間
+	if (hot_.turnTimer < 1.0f) {
+		hot_.turnTimer += GameTime::GetDeltaTime() / kArchetype.timeTurn;
+		hot_.turnTimer = std::fminf(hot_.turnTimer, 1.0f);
+		float destTable[] = { std::numbers::pi_v<float> * 0.5f, std::numbers::pi_v<float> * 1.5f };
+		float dest = destTable[static_cast<uint32_t>(hot_.lrDirection)];
+		hot_.rotationY = Lerp(hot_.turnFirstRotationY, dest, hot_.turnTimer);
+	}
+}
+
+bool SimChasingEnemy::TakeDeathSoundRequest() {
+	if (!hot_.deathSoundRequested) return false;
+	hot_.deathSoundRequested = false;
+	return true;
+}
+
+SimVector3 SimChasingEnemy::GetWorldPosition() const {
+	return hot_.translation;
+}
+
+AABB SimChasingEnemy::GetAABB() const {
+	SimVector3 w = GetWorldPosition();
+	AABB a;
+	a.min = {w.x - (kArchetype.width / 2.0f), w.y - (kArchetype.height / 2.0f), w.z - (kArchetype.width / 2.0f)};
+	a.max = {w.x + (kArchetype.width / 2.0f), w.y + (kArchetype.height / 2.0f), w.z + (kArchetype.width / 2.0f)};
+	return a;
+}
+
+void SimChasingEnemy::SetIsAlive(bool isAlive) {
+	if (isAlive) {
+		hot_.state = EnemyState::kAlive;
+		hot_.deathTimer = 0.0f;
+		hot_.scale = kArchetype.initialScale;
+	} else {
+		if (hot_.state == EnemyState::kAlive) {
+			hot_.state = EnemyState::kDying;
+			hot_.deathTimer = 0.0f;
+			hot_.velocity = {0,0,0};
+		}
+	}
+}
\ No newline at end of file
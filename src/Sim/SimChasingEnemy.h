@@ -0,0 +1,32 @@
+#pragma once
+#include "Sim/SimEnemyData.h"
+#include "Sim/SimMath.h"
+#include "System/Collision.h"
+
+/// <summary>
+/// プレイヤーを追尾する敵のシミュレーション
+/// </summary>
+class SimChasingEnemy {
+private:
+	// 毎フレーム更新するデータ（ホット）
+	EnemyHotState hot_;
+
+	SimVector3 GetWorldPosition() const;
+
+public:
+	void Initialize(const SimVector3& position);
+	// targetPosition: 追尾対象（プレイヤー）の座標
+	void Update(const SimVector3& targetPosition);
+	// 更新中に要求された死亡SEを取り出す（並列更新の後、リスト順に呼ぶこと）
+	bool TakeDeathSoundRequest();
+
+	AABB GetAABB() const;
+
+	// 表示側へ渡すホットデータ
+	const EnemyHotState& GetHotState() const { return hot_; }
+	bool GetIsAlive() const { return hot_.state == EnemyState::kAlive; }
+	void SetIsAlive(bool isAlive);
+
+	// チューニング値
+	static const EnemyArchetype& GetArchetype() { return EnemyArchetypes::kChaser; }
+};
@@ -0,0 +1,319 @@
+#include "Sim/SimEnemy.h"
+#include "System/GameTime.h"
+#include "System/MapChipField.h"
+#include "Utils/Easing.h"
+#include "Utils/FastMath.h"
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <cmath>
+#include <numbers>
+
+namespace {
+// 歩行する敵のチューニング値
+constexpr const EnemyArchetype& kArchetype = EnemyArchetypes::kWalker;
+} // namespace
+
+SimVector3 SimEnemy::CornerPosition(const SimVector3 center, Corner corner) {
+	SimVector3 offsetTable[kNumCorner] = {
+	    {kArchetype.width / 2.0f,  -kArchetype.height / 2.0f, 0},
+        {-kArchetype.width / 2.0f, -kArchetype.height / 2.0f, 0},
+        {kArchetype.width / 2.0f,  kArchetype.height / 2.0f,  0},
+        {-kArchetype.width / 2.0f, kArchetype.height / 2.0f,  0}
+    };
+	return center + offsetTable[static_cast<uint32_t>(corner)];
+}
+
+void SimEnemy::MapCollisionUp(CollisionMapInfo& info) {
+	if (info.move.y <= 0) {
+		return;
+	}
+	std::array<SimVector3, kNumCorner> positionsNew;
+	for (uint32_t i = 0; i < positionsNew.size(); ++i) {
+		positionsNew[i] = CornerPosition(hot_.translation + info.move, static_cast<Corner>(i));
+	}
+	bool hit = false;
+	MapChipField::IndexSet indexSetImpactedBlock = {UINT32_MAX, UINT32_MAX};
+	MapChipField::IndexSet indexSetLeftTop = mapChipField_->GetMapChipIndexSetByPosition(positionsNew[kLeftTop]);
+	if (mapChipField_->GetMapChipTypeByIndex(indexSetLeftTop.xIndex, indexSetLeftTop.yIndex) == MapChipType::kBlock) {
+		hit = true;
+		indexSetImpactedBlock = indexSetLeftTop;
+	}
+	MapChipField::IndexSet indexSetRightTop = mapChipField_->GetMapChipIndexSetByPosition(positionsNew[kRightTop]);
+	if (mapChipField_->GetMapChipTypeByIndex(indexSetRightTop.xIndex, indexSetRightTop.yIndex) == MapChipType::kBlock) {
+		hit = true;
+		if (indexSetImpactedBlock.xIndex == UINT32_MAX) {
+			indexSetImpactedBlock = indexSetRightTop;
+		}
+	}
+	if (hit) {
+		info.isCeilingHit = true;
+		MapChipField::Rect blockRect = mapChipField_->GetRectByIndex(indexSetImpactedBlock.xIndex, indexSetImpactedBlock.yIndex);
+		SimReal targetPlayerCenterY = blockRect.bottom - kArchetype.height / 2.0f;
+		info.move.y = targetPlayerCenterY - hot_.translation.y;
+	}
+}
+
+void SimEnemy::MapCollisionDown(CollisionMapInfo& info) {
+	std::array<SimVector3, kNumCorner> positionsNew;
+	for (uint32_t i = 0; i < positionsNew.size(); ++i) {
+		positionsNew[i] = CornerPosition(hot_.translation + info.move, static_cast<Corner>(i));
+	}
+	bool hit = false;
+	MapChipField::IndexSet indexSetImpactedBlock = {UINT32_MAX, UINT32_MAX};
+	SimReal deepestPenetrationY = -FLT_MAX;
+	MapChipField::IndexSet indexSetLeftBottom = mapChipField_->GetMapChipIndexSetByPosition(positionsNew[kLeftBottom]);
+	if (mapChipField_->GetMapChipTypeByIndex(indexSetLeftBottom.xIndex, indexSetLeftBottom.yIndex) == MapChipType::kBlock) {
+		MapChipField::Rect blockRect = mapChipField_->GetRectByIndex(indexSetLeftBottom.xIndex, indexSetLeftBottom.yIndex);
+		if (positionsNew[kLeftBottom].y < blockRect.top) {
+			hit = true;
+			indexSetImpactedBlock = indexSetLeftBottom;
+			deepestPenetrationY = positionsNew[kLeftBottom].y;
+		}
+	}
+	MapChipField::IndexSet indexSetRightBottom = mapChipField_->GetMapChipIndexSetByPosition(positionsNew[kRightBottom]);
+	if (mapChipField_->GetMapChipTypeByIndex(indexSetRightBottom.xIndex, indexSetRightBottom.yIndex) == MapChipType::kBlock) {
+		MapChipField::Rect blockRect = mapChipField_->GetRectByIndex(indexSetRightBottom.xIndex, indexSetRightBottom.yIndex);
+		if (positionsNew[kRightBottom].y < blockRect.top) {
+			hit = true;
+			if (indexSetImpactedBlock.xIndex == UINT32_MAX || positionsNew[kRightBottom].y < deepestPenetrationY) {
+				indexSetImpactedBlock = indexSetRightBottom;
+			}
+		}
+	}
+	if (hit) {
+		info.isLanding = true;
+		MapChipField::Rect blockRect = mapChipField_->GetRectByIndex(indexSetImpactedBlock.xIndex, indexSetImpactedBlock.yIndex);
+		SimReal targetPlayerCenterY = blockRect.top + kArchetype.height / 2.0f;
+		info.move.y = targetPlayerCenterY - hot_.translation.y;
+	}
+}
+
+void SimEnemy::MapCollisionRight(CollisionMapInfo& info) {
+	if (info.move.x <= 0) {
+		return;
+	}
+	const SimReal checkHeight = kArchetype.height * 0.8f;
+	SimVector3 centerNew = hot_.translation + info.move;
+
+	// --- 1. 壁判定 (既存の処理) ---
+	SimVector3 rightTopCheck = centerNew + SimVector3{kArchetype.width / 2.0f, checkHeight / 2.0f, 0.0f};
+	SimVector3 rightBottomCheck = centerNew + SimVector3{kArchetype.width / 2.0f, -checkHeight / 2.0f, 0.0f};
+	MapChipField::IndexSet indexSetTop = mapChipField_->GetMapChipIndexSetByPosition(rightTopCheck);
+	MapChipField::IndexSet indexSetBottom = mapChipField_->GetMapChipIndexSetByPosition(rightBottomCheck);
+
+	if (((mapChipField_->GetMapChipTypeByIndex(indexSetTop.xIndex, indexSetTop.yIndex) == MapChipType::kBlock) ||
+	     (mapChipField_->GetMapChipTypeByIndex(indexSetBottom.xIndex, indexSetBottom.yIndex) == MapChipType::kBlock)) &&
+	    hot_.lrDirection == EnemyLRDirection::kRight) {
+
+		info.isWallContact = true;
+		MapChipField::IndexSet indexSet = (mapChipField_->GetMapChipTypeByIndex(indexSetTop.xIndex, indexSetTop.yIndex) == MapChipType::kBlock) ? indexSetTop : indexSetBottom;
+		MapChipField::Rect blockRect = mapChipField_->GetRectByIndex(indexSet.xIndex, indexSet.yIndex);
+		info.move.x = blockRect.left - kArchetype.width / 2.0f - hot_.translation.x;
+
+		// 壁に当たったらその時点で処理終了
+		return;
+	}
+
+	// --- 2. 崖判定  ---
+	// 右下のさらに少し下を調べる
+	SimVector3 rightFloorCheck = centerNew + SimVector3{kArchetype.width / 2.0f, -kArchetype.height / 2.0f - 0.2f, 0.0f};
+	MapChipField::IndexSet indexSetFloor = mapChipField_->GetMapChipIndexSetByPosition(rightFloorCheck);
+
+	// 足元がブロックでなければ（＝穴なら）壁と同じ扱いにする
+	if (mapChipField_->GetMapChipTypeByIndex(indexSetFloor.xIndex, indexSetFloor.yIndex) != MapChipType::kBlock) {
+		if (hot_.lrDirection == EnemyLRDirection::kRight) {
+			info.isWallContact = true; // これをtrueにするとUpdate内で反転処理が走る
+			info.move.x = 0.0f;        // 進ませない
+		}
+	}
+}
+
+void SimEnemy::MapCollisionLeft(CollisionMapInfo& info) {
+	if (info.move.x >= 0) {
+		return;
+	}
+	const SimReal checkHeight = kArchetype.height * 0.8f;
+	SimVector3 centerNew = hot_.translation + info.move;
+
+	// --- 1. 壁判定 (既存の処理) ---
+	SimVector3 leftTopCheck = centerNew + SimVector3{-kArchetype.width / 2.0f, checkHeight / 2.0f, 0.0f};
+	SimVector3 leftBottomCheck = centerNew + SimVector3{-kArchetype.width / 2.0f, -checkHeight / 2.0f, 0.0f};
+	MapChipField::IndexSet indexSetTop = mapChipField_->GetMapChipIndexSetByPosition(leftTopCheck);
+	MapChipField::IndexSet indexSetBottom = mapChipField_->GetMapChipIndexSetByPosition(leftBottomCheck);
+
+	if (((mapChipField_->GetMapChipTypeByIndex(indexSetTop.xIndex, indexSetTop.yIndex) == MapChipType::kBlock) ||
+	     (mapChipField_->GetMapChipTypeByIndex(indexSetBottom.xIndex, indexSetBottom.yIndex) == MapChipType::kBlock)) &&
+	    hot_.lrDirection == EnemyLRDirection::kLeft) {
+
+		info.isWallContact = true;
+		MapChipField::IndexSet indexSet = (mapChipField_->GetMapChipTypeByIndex(indexSetTop.xIndex, indexSetTop.yIndex) == MapChipType::kBlock) ? indexSetTop : indexSetBottom;
+		MapChipField::Rect blockRect = mapChipField_->GetRectByIndex(indexSet.xIndex, indexSet.yIndex);
+		info.move.x = blockRect.right + kArchetype.width / 2.0f - hot_.translation.x;
+
+		// 壁に当たったらその時点で処理終了
+		return;
+	}
+
+	// --- 2. 崖判定 ---
+	// 左下のさらに少し下を調べる
+	SimVector3 leftFloorCheck = centerNew + SimVector3{-kArchetype.width / 2.0f, -kArchetype.height / 2.0f - 0.2f, 0.0f};
+	MapChipField::IndexSet indexSetFloor = mapChipField_->GetMapChipIndexSetByPosition(leftFloorCheck);
+
+	// 足元がブロックでなければ（＝穴なら）壁と同じ扱いにする
+	if (mapChipField_->GetMapChipTypeByIndex(indexSetFloor.xIndex, indexSetFloor.yIndex) != MapChipType::kBlock) {
+		if (hot_.lrDirection == EnemyLRDirection::kLeft) {
+			info.isWallContact = true; // これをtrueにするとUpdate内で反転処理が走る
+			info.move.x = 0.0f;        // 進ませない
+		}
+	}
+}
+
+void SimEnemy::Initialize(const MapChipField* mapChipField, const SimVector3& position) {
+	mapChipField_ = mapChipField;
+
+	hot_ = EnemyHotState{};
+	hot_.translation = position;
+	hot_.rotationY = std::numbers::pi_v<float> / 2.0f;
+
+	// 初期スケールを明示
+	hot_.scale = kArchetype.initialScale;
+
+	// 速度を設定する
+	hot_.velocity = {-kArchetype.moveSpeed, 0.0f, 0.0f};
+
+	// 初期状態は生存
+	hot_.state = EnemyState::kAlive;
+
+}
+
+void SimEnemy::Update() {
+
+	// Dead なら更新しない
+	if (hot_.state == EnemyState::kDead) {
+		return;
+	}
+
+	// 死亡中のアニメーション処理
+	if (hot_.state == EnemyState::kDying) {
+		// シーケンシャル処理：まず回転、その後縮小フェード
+		float totalDuration = kArchetype.deathSpinDuration + kArchetype.deathShrinkDuration;
+		hot_.deathTimer += GameTime::GetDeltaTime();
+
+		if (hot_.deathTimer < kArchetype.deathSpinDuration) {
+			// 回転フェーズ：Y軸回転のみ
+			hot_.rotationY += kArchetype.deathSpinSpeed * GameTime::GetDeltaTime();
+		} else {
+			// 縮小フェーズ（回転は停止）
+			float shrinkElapsed = hot_.deathTimer - kArchetype.deathSpinDuration;
+			float t = std::clamp(shrinkElapsed / kArchetype.deathShrinkDuration, 0.0f, 1.0f);
+			// スケール線形補間 1.0 -> 0.0
+			hot_.scale = (1.0f - t) * kArchetype.initialScale;
+		}
+
+		// 終了判定
+		if (hot_.deathTimer >= totalDuration) {
+			hot_.state = EnemyState::kDead;
+		}
+		return;
+	}
+
+	// --- 1. 重力と移動 --- (通常の生存時処理)
+	if (hot_.onGround) {
+		// 着地している場合、左右の速度を維持
+		hot_.velocity.x = (hot_.lrDirection == EnemyLRDirection::kLeft) ? -kArchetype.moveSpeed : kArchetype.moveSpeed;
+	} else {
+		// 空中にいる場合、重力を加算
+		hot_.velocity.y -= kArchetype.gravityAcceleration;
+		hot_.velocity.y = (std::max)(hot_.velocity.y, -kArchetype.limitFallSpeed);
+	}
+
+	// --- 2. 当たり判定と移動量の補正 ---
+	// X軸
+	CollisionMapInfo infoX{};
+	infoX.move = {hot_.velocity.x, 0.0f, 0.0f};
+	MapCollisionRight(infoX);
+	MapCollisionLeft(infoX);
+	if (infoX.isWallContact) { // 壁に当たったら向きを反転
+		// 現在の向きと逆の向きを新しい向きとする
+		EnemyLRDirection newDirection = (hot_.lrDirection == EnemyLRDirection::kLeft) ? EnemyLRDirection::kRight : EnemyLRDirection::kLeft;
+		// 向きが実際に変わる場合のみ、旋回アニメーションを開始する
+		if (hot_.lrDirection != newDirection && hot_.turnTimer >= 1.0f) {
+			hot_.lrDirection = newDirection;
+			// 旋回アニメーションの準備
+			hot_.turnFirstRotationY = hot_.rotationY;
+			hot_.turnTimer = 0.0f;
+			infoX.move.x = 0.0f;
+		}
+	}
+	hot_.translation.x += infoX.move.x;
+
+	// Y軸
+	CollisionMapInfo infoY{};
+	infoY.move = {0.0f, hot_.velocity.y, 0.0f};
+	MapCollisionUp(infoY);
+	MapCollisionDown(infoY);
+	hot_.translation.y += infoY.move.y;
+	if (infoY.isLanding) {
+		hot_.onGround = true;
+		hot_.velocity.y = 0;
+	} else {
+		hot_.onGround = false;
+	}
+	if (infoY.isCeilingHit) {
+		hot_.velocity.y = 0;
+	}
+
+	// --- 3. アニメーションと向きの更新 ---
+	hot_.walkTimer += GameTime::GetDeltaTime();
+	float timeInCycle = std::fmod(hot_.walkTimer, kArchetype.walkMotionTime);
+	float progress = timeInCycle / kArchetype.walkMotionTime;
+	float sinArgument = progress * 2.0f * std::numbers::pi_v<float>;
+	float r = (FastMath::Sin(sinArgument) + 1.0f) / 2.0f;
+	hot_.rotationX = (1.0f - r) * kArchetype.walkMotionAngleStart + r * kArchetype.walkMotionAngleEnd;
+
+	// 向きの更新
+	if (hot_.turnTimer < 1.0f) {
+		hot_.turnTimer += GameTime::GetDeltaTime() / kArchetype.timeTurn;
+		hot_.turnTimer = std::fminf(hot_.turnTimer, 1.0f);
+
+		float destinationRotationYTable[] = {
+		    std::numbers::pi_v<float> * 0.5f, // 右向き (90度)
+		    std::numbers::pi_v<float> * 1.5f  // 左向き (270度)
+		};
+		float destinationRotationY = destinationRotationYTable[static_cast<uint32_t>(hot_.lrDirection)];
+		hot_.rotationY = Lerp(hot_.turnFirstRotationY, destinationRotationY, (hot_.turnTimer));
+	}
+}
+
+SimVector3 SimEnemy::GetWorldPosition() const {
+	// 親を持たないので平行移動成分がそのままワールド座標になる
+	return hot_.translation;
+}
+
+AABB SimEnemy::GetAABB() const {
+	SimVector3 worldPos = GetWorldPosition();
+	AABB aabb;
+	aabb.min = {worldPos.x - (kArchetype.width / 2.0f), worldPos.y - (kArchetype.height / 2.0f), worldPos.z - (kArchetype.width / 2.0f)};
+	aabb.max = {worldPos.x + (kArchetype.width / 2.0f), worldPos.y + (kArchetype.height / 2.0f), worldPos.z + (kArchetype.width / 2.0f)};
+	return aabb;
+}
+
+// SetIsAlive の実装: false が来たら死亡演出を開始する
+void SimEnemy::SetIsAlive(bool isAlive) {
+	if (isAlive) {
+		// 復活や再利用する場合
+		hot_.state = EnemyState::kAlive;
+		hot_.deathTimer = 0.0f;
+		hot_.scale = kArchetype.initialScale;
+	} else {
+		// 生存状態から死亡アニメーションへ移行する
+		if (hot_.state == EnemyState::kAlive) {
+			hot_.state = EnemyState::kDying;
+			hot_.deathTimer = 0.0f;
+			// 物理挙動を止める
+			hot_.velocity = {0.0f, 0.0f, 0.0f};
+			hot_.onGround = false;
+		}
+	}
+}
\ No newline at end of file
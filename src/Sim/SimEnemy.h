@@ -0,0 +1,83 @@
+#pragma once
+#include "Sim/SimEnemyData.h"
+#include "Sim/SimMath.h"
+#include "System/Collision.h"
+#include "System/MapChipField.h"
+
+/// <summary>
+/// 歩行する敵のシミュレーション
+/// </summary>
+class SimEnemy {
+private:
+	// マップとの当たり判定情報
+	struct CollisionMapInfo {
+		bool isCeilingHit = false;
+		bool isLanding = false;
+		bool isWallContact = false;
+		SimVector3 move;
+	};
+
+	// 毎フレーム更新するデータ（ホット）
+	EnemyHotState hot_;
+
+	// マップチップによるフィールド
+	const MapChipField* mapChipField_ = nullptr;
+
+	// 生成時のマップインデックスを保存
+	MapChipField::IndexSet spawnIndex_{UINT32_MAX, UINT32_MAX};
+
+	// 角
+	enum Corner { kRightBottom, kLeftBottom, kRightTop, kLeftTop, kNumCorner };
+
+	/// <summary>
+	/// 指定した角の座標を計算
+	/// </summary>
+	SimVector3 CornerPosition(const SimVector3 center, Corner corner);
+
+	// マップ衝突判定の個別方向判定関数
+	void MapCollisionUp(CollisionMapInfo& info);
+	void MapCollisionDown(CollisionMapInfo& info);
+	void MapCollisionRight(CollisionMapInfo& info);
+	void MapCollisionLeft(CollisionMapInfo& info);
+
+	/// <summary>
+	/// ワールド座標を取得
+	/// </summary>
+	/// <returns>ワールド座標</returns>
+	SimVector3 GetWorldPosition() const;
+
+public:
+	/// <summary>
+	/// 初期化
+	/// </summary>
+	/// <param name="mapChipField">マップチップフィールド</param>
+	/// <param name="position">初期座標</param>
+	void Initialize(const MapChipField* mapChipField, const SimVector3& position);
+
+	/// <summary>
+	/// 更新
+	/// </summary>
+	void Update();
+
+	// 生成時のマップインデックスをセット/取得
+	void SetSpawnIndex(const MapChipField::IndexSet& idx) { spawnIndex_ = idx; }
+	MapChipField::IndexSet GetSpawnIndex() const { return spawnIndex_; }
+
+	/// <summary>
+	/// AABBを取得
+	/// </summary>
+	/// <returns>AABB</returns>
+	AABB GetAABB() const;
+
+	// 表示側へ渡すホットデータ
+	const EnemyHotState& GetHotState() const { return hot_; }
+
+	// 生存フラグ（外部に対しては「通常の生存状態のみ true」を返す）
+	bool GetIsAlive() const { return hot_.state == EnemyState::kAlive; }
+
+	// 生存状態をセット（false を渡すと死亡アニメーションを開始）
+	void SetIsAlive(bool isAlive);
+
+	// チューニング値
+	static const EnemyArchetype& GetArchetype() { return EnemyArchetypes::kWalker; }
+};
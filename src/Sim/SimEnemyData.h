@@ -0,0 +1,134 @@
+#pragma once
+#include "Sim/SimMath.h"
+#include "Sim/SimStateHash.h"
+#include <cstdint>
+#include <numbers>
+
+/// <summary>
+/// 敵の種類ごとに共有するチューニング値（アーキタイプ）
+/// 全インスタンスで共通なので、インスタンスには持たせずテーブルを参照する
+/// </summary>
+struct EnemyArchetype {
+	// 移動
+	SimReal moveSpeed = 0.0f;           // 歩行（パトロール）速度
+	SimReal chaseSpeed = 0.0f;          // 追尾速度
+	SimReal detectRange = 0.0f;         // 追尾を開始する距離（矩形）
+	SimReal gravityAcceleration = 0.0f; // 重力加速度
+	SimReal limitFallSpeed = 0.0f;      // 最大落下速度
+
+	// 当たり判定サイズ
+	SimReal width = 1.9f;
+	SimReal height = 1.9f;
+
+	// 旋回時間<秒>
+	float timeTurn = 0.5f;
+
+	// 歩行アニメーション
+	float walkMotionAngleStart = -15.0f * (std::numbers::pi_v<float> / 180.0f);
+	float walkMotionAngleEnd = 15.0f * (std::numbers::pi_v<float> / 180.0f);
+	float walkMotionTime = 1.0f;
+
+	// 死亡演出
+	float deathSpinDuration = 0.6f;   // 回転時間（秒）
+	float deathShrinkDuration = 0.4f; // 縮小（フェード）時間（秒）
+	float deathSpinSpeed = 20.0f;     // 回転速度（ラジアン/秒）
+	float initialScale = 1.0f;        // 縮小開始時スケール
+
+	// 射撃
+	float shootInterval = 0.0f;      // 発射間隔（秒）
+	float chargeDuration = 0.0f;     // 攻撃予兆を開始する時間（発射の何秒前から膨らみ始めるか）
+	float maxChargeScale = 1.0f;     // 最大まで膨らんだときの倍率
+	float recoilDuration = 0.0f;     // 発射後に元の大きさに戻るまでの時間
+	SimReal projectileSpeed = 0.0f;    // 弾速（単位/秒）
+	float projectileLifeTime = 0.0f; // 弾の寿命（秒）
+};
+
+namespace EnemyArchetypes {
+
+// 歩行する敵
+inline constexpr EnemyArchetype kWalker{
+    .moveSpeed = 0.05f,
+    .gravityAcceleration = 0.02f,
+    .limitFallSpeed = 0.6f,
+};
+
+// 追尾する敵
+inline constexpr EnemyArchetype kChaser{
+    .moveSpeed = 0.05f,
+    .chaseSpeed = 0.08f,
+    .detectRange = 18.0f,
+};
+
+// 弾を撃つ敵
+inline constexpr EnemyArchetype kShooter{
+    .moveSpeed = 0.06f,
+    .shootInterval = 5.0f,
+    .chargeDuration = 1.0f,
+    .maxChargeScale = 1.5f,
+    .recoilDuration = 0.1f,
+    .projectileSpeed = 5.0f,
+    .projectileLifeTime = 5.0f,
+};
+
+} // namespace EnemyArchetypes
+
+// 左右
+enum class EnemyLRDirection : uint8_t {
+	kRight,
+	kLeft,
+};
+
+// 生存状態（Alive / Dying / Dead）
+enum class EnemyState : uint8_t {
+	kAlive,
+	kDying,
+	kDead,
+};
+
+/// <summary>
+/// 毎フレームの更新で読み書きするインスタンスデータ（ホット）
+/// 1キャッシュラインに収まるように並べている
+/// </summary>
+struct alignas(64) EnemyHotState {
+	SimVector3 translation = {};
+	SimVector3 velocity = {};
+	float rotationX = 0.0f; // 歩行アニメーションの傾き
+	float rotationY = 0.0f; // 向き
+	float scale = 1.0f;
+
+	// 旋回開始時の角度
+	float turnFirstRotationY = 0.0f;
+	// 旋回タイマー
+	float turnTimer = 0.0f;
+	// 歩行アニメーションの経過時間
+	float walkTimer = 0.0f;
+	// 死亡アニメーションの経過タイマー
+	float deathTimer = 0.0f;
+	// 発射タイマー
+	float shootTimer = 0.0f;
+
+	EnemyState state = EnemyState::kAlive;
+	EnemyLRDirection lrDirection = EnemyLRDirection::kLeft;
+	// 着地フラグ
+	bool onGround = false;
+	// 死亡SEの再生要求（並列更新中はイベントを積まず、更新後にリスト順でイベントへ変換する）
+	bool deathSoundRequested = false;
+
+	/// <summary>
+	/// 状態ハッシュへ加える
+	/// </summary>
+	void Hash(SimHasher& hasher) const {
+		hasher.Add(translation);
+		hasher.Add(velocity);
+		hasher.Add(rotationX);
+		hasher.Add(rotationY);
+		hasher.Add(scale);
+		hasher.Add(turnFirstRotationY);
+		hasher.Add(turnTimer);
+		hasher.Add(walkTimer);
+		hasher.Add(deathTimer);
+		hasher.Add(shootTimer);
+		hasher.Add((static_cast<uint32_t>(state) << 16) | (static_cast<uint32_t>(lrDirection) << 8) | (onGround ? 1u : 0u));
+	}
+};
+static_assert(sizeof(EnemyHotState) == 64, "EnemyHotState は1キャッシュラインに収めること");
@@ -0,0 +1,143 @@
+#include "Sim/SimEnvironmentBatch.h"
+#include "System/JobSystem.h"
+#include "System/MapChipField.h"
+
+namespace {
+
+// 行動として受け付けるボタン（リトライ・リスタートは環境側で行う）
+const uint8_t kActionMask =
+    static_cast<uint8_t>(SimButton::kLeft) | static_cast<uint8_t>(SimButton::kRight) | static_cast<uint8_t>(SimButton::kJump) | static_cast<uint8_t>(SimButton::kAttack);
+
+// ステージ開始演出・フェードインを飛ばすときの最大ステップ数（通常は4秒程度で kPlay に入る）
+const uint32_t kMaxIntroSteps = 60 * 10;
+
+} // namespace
+
+void SimEnvironmentBatch::Initialize(const MapChipField* mapChipField, int stageNo, uint32_t environmentCount, uint32_t maxEpisodeSteps) {
+	mapChipField_ = mapChipField;
+	maxEpisodeSteps_ = maxEpisodeSteps;
+
+	// 開始演出は入力を受け付けないので、1回だけ空入力で kPlay まで進めておき、各環境はそれをコピーして始める
+	initialWorld_.Initialize(mapChipField_, stageNo);
+	std::vector<SimEvent> events;
+	for (uint32_t i = 0; i < kMaxIntroSteps && initialWorld_.GetPhase() != SimPhase::kPlay; ++i) {
+		events.clear();
+		initialWorld_.Step(SimInput{}, events);
+	}
+
+	worlds_.assign(environmentCount, initialWorld_);
+	previousActions_.assign(environmentCount, 0);
+	episodeSteps_.assign(environmentCount, 0);
+
+	tileWindows_.assign(static_cast<size_t>(environmentCount) * kTileWindowSize, 0);
+	positionX_.assign(environmentCount, 0.0f);
+	positionY_.assign(environmentCount, 0.0f);
+	velocityX_.assign(environmentCount, 0.0f);
+	velocityY_.assign(environmentCount, 0.0f);
+	hp_.assign(environmentCount, 0);
+	playerFlags_.assign(environmentCount, 0);
+	rewards_.assign(environmentCount, 0.0f);
+	outcomes_.assign(environmentCount, SimEpisodeOutcome::kNone);
+
+	ResetAll();
+}
+
+void SimEnvironmentBatch::ResetAll() {
+	for (uint32_t i = 0; i < GetEnvironmentCount(); ++i) {
+		ResetEnvironment(i);
+		rewards_[i] = 0.0f;
+		outcomes_[i] = SimEpisodeOutcome::kNone;
+	}
+}
+
+void SimEnvironmentBatch::Step(const std::vector<uint8_t>& actions) {
+	// 環境ごとに自分の要素にだけ書き込むので、分割の仕方によらず結果は同じになる
+	JobSystem::GetInstance()->ParallelFor(GetEnvironmentCount(), kEnvironmentGrainSize, [&](uint32_t begin, uint32_t end) {
+		std::vector<SimEvent> events;
+		for (uint32_t i = begin; i < end; ++i) {
+			StepEnvironment(i, actions[i], events);
+		}
+	});
+}
+
+void SimEnvironmentBatch::StepEnvironment(uint32_t index, uint8_t action, std::vector<SimEvent>& events) {
+	SimWorld& world = worlds_[index];
+	const SimPlayer& player = world.GetPlayer();
+
+	// 押した瞬間は直前の行動との差から作る
+	SimInput input;
+	input.held = action & kActionMask;
+	input.triggered = input.held & ~previousActions_[index];
+	previousActions_[index] = input.held;
+
+	SimReal previousX = player.GetTranslation().x;
+	int previousHp = player.GetHp();
+
+	events.clear();
+	world.Step(input, events);
+	++episodeSteps_[index];
+
+	// --- 報酬 ---
+	float reward = ToFloat(player.GetTranslation().x - previousX) * kProgressReward - kStepPenalty;
+	if (player.GetHp() < previousHp) {
+		reward -= kDamagePenalty;
+	}
+
+	// --- エピソードの終了判定（演出の終わりまでは待たない。倒れる演出中も入力は効かないので死亡とする） ---
+	SimEpisodeOutcome outcome = SimEpisodeOutcome::kNone;
+	if (world.GetPhase() == SimPhase::kGoalAnimation) {
+		outcome = SimEpisodeOutcome::kClear;
+		reward += kClearReward;
+	} else if (world.GetPhase() == SimPhase::kDeath || player.GetIsDeadAnimating()) {
+		outcome = SimEpisodeOutcome::kDeath;
+		reward -= kDeathPenalty;
+	} else if (episodeSteps_[index] >= maxEpisodeSteps_) {
+		outcome = SimEpisodeOutcome::kTimeout;
+	}
+	rewards_[index] = reward;
+	outcomes_[index] = outcome;
+
+	if (outcome != SimEpisodeOutcome::kNone) {
+		ResetEnvironment(index);
+	} else {
+		WriteObservation(index);
+	}
+}
+
+void SimEnvironmentBatch::WriteObservation(uint32_t index) {
+	const SimPlayer& player = worlds_[index].GetPlayer();
+	const SimVector3& position = player.GetTranslation();
+	const SimVector3& velocity = player.GetVelocity();
+
+	positionX_[index] = ToFloat(position.x);
+	positionY_[index] = ToFloat(position.y);
+	velocityX_[index] = ToFloat(velocity.x);
+	velocityY_[index] = ToFloat(velocity.y);
+	hp_[index] = player.GetHp();
+
+	uint8_t flags = 0;
+	flags |= player.GetIsAlive() ? kFlagAlive : 0;
+	flags |= player.GetIsAttacking() ? kFlagAttacking : 0;
+	flags |= player.GetIsMeleeAttacking() ? kFlagMeleeAttacking : 0;
+	flags |= player.GetIsInvincible() ? kFlagInvincible : 0;
+	playerFlags_[index] = flags;
+
+	// プレイヤーのいるマスを中心に切り出す（範囲外はマップと同じく kBlank として読む）
+	MapChipField::IndexSet center = mapChipField_->GetMapChipIndexSetByPosition(position);
+	uint32_t left = center.xIndex - kTileWindowWidth / 2;
+	uint32_t top = center.yIndex - kTileWindowHeight / 2;
+	uint8_t* window = &tileWindows_[static_cast<size_t>(index) * kTileWindowSize];
+	for (uint32_t y = 0; y < kTileWindowHeight; ++y) {
+		for (uint32_t x = 0; x < kTileWindowWidth; ++x) {
+			// 左端・上端より外は符号なしの桁あふれで範囲外になる
+			window[y * kTileWindowWidth + x] = static_cast<uint8_t>(mapChipField_->GetMapChipTypeByIndex(left + x, top + y));
+		}
+	}
+}
+
+void SimEnvironmentBatch::ResetEnvironment(uint32_t index) {
+	worlds_[index] = initialWorld_;
+	previousActions_[index] = 0;
+	episodeSteps_[index] = 0;
+	WriteObservation(index);
+}
@@ -0,0 +1,122 @@
+#pragma once
+#include "Sim/SimWorld.h"
+#include <cstdint>
+#include <vector>
+
+class MapChipField;
+
+// 1エピソードの終わり方
+enum class SimEpisodeOutcome : uint8_t {
+	kNone,    // 続行中
+	kClear,   // ゴールした
+	kDeath,   // 死亡した
+	kTimeout, // 最大ステップ数に達した
+};
+
+/// <summary>
+/// 同じステージの環境（SimWorld）を N 個まとめて、同じ歩調で1ステップずつ進める（自動プレイヤーの学習用）
+/// 行動はボタンのビットマスク（SimButton の kLeft / kRight / kJump / kAttack）で受け取り、
+/// 観測（プレイヤー周りのマップ・プレイヤーの状態）と報酬は環境ごとの配列（SoA）で返す。
+/// エピソードが終わった環境は、同じステップの中でプレイ開始時の状態へ戻す
+/// </summary>
+class SimEnvironmentBatch {
+public:
+	// 観測するマップの範囲（プレイヤーのいるマスを中心にした横×縦のマス数）
+	static inline const uint32_t kTileWindowWidth = 17;
+	static inline const uint32_t kTileWindowHeight = 11;
+	static inline const uint32_t kTileWindowSize = kTileWindowWidth * kTileWindowHeight;
+
+	// 報酬
+	static inline const float kProgressReward = 0.1f; // 右へ1単位進むごと
+	static inline const float kStepPenalty = 0.001f;  // 1ステップごと
+	static inline const float kDamagePenalty = 1.0f;  // 被弾
+	static inline const float kDeathPenalty = 5.0f;   // 死亡
+	static inline const float kClearReward = 10.0f;   // ゴール
+
+	// プレイヤーの状態フラグ（GetPlayerFlags のビット）
+	static inline const uint8_t kFlagAlive = 1 << 0;
+	static inline const uint8_t kFlagAttacking = 1 << 1;
+	static inline const uint8_t kFlagMeleeAttacking = 1 << 2;
+	static inline const uint8_t kFlagInvincible = 1 << 3;
+
+	// 並列更新（JobSystem）の分割単位
+	static inline const uint32_t kEnvironmentGrainSize = 32;
+
+	/// <summary>
+	/// 初期化（全環境をプレイ開始時の状態にする）
+	/// </summary>
+	/// <param name="mapChipField">読み込み済みのマップ（全環境で読み取り専用で共有する）</param>
+	/// <param name="stageNo">ステージ番号</param>
+	/// <param name="environmentCount">環境の数</param>
+	/// <param name="maxEpisodeSteps">1エピソードの最大ステップ数</param>
+	void Initialize(const MapChipField* mapChipField, int stageNo, uint32_t environmentCount, uint32_t maxEpisodeSteps);
+
+	/// <summary>
+	/// 全環境をプレイ開始時の状態に戻す
+	/// </summary>
+	void ResetAll();
+
+	/// <summary>
+	/// 全環境を1ステップ進める
+	/// </summary>
+	/// <param name="actions">環境ごとの行動（押しているボタンのビットマスク。要素数は環境の数）</param>
+	void Step(const std::vector<uint8_t>& actions);
+
+	uint32_t GetEnvironmentCount() const { return static_cast<uint32_t>(worlds_.size()); }
+
+	// --- 観測（エピソードが終わった環境は、戻した後の状態） ---
+	// プレイヤー周りのマップ（環境ごとに kTileWindowSize 個。上の行から順に MapChipType の値が入る）
+	const std::vector<uint8_t>& GetTileWindows() const { return tileWindows_; }
+	const std::vector<float>& GetPositionX() const { return positionX_; }
+	const std::vector<float>& GetPositionY() const { return positionY_; }
+	const std::vector<float>& GetVelocityX() const { return velocityX_; }
+	const std::vector<float>& GetVelocityY() const { return velocityY_; }
+	const std::vector<int32_t>& GetHp() const { return hp_; }
+	const std::vector<uint8_t>& GetPlayerFlags() const { return playerFlags_; }
+
+	// --- 直前の Step の結果 ---
+	const std::vector<float>& GetRewards() const { return rewards_; }
+	// エピソードの終わり方（続行中なら kNone）
+	const std::vector<SimEpisodeOutcome>& GetOutcomes() const { return outcomes_; }
+	// 現在のエピソードの経過ステップ数
+	const std::vector<uint32_t>& GetEpisodeSteps() const { return episodeSteps_; }
+
+private:
+	/// <summary>
+	/// 1環境分を1ステップ進める
+	/// </summary>
+	void StepEnvironment(uint32_t index, uint8_t action, std::vector<SimEvent>& events);
+
+	/// <summary>
+	/// 1環境分の観測を書き込む
+	/// </summary>
+	void WriteObservation(uint32_t index);
+
+	/// <summary>
+	/// 1環境分をプレイ開始時の状態に戻す
+	/// </summary>
+	void ResetEnvironment(uint32_t index);
+
+	const MapChipField* mapChipField_ = nullptr;
+	uint32_t maxEpisodeSteps_ = 0;
+
+	// プレイ開始時（kPlay に入った直後）の状態。リセットはこれをコピーする
+	SimWorld initialWorld_;
+
+	// --- 環境ごとの状態 ---
+	std::vector<SimWorld> worlds_;
+	// 直前のステップで押していたボタン（押した瞬間の判定に使う）
+	std::vector<uint8_t> previousActions_;
+	std::vector<uint32_t> episodeSteps_;
+
+	// --- 環境ごとの観測と結果 ---
+	std::vector<uint8_t> tileWindows_;
+	std::vector<float> positionX_;
+	std::vector<float> positionY_;
+	std::vector<float> velocityX_;
+	std::vector<float> velocityY_;
+	std::vector<int32_t> hp_;
+	std::vector<uint8_t> playerFlags_;
+	std::vector<float> rewards_;
+	std::vector<SimEpisodeOutcome> outcomes_;
+};
@@ -0,0 +1,37 @@
+#pragma once
+#include "Sim/SimMath.h"
+#include <cstdint>
+
+// ゲームの進行フェーズ
+enum class SimPhase : uint8_t {
+	kStageStart,    // ステージ開始（暗転・番号表示）
+	kFadeIn,        // フェードイン
+	kPlay,          // ゲームプレイ
+	kGoalAnimation, // ゴール演出
+	kDeath,         // デス演出
+	kDeathFadeOut,  // デス後のフェードアウト
+	kFadeOut,       // クリア後のフェードアウト
+	kCleared,       // クリア（シーン終了待ち）
+};
+
+// シミュレーションから外へ通知する出来事の種類
+enum class SimEventType : uint8_t {
+	kPlayerJump,   // プレイヤーがジャンプした（SE）
+	kPlayerAttack, // プレイヤーが攻撃した（SE）
+	kPlayerDamage, // プレイヤーが被弾した（SE）
+	kEnemyDeath,   // 敵が縮み始めた（SE）
+	kPhaseChanged, // フェーズが切り替わった（フェード・パーティクルなどの演出）
+	kReset,        // ステージをやり直した（表示側も作り直す）
+};
+
+/// <summary>
+/// シミュレーションが発行するイベント
+/// 音や演出はシミュレーションの中では鳴らさず、このイベントを受け取った側が再生する
+/// </summary>
+struct SimEvent {
+	SimEventType type = SimEventType::kPhaseChanged;
+	// kPhaseChanged のときの遷移先
+	SimPhase phase = SimPhase::kStageStart;
+	// 発生位置（パーティクルの発生位置など）
+	SimVector3 position = {};
+};
@@ -0,0 +1,126 @@
+#pragma once
+#include <cstdint>
+
+/// <summary>
+/// Q16.16 の固定小数点数（上位16ビットが整数部、下位16ビットが小数部）
+/// 加減算は整数の加減算、乗除算は64ビットの中間値とシフトだけで行うので、
+/// コンパイラや CPU（FMA の有無・x87 など）によらず同じ入力から常に同じビット列になる。
+/// 表せる範囲は約 ±32768、刻みは 1/65536（約 0.000015）
+/// </summary>
+class SimFixed {
+public:
+	// 小数部のビット数
+	static inline constexpr int kFractionBits = 16;
+	// 1.0 の内部表現
+	static inline constexpr int32_t kOne = int32_t{1} << kFractionBits;
+
+	constexpr SimFixed() = default;
+	// 浮動小数点数からの変換は最も近い値に丸める（定数はコンパイル時に変換される）
+	constexpr SimFixed(float value) : raw_(RoundToRaw(static_cast<double>(value))) {}
+	constexpr SimFixed(double value) : raw_(RoundToRaw(value)) {}
+	constexpr SimFixed(int value) : raw_(static_cast<int32_t>(static_cast<uint32_t>(value) << kFractionBits)) {}
+
+	/// <summary>
+	/// 内部表現から作る
+	/// </summary>
+	static constexpr SimFixed FromRaw(int32_t raw) {
+		SimFixed value;
+		value.raw_ = raw;
+		return value;
+	}
+
+	// 内部表現
+	constexpr int32_t GetRaw() const { return raw_; }
+
+	// 浮動小数点数への変換（描画・表示用。シミュレーションの計算には使わない）
+	constexpr explicit operator float() const { return static_cast<float>(raw_) / static_cast<float>(kOne); }
+	constexpr explicit operator double() const { return static_cast<double>(raw_) / static_cast<double>(kOne); }
+	// 整数への変換は float と同じく 0 方向に切り捨てる
+	constexpr explicit operator int() const { return raw_ / kOne; }
+
+	constexpr SimFixed operator-() const { return FromRaw(-raw_); }
+	constexpr SimFixed operator+() const { return *this; }
+
+	constexpr SimFixed& operator+=(SimFixed v) {
+		raw_ += v.raw_;
+		return *this;
+	}
+	constexpr SimFixed& operator-=(SimFixed v) {
+		raw_ -= v.raw_;
+		return *this;
+	}
+	constexpr SimFixed& operator*=(SimFixed v) {
+		raw_ = Multiply(raw_, v.raw_);
+		return *this;
+	}
+	constexpr SimFixed& operator/=(SimFixed v) {
+		raw_ = Divide(raw_, v.raw_);
+		return *this;
+	}
+
+	friend constexpr SimFixed operator+(SimFixed a, SimFixed b) { return FromRaw(a.raw_ + b.raw_); }
+	friend constexpr SimFixed operator-(SimFixed a, SimFixed b) { return FromRaw(a.raw_ - b.raw_); }
+	friend constexpr SimFixed operator*(SimFixed a, SimFixed b) { return FromRaw(Multiply(a.raw_, b.raw_)); }
+	friend constexpr SimFixed operator/(SimFixed a, SimFixed b) { return FromRaw(Divide(a.raw_, b.raw_)); }
+
+	friend constexpr bool operator==(SimFixed a, SimFixed b) { return a.raw_ == b.raw_; }
+	friend constexpr bool operator!=(SimFixed a, SimFixed b) { return a.raw_ != b.raw_; }
+	friend constexpr bool operator<(SimFixed a, SimFixed b) { return a.raw_ < b.raw_; }
+	friend constexpr bool operator>(SimFixed a, SimFixed b) { return a.raw_ > b.raw_; }
+	friend constexpr bool operator<=(SimFixed a, SimFixed b) { return a.raw_ <= b.raw_; }
+	friend constexpr bool operator>=(SimFixed a, SimFixed b) { return a.raw_ >= b.raw_; }
+
+private:
+	// 表せる範囲を超える値（-FLT_MAX を「最小値」として使う場合など）は端の値にそろえる
+	static constexpr int32_t RoundToRaw(double value) {
+		double scaled = value * static_cast<double>(kOne);
+		if (scaled >= static_cast<double>(INT32_MAX)) {
+			return INT32_MAX;
+		}
+		if (scaled <= static_cast<double>(INT32_MIN)) {
+			return INT32_MIN;
+		}
+		return static_cast<int32_t>(scaled >= 0.0 ? scaled + 0.5 : scaled - 0.5);
+	}
+
+	// 積は下位ビットを切り捨てる（算術シフトなので負の値も -∞ 方向にそろう）
+	static constexpr int32_t Multiply(int32_t a, int32_t b) { return static_cast<int32_t>((static_cast<int64_t>(a) * b) >> kFractionBits); }
+
+	// 0 除算は呼び出し側で避ける（浮動小数点版と同じく、長さ 0 のベクトルは正規化しないなど）
+	static constexpr int32_t Divide(int32_t a, int32_t b) { return static_cast<int32_t>((static_cast<int64_t>(a) * kOne) / b); }
+
+	int32_t raw_ = 0;
+};
+
+// 64ビット整数の平方根（切り捨て。1ビットずつ求めるので浮動小数点演算を使わない）
+constexpr uint64_t IntegerSqrt(uint64_t value) {
+	uint64_t root = 0;
+	uint64_t bit = uint64_t{1} << 62;
+	while (bit > value) {
+		bit >>= 2;
+	}
+	while (bit != 0) {
+		if (value >= root + bit) {
+			value -= root + bit;
+			root = (root >> 1) + bit;
+		} else {
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+	return root;
+}
+
+// 平方根（負の値は 0 を返す）
+constexpr SimFixed Sqrt(SimFixed value) {
+	if (value.GetRaw() <= 0) {
+		return SimFixed{};
+	}
+	// raw * 2^16 の平方根が結果の内部表現になる
+	return SimFixed::FromRaw(static_cast<int32_t>(IntegerSqrt(static_cast<uint64_t>(value.GetRaw()) << SimFixed::kFractionBits)));
+}
+
+constexpr SimFixed Abs(SimFixed value) { return value.GetRaw() < 0 ? -value : value; }
+
+// 小数部の切り捨て（-∞ 方向）
+constexpr SimFixed Floor(SimFixed value) { return SimFixed::FromRaw(value.GetRaw() & ~(SimFixed::kOne - 1)); }
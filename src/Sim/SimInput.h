@@ -0,0 +1,40 @@
+#pragma once
+#include <cstdint>
+
+// シミュレーションが受け付けるボタン（ビットフラグ）
+enum class SimButton : uint8_t {
+	kLeft = 1 << 0,   // 左移動
+	kRight = 1 << 1,  // 右移動
+	kJump = 1 << 2,   // ジャンプ
+	kAttack = 1 << 3, // 攻撃
+	kReset = 1 << 4,  // リトライ（プレイ中のみ）
+	kRestart = 1 << 5, // ポーズメニューからのリスタート（どのフェーズでも受け付ける）
+};
+
+/// <summary>
+/// 1フレーム分の入力
+/// キーボードやゲームパッドの読み取りはシミュレーションの外（GameScene など）で行い、
+/// この構造体に詰めて渡す
+/// </summary>
+struct SimInput {
+	// 押されているボタン
+	uint8_t held = 0;
+	// このフレームで押されたボタン
+	uint8_t triggered = 0;
+
+	bool IsHeld(SimButton button) const { return (held & static_cast<uint8_t>(button)) != 0; }
+	bool IsTriggered(SimButton button) const { return (triggered & static_cast<uint8_t>(button)) != 0; }
+
+	void SetHeld(SimButton button, bool isOn) {
+		if (isOn) {
+			held |= static_cast<uint8_t>(button);
+		}
+	}
+	void SetTriggered(SimButton button, bool isOn) {
+		if (isOn) {
+			triggered |= static_cast<uint8_t>(button);
+		}
+	}
+
+	bool operator==(const SimInput& other) const = default;
+};
@@ -0,0 +1,138 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include <initializer_list>
+
+#ifdef SIM_FIXED_POINT
+#include "Sim/SimFixed.h"
+#else
+#include "Utils/FastMath.h"
+#include <numbers>
+#endif
+
+// シミュレーションの座標・速度に使う数値型
+// SIM_FIXED_POINT を定義してビルドすると Q16.16 の固定小数点数（SimFixed）になり、
+// 浮動小数点演算の違い（FMA の有無・コンパイラの最適化など）によらず、どの環境でも同じ結果になる
+// ただし float の式で求めた値を座標・速度に混ぜると、その分は浮動小数点演算に依存するので、
+// 座標に入る値（攻撃の突進・近接攻撃の移動量など）は SimReal で計算する（タイマーは float のまま。定数を引くだけなので環境によらない）
+#ifdef SIM_FIXED_POINT
+using SimReal = SimFixed;
+#else
+using SimReal = float;
+#endif
+
+// --- SimReal の算術（float 版は標準ライブラリをそのまま呼ぶので、結果は今までと変わらない） ---
+inline float Sqrt(float value) { return std::sqrt(value); }
+inline float Abs(float value) { return std::abs(value); }
+inline float Floor(float value) { return std::floor(value); }
+
+// 描画・表示用に float へ変換する
+inline float ToFloat(float value) { return value; }
+#ifdef SIM_FIXED_POINT
+inline float ToFloat(SimFixed value) { return static_cast<float>(value); }
+#endif
+
+/// <summary>
+/// シミュレーションコア用の3次元ベクトル
+/// エンジン（KamataEngine）に依存しないので、ヘッドレス実行でもそのまま使える
+/// </summary>
+struct SimVector3 {
+	SimReal x = 0.0f;
+	SimReal y = 0.0f;
+	SimReal z = 0.0f;
+
+	SimVector3& operator+=(const SimVector3& v) {
+		x += v.x;
+		y += v.y;
+		z += v.z;
+		return *this;
+	}
+	SimVector3& operator-=(const SimVector3& v) {
+		x -= v.x;
+		y -= v.y;
+		z -= v.z;
+		return *this;
+	}
+	SimVector3& operator*=(SimReal s) {
+		x *= s;
+		y *= s;
+		z *= s;
+		return *this;
+	}
+};
+
+inline SimVector3 operator+(const SimVector3& a, const SimVector3& b) { return {a.x + b.x, a.y + b.y, a.z + b.z}; }
+inline SimVector3 operator-(const SimVector3& a, const SimVector3& b) { return {a.x - b.x, a.y - b.y, a.z - b.z}; }
+inline SimVector3 operator-(const SimVector3& v) { return {-v.x, -v.y, -v.z}; }
+inline SimVector3 operator*(const SimVector3& v, SimReal s) { return {v.x * s, v.y * s, v.z * s}; }
+inline SimVector3 operator*(SimReal s, const SimVector3& v) { return {v.x * s, v.y * s, v.z * s}; }
+inline SimVector3 operator/(const SimVector3& v, SimReal s) { return {v.x / s, v.y / s, v.z / s}; }
+
+// ベクトルの長さ
+#ifdef SIM_FIXED_POINT
+// 2乗の和は 64 ビットで求める（Q16.16 のままだと長さ 181 を超えたところで桁あふれする）
+inline SimReal Length(const SimVector3& v) {
+	uint64_t sum = 0;
+	for (int32_t raw : {v.x.GetRaw(), v.y.GetRaw(), v.z.GetRaw()}) {
+		sum += static_cast<uint64_t>(static_cast<int64_t>(raw) * raw);
+	}
+	return SimFixed::FromRaw(static_cast<int32_t>(IntegerSqrt(sum)));
+}
+#else
+inline SimReal Length(const SimVector3& v) { return std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z); }
+#endif
+
+// ベクトルの正規化（ゼロベクトルはそのまま返す）
+inline SimVector3 Normalize(const SimVector3& v) {
+	SimReal length = Length(v);
+	if (length != 0.0f) {
+		return v / length;
+	}
+	return v;
+}
+
+#ifdef SIM_FIXED_POINT
+// スカラーの線形補間（float 版は Utils/Easing.h の Lerp）
+inline SimReal Lerp(SimReal start, SimReal end, SimReal t) { return start + (end - start) * t; }
+
+// EaseOutQuint の固定小数点版（float 版は Utils/Easing.h。式は同じ）
+constexpr SimFixed EaseOutQuint(SimFixed t) {
+	SimFixed f = t - SimFixed(1);
+	return f * f * f * f * f + SimFixed(1);
+}
+
+// sin(t * π)（周期 2）。整数演算だけで求めるので、浮動小数点演算の違いによらない
+// [-1/2, 1/2] に折りたたんでから、9次までのテイラー展開で求める（誤差は刻み 1/65536 の数個分）
+constexpr SimFixed SinPi(SimFixed t) {
+	// 内部表現の下位ビットだけを取り出して [-1, 1) にする
+	int32_t raw = t.GetRaw() & (2 * SimFixed::kOne - 1);
+	if (raw >= SimFixed::kOne) {
+		raw -= 2 * SimFixed::kOne;
+	}
+	// sin(πx) は x = ±1/2 を軸に対称
+	if (raw > SimFixed::kOne / 2) {
+		raw = SimFixed::kOne - raw;
+	} else if (raw < -SimFixed::kOne / 2) {
+		raw = -SimFixed::kOne - raw;
+	}
+	SimFixed x = SimFixed::FromRaw(raw);
+	SimFixed z = x * x;
+	// 係数は π, -π^3/3!, π^5/5!, -π^7/7!, π^9/9!
+	SimFixed polynomial = ((SimFixed(0.0821458866) * z - SimFixed(0.5992645293)) * z + SimFixed(2.5501640399)) * z - SimFixed(5.1677127800);
+	return (polynomial * z + SimFixed(3.1415926536)) * x;
+}
+#else
+// sin(t * π)（固定小数点版と同じ呼び方にするため。FastMath::Sin をそのまま呼ぶ）
+constexpr float SinPi(float t) { return FastMath::Sin(t * std::numbers::pi_v<float>); }
+#endif
+
+// 線形補間（描画時の補間に使う）
+inline SimVector3 Lerp(const SimVector3& start, const SimVector3& end, SimReal t) { return start + (end - start) * t; }
+
+// 角度の補間。1ステップで大きく変わった角度（瞬時の向き反転など）は補間せず end をそのまま返す
+inline float LerpAngle(float start, float end, float t, float snapThreshold = 1.5f) {
+	if (std::abs(end - start) > snapThreshold) {
+		return end;
+	}
+	return start + (end - start) * t;
+}
@@ -0,0 +1,333 @@
+#pragma once
+#include "Sim/SimEvent.h"
+#include "Sim/SimInput.h"
+#include "Sim/SimMath.h"
+#include "Sim/SimStateHash.h"
+#include "System/Collision.h"
+#include <vector>
+
+class MapChipField;
+
+// マップとの当たり判定情報
+struct CollisionMapInfo {
+	bool isCeilingHit = false;  // 天井衝突フラグ
+	bool isLanding = false;     // 着地フラグ
+	bool isWallContact = false; // 壁接触フラグ
+	SimVector3 move;            // 移動量
+};
+
+// 演出の状態定義
+enum class GoalAnimationPhase {
+	kNone,
+	kSpin, // 一回転して正面を向く
+	kWait, // 回転後の待機時間
+	kJump, // ジャンプ
+	kPose, // ポーズをとるフェーズ
+	kEnd   // 演出終了
+};
+
+/// <summary>
+/// 自キャラのシミュレーション（入力・移動・攻撃・被弾・演出の状態）
+/// 描画は Player（表示側）がこの状態を読み取って行う
+/// </summary>
+class SimPlayer {
+public:
+	// 左右
+	enum class LRDirection {
+		kRight,
+		kLeft,
+	};
+
+private:
+	LRDirection lrDirection_ = LRDirection::kRight;
+
+	// 姿勢（表示側のワールド変換へそのまま反映される）
+	SimVector3 translation_ = {};
+	SimVector3 rotation_ = {};
+	SimVector3 scale_ = {1.0f, 1.0f, 1.0f};
+
+	// 速度
+	SimVector3 velocity_ = {0.0f, -1.0f, 0.0f};
+	// 加速度
+	static inline const SimReal kAcceleration = 0.01f;
+	// 減速率
+	static inline const SimReal kAttenuation = 0.05f;
+	// 最大速度
+	static inline const SimReal kLimitRunSpeed = 0.5f;
+	// ダッシュ速度
+	static inline const SimReal kDashSpeed = 0.8f;
+
+	// ダッシュ攻撃の速度
+	static inline const SimReal kDashAttackSpeed = 1.2f;
+
+	// ダッシュ中か
+	bool isDashing_ = false;
+
+	// キャラクターの当たり判定サイズ
+	static inline const SimReal kWidth = 2.0f;
+	static inline const SimReal kHeight = 2.0f;
+
+	// 旋回開始時の角度
+	SimReal turnFirstRotationY_ = 0.0f;
+	// 旋回タイマー
+	float turnTimer_ = 0.0f;
+	// 旋回時間<秒>
+	static inline const float kTimeTurn = 0.0f;
+
+	// ジャンプフラグ
+	bool onGround_ = false;
+
+	// 重力加速度
+	static inline const SimReal kGravityAcceleration = 0.02f;
+	// 最大落下速度
+	static inline const SimReal kLimitFallSpeed = 0.6f;
+	// ジャンプ初速
+	static inline const SimReal kJumpAcceleration = 0.5f;
+
+	//ジャンプ回数
+	static inline const int kMaxJumpCount = 2;
+	int jumpCount = 0;
+
+	// 攻撃中フラグ
+	bool isAttacking_ = false;
+
+	// 攻撃タイマー
+	float attackTimer_ = 0.0f;
+	// 攻撃の「タメ」の時間 <秒>
+	static inline const float kAttackSquashDuration = 0.1f;
+	// 攻撃の「伸び」の時間 <秒>
+	static inline const float kAttackStretchDuration = 0.3f;
+	// 攻撃の合計時間
+	static inline const float kAttackDuration = kAttackSquashDuration + kAttackStretchDuration;
+
+	// タメモーションのY方向の縮み量 (例: 0.5f -> 元の50%まで縮む)
+	static inline const float kSquashAmountY = 0.5f;
+	// 伸びモーションのY方向の伸び量 (例: 0.5f -> 元の1.5倍まで伸びる)
+	static inline const float kStretchAmountY = 0.5f;
+	// 攻撃の突進距離
+	static inline const SimReal kAttackDistance = 8.0f;
+	// 攻撃開始時の座標
+	SimVector3 attackStartPosition_ = {};
+	bool isAttackBlocked_ = false;
+
+	// 近接攻撃
+	bool isMeleeAttacking_ = false;
+	float meleeAttackTimer_ = 0.0f;
+	static inline const float kMeleeAttackDuration = 0.3f;
+	static inline const SimReal kMeleeAttackRange = 5.0f;
+	static inline const SimReal kMeleeAttackMoveDistance = 2.0f;
+
+	// 近接攻撃の判定（発生したフレームだけ有効。敵への反映は SimWorld が行う）
+	AABB meleeHitBox_ = {};
+	bool hasMeleeHitBox_ = false;
+
+	// マップチップによるフィールド
+	const MapChipField* mapChipFiled_ = nullptr;
+
+	// 死亡フラグ
+	bool isAlive_ = false;
+
+	// 無敵
+	bool isInvincible_ = false;
+
+	// ノックバックの強さ
+	static inline const SimReal kKnockbackHorizontalPower = 0.3f; // 水平方向の強さ
+	static inline const SimReal kKnockbackVerticalPower = 0.2f;   // 少し上に跳ねる強さ
+
+	// 現在の重力ベクトル
+	SimVector3 gravity_ = {0.0f, -kGravityAcceleration, 0.0f};
+
+	// HP
+	int hp_ = 0;
+	static inline const int kMaxHp = 3; // 最大HP
+
+	// 死亡演出中フラグ
+	bool isDeadAnimating_ = false;
+
+	// 死亡演出用タイマー
+	float deathTimer_ = 0.0f;
+	// 死亡演出の時間（秒）。この時間が経過すると死亡と判定される
+	static inline const float kDeathAnimationDuration = 2.0f;
+
+	// ダメージ量
+	static inline const int kDamageFromEnemy = 1;
+
+	// 無敵時間タイマー
+	float invincibleTimer_ = 0.0f;
+	// 無敵時間 <秒>
+	static inline const float kInvincibleDuration = 2.0f;
+
+	// ゴール演出用
+	GoalAnimationPhase goalAnimationPhase_ = GoalAnimationPhase::kNone;
+	float goalAnimTimer_ = 0.0f;
+
+	SimReal goalStartRotationY_ = 0.0f; // 演出開始時の角度を保存
+
+	// ポーズ開始時の角度保存用
+	SimReal goalStartRotationZ_ = 0.0f;
+
+	// 角
+	enum Corner {
+		kRightBottom, // 右下
+		kLeftBottom,  // 左下
+		kRightTop,    // 右上
+		kLeftTop,     // 左上
+		kNumCorner    // 要素数
+	};
+
+	// 剣の姿勢（攻撃中のみ更新される）
+	SimVector3 swordTranslation_ = {};
+	float swordRotationZ_ = 0.0f;
+	// 攻撃時の体の傾き
+	float attackTilt_ = 0.0f;
+
+	float airHoverTimer_ = 0.0f;                           // 現在の滞空蓄積時間
+	static inline const float kMaxAirHoverDuration = 1.5f; // 最大滞空時間 (例: 1.5秒)
+
+	/// <summary>
+	/// 指定した角の座標を計算
+	/// </summary>
+	/// <param name="center">中心座標</param>
+	/// <param name="corner">角の種類</param>
+	/// <returns>指定した角の座標</returns>
+	SimVector3 CornerPosition(const SimVector3 center, Corner corner);
+
+	/// <summary>
+	/// 攻撃処理
+	/// </summary>
+	void Attack(const SimVector3& gravityVector);
+
+	/// <summary>
+	/// 近接攻撃の判定を発生させる
+	/// </summary>
+	void MeleeAttack();
+
+	/// <summary>
+	/// 衝突を考慮しながら指定された量だけ移動する
+	/// </summary>
+	/// <param name="move">移動量</param>
+	/// <param name="gravityVector">現在の重力ベクトル</param>
+	/// <returns>衝突が発生した場合 true</returns>
+	bool MoveAndCollide(const SimVector3& move, const SimVector3& gravityVector);
+
+	// マップ衝突判定の個別方向判定関数
+	void MapCollisionUp(CollisionMapInfo& info);    // 上方向判定
+	void MapCollisionDown(CollisionMapInfo& info);  // 下方向判定
+	void MapCollisionRight(CollisionMapInfo& info); // 右方向判定
+	void MapCollisionLeft(CollisionMapInfo& info);  // 左方向判定
+
+	/// <summary>
+	/// 攻撃に関する状態更新（モーション、移動量計算、入力受付など）
+	/// </summary>
+	/// <param name="input">このフレームの入力</param>
+	/// <param name="gravityVector">現在の重力</param>
+	/// <param name="outAttackMove">計算された攻撃の移動量（出力用）</param>
+	/// <param name="events">発行したイベントの追加先</param>
+	void UpdateAttack(const SimInput& input, const SimVector3& gravityVector, SimVector3& outAttackMove, std::vector<SimEvent>& events);
+
+	/// <summary>
+	/// 入力に応じて速度を更新する
+	/// </summary>
+	/// <param name="input">このフレームの入力</param>
+	/// <param name="gravityVector">現在の重力</param>
+	/// <param name="events">発行したイベントの追加先</param>
+	void UpdateVelocityByInput(const SimInput& input, const SimVector3& gravityVector, std::vector<SimEvent>& events);
+
+	/// <summary>
+	/// 最終的な移動量を元に、衝突判定を行いながら座標を更新する
+	/// </summary>
+	/// <param name="finalMove">最終的な移動量</param>
+	/// <param name="gravityVector">現在の重力</param>
+	void ApplyCollisionAndMove(const SimVector3& finalMove, const SimVector3& gravityVector);
+
+	/// <summary>
+	/// 向きの更新
+	/// </summary>
+	void UpdateRotation();
+
+public:
+	/// <summary>
+	/// 初期化
+	/// </summary>
+	/// <param name="mapChipField">マップチップフィールド</param>
+	/// <param name="position">初期座標</param>
+	void Initialize(const MapChipField* mapChipField, const SimVector3& position);
+
+	/// <summary>
+	/// 更新
+	/// </summary>
+	/// <param name="input">このフレームの入力</param>
+	/// <param name="gravityVector">重力</param>
+	/// <param name="timeScale">時間の進み方（死亡演出中のスロー）</param>
+	/// <param name="events">発行したイベントの追加先</param>
+	void Update(const SimInput& input, const SimVector3& gravityVector, float timeScale, std::vector<SimEvent>& events);
+
+	/// <summary>
+	/// 衝突応答
+	/// </summary>
+	/// <param name="otherPosition">衝突相手の座標</param>
+	/// <param name="events">発行したイベントの追加先</param>
+	void OnCollision(const SimVector3& otherPosition, std::vector<SimEvent>& events);
+
+	/// <summary>
+	/// ゴール演出開始
+	/// </summary>
+	void StartGoalAnimation();
+
+	/// <summary>
+	/// ゴール演出更新
+	/// </summary>
+	void UpdateGoalAnimation();
+
+	/// <summary>
+	/// このフレームで発生した近接攻撃の判定を取り出す（無ければ false）
+	/// </summary>
+	bool TakeMeleeHitBox(AABB& outHitBox);
+
+	/// <summary>
+	/// AABBを取得
+	/// </summary>
+	AABB GetAABB() const;
+
+	/// <summary>
+	/// 状態ハッシュへ加える（フレームをまたいで持ち越す状態をすべて入れる）
+	/// </summary>
+	void Hash(SimHasher& hasher) const;
+
+	// 姿勢
+	const SimVector3& GetTranslation() const { return translation_; }
+	const SimVector3& GetRotation() const { return rotation_; }
+	const SimVector3& GetScale() const { return scale_; }
+	const SimVector3& GetVelocity() const { return velocity_; }
+
+	// 剣の姿勢
+	const SimVector3& GetSwordTranslation() const { return swordTranslation_; }
+	float GetSwordRotationZ() const { return swordRotationZ_; }
+
+	// ゴール演出の状態を取得
+	GoalAnimationPhase GetGoalAnimationPhase() const { return goalAnimationPhase_; }
+
+	// HPを取得する
+	int GetHp() const { return hp_; }
+
+	// 死亡状態を取得する
+	bool GetIsAlive() const { return isAlive_; }
+
+	// 無敵状態を取得する
+	bool GetIsInvincible() const { return isInvincible_; }
+
+	// 無敵時間の残り（点滅表示に使う）
+	float GetInvincibleTimer() const { return invincibleTimer_; }
+
+	bool GetIsAttacking() const { return isAttacking_; }
+
+	bool GetIsMeleeAttacking() const { return isMeleeAttacking_; }
+
+	static SimReal GetGravityAcceleration() { return kGravityAcceleration; }
+
+	// この高さより下に落ちたら死亡
+	static inline const SimReal kDeadlyHeight = 11.0f;
+
+	// 死亡演出中かどうかを取得する
+	bool GetIsDeadAnimating() const { return isDeadAnimating_; }
+};
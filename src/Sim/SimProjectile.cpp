@@ -0,0 +1,53 @@
+#include "Sim/SimProjectile.h"
+#include "System/GameTime.h"
+#include "System/MapChipField.h"
+
+void SimProjectile::Initialize(const SimVector3& position, const SimVector3& velocity, const MapChipField* mapChipField, float lifeTime) {
+	mapChipField_ = mapChipField;
+
+	translation_ = position;
+
+	velocity_ = velocity;
+	lifeTime_ = lifeTime;
+	alive_ = true;
+}
+
+void SimProjectile::Update() {
+	if (!alive_) return;
+
+	const float dt = GameTime::GetDeltaTime();
+	// 移動
+	translation_.x += velocity_.x * dt;
+	translation_.y += velocity_.y * dt;
+	translation_.z += velocity_.z * dt;
+
+	// --- マップ衝突判定 ---
+	if (mapChipField_) {
+		// 現在の座標がマップチップのどのインデックスか取得
+		MapChipField::IndexSet index = mapChipField_->GetMapChipIndexSetByPosition(translation_);
+
+		// その場所がブロックなら弾を消す
+		if (mapChipField_->GetMapChipTypeByIndex(index.xIndex, index.yIndex) == MapChipType::kBlock) {
+			alive_ = false;
+		}
+	}
+
+	// 寿命処理
+	lifeTime_ -= dt;
+	if (lifeTime_ <= 0.0f) {
+		alive_ = false;
+	}
+}
+
+AABB SimProjectile::GetAABB() const {
+	SimVector3 worldPos = GetWorldPosition();
+	AABB aabb;
+	aabb.min = {worldPos.x - kRadius / 2.0f, worldPos.y - kRadius / 2.0f, worldPos.z - kRadius / 2.0f};
+	aabb.max = {worldPos.x + kRadius / 2.0f, worldPos.y + kRadius / 2.0f, worldPos.z + kRadius / 2.0f};
+	return aabb;
+}
+
+void SimProjectile::OnCollision() {
+	// プレイヤーに当たったら弾は消える
+	alive_ = false;
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include "Sim/SimMath.h"
+#include "Sim/SimStateHash.h"
+#include "System/Collision.h"
+
+class MapChipField;
+
+/// <summary>
+/// 射撃する敵が撃つ弾のシミュレーション
+/// </summary>
+class SimProjectile {
+private:
+	SimVector3 translation_{};
+	SimVector3 velocity_{};
+	float lifeTime_ = 0.0f; // 残り寿命（秒）
+	bool alive_ = false;
+
+	// マップチップフィールドへのポインタ
+	const MapChipField* mapChipField_ = nullptr;
+
+	// 弾の当たり判定サイズ
+	static inline const float kRadius = 0.5f;
+
+public:
+	// 表示スケール
+	static inline const float kScale = 0.5f;
+
+	void Initialize(const SimVector3& position, const SimVector3& velocity, const MapChipField* mapChipField, float lifeTime = 5.0f);
+
+	void Update();
+
+	bool IsAlive() const { return alive_; }
+
+	// ワールド座標取得
+	const SimVector3& GetWorldPosition() const { return translation_; }
+	// 速度（単位/秒。描画時の補間に使う）
+	const SimVector3& GetVelocity() const { return velocity_; }
+
+	// AABBを取得
+	AABB GetAABB() const;
+	// 衝突時の処理
+	void OnCollision();
+
+	// 状態ハッシュへ加える
+	void Hash(SimHasher& hasher) const {
+		hasher.Add(translation_);
+		hasher.Add(velocity_);
+		hasher.Add(lifeTime_);
+		hasher.Add(alive_);
+	}
+};
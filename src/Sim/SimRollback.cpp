@@ -0,0 +1,137 @@
+#include "Sim/SimRollback.h"
+#include <algorithm>
+#include <chrono>
+
+void SimRollbackBuffer::Initialize(const SimWorld& world) {
+	slots_.fill(world);
+	frames_.fill(UINT32_MAX);
+}
+
+void SimRollbackBuffer::Save(const SimWorld& world) {
+	uint32_t frame = world.GetFrameCount();
+	slots_[frame % kSlotCount] = world;
+	frames_[frame % kSlotCount] = frame;
+}
+
+bool SimRollbackBuffer::Load(uint32_t frame, SimWorld& world) const {
+	if (!HasFrame(frame)) {
+		return false;
+	}
+	world = slots_[frame % kSlotCount];
+	return true;
+}
+
+void SimRollbackSession::Initialize(const MapChipField* mapChipField, int stageNo, uint32_t playerCount) {
+	SimWorld initialWorld;
+	initialWorld.Initialize(mapChipField, stageNo);
+
+	worlds_.assign(playerCount, initialWorld);
+	rollbackBuffers_.resize(playerCount);
+	for (SimRollbackBuffer& rollbackBuffer : rollbackBuffers_) {
+		rollbackBuffer.Initialize(initialWorld);
+	}
+	inputHistories_.assign(playerCount, InputHistory{});
+	for (InputHistory& history : inputHistories_) {
+		history.confirmedFrames.fill(UINT32_MAX);
+	}
+
+	currentFrame_ = 0;
+	rollbackFrame_ = UINT32_MAX;
+	stats_ = Stats{};
+}
+
+void SimRollbackSession::SetInput(uint32_t player, uint32_t frame, const SimInput& input) {
+	InputHistory& history = inputHistories_[player];
+	// 確定済みのフレームと、覚えておける範囲より先のフレームは受け取らない
+	if (frame < history.confirmedCount || frame >= history.confirmedCount + kInputHistorySize) {
+		return;
+	}
+	uint32_t slot = frame % kInputHistorySize;
+	history.confirmedInputs[slot] = input;
+	history.confirmedFrames[slot] = frame;
+
+	// 予測で進めたフレームの入力が違っていたら巻き戻す
+	if (frame < currentFrame_ && history.usedInputs[slot] != input) {
+		rollbackFrame_ = (std::min)(rollbackFrame_, frame);
+	}
+
+	// 途中が抜けずに届いているところまで確定させる
+	while (history.confirmedFrames[history.confirmedCount % kInputHistorySize] == history.confirmedCount) {
+		++history.confirmedCount;
+	}
+}
+
+bool SimRollbackSession::CanAdvance() const { return currentFrame_ - GetConfirmedFrame() < SimRollbackBuffer::kMaxRollbackFrames; }
+
+void SimRollbackSession::AdvanceFrame() {
+	ApplyPendingRollback();
+	StepFrame(currentFrame_);
+	++currentFrame_;
+}
+
+void SimRollbackSession::ApplyPendingRollback() {
+	if (rollbackFrame_ == UINT32_MAX) {
+		return;
+	}
+	auto startTime = std::chrono::steady_clock::now();
+
+	// CanAdvance を守っていれば、巻き戻す先のフレームは必ず保存されている
+	uint32_t depth = currentFrame_ - rollbackFrame_;
+	for (uint32_t player = 0; player < GetPlayerCount(); ++player) {
+		rollbackBuffers_[player].Load(rollbackFrame_, worlds_[player]);
+	}
+	for (uint32_t frame = rollbackFrame_; frame < currentFrame_; ++frame) {
+		StepFrame(frame);
+	}
+	rollbackFrame_ = UINT32_MAX;
+
+	double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+	++stats_.rollbackCount;
+	stats_.resimulatedFrames += depth;
+	stats_.maxRollbackDepth = (std::max)(stats_.maxRollbackDepth, depth);
+	stats_.totalRollbackSeconds += elapsed;
+	stats_.maxRollbackSeconds = (std::max)(stats_.maxRollbackSeconds, elapsed);
+}
+
+bool SimRollbackSession::GetConfirmedInput(uint32_t player, uint32_t frame, SimInput& outInput) const {
+	const InputHistory& history = inputHistories_[player];
+	uint32_t slot = frame % kInputHistorySize;
+	if (history.confirmedFrames[slot] != frame) {
+		return false;
+	}
+	outInput = history.confirmedInputs[slot];
+	return true;
+}
+
+uint32_t SimRollbackSession::GetConfirmedFrame() const {
+	uint32_t confirmedFrame = UINT32_MAX;
+	for (const InputHistory& history : inputHistories_) {
+		confirmedFrame = (std::min)(confirmedFrame, history.confirmedCount);
+	}
+	return confirmedFrame;
+}
+
+SimInput SimRollbackSession::GetInputForFrame(uint32_t player, uint32_t frame) const {
+	SimInput input;
+	if (GetConfirmedInput(player, frame, input)) {
+		return input;
+	}
+	// 最後に確定した入力のボタンを押し続けていると予測する（押した瞬間は繰り返さない）
+	const InputHistory& history = inputHistories_[player];
+	SimInput prediction;
+	if (history.confirmedCount > 0) {
+		prediction.held = history.confirmedInputs[(history.confirmedCount - 1) % kInputHistorySize].held;
+	}
+	return prediction;
+}
+
+void SimRollbackSession::StepFrame(uint32_t frame) {
+	for (uint32_t player = 0; player < GetPlayerCount(); ++player) {
+		SimInput input = GetInputForFrame(player, frame);
+		inputHistories_[player].usedInputs[frame % kInputHistorySize] = input;
+
+		rollbackBuffers_[player].Save(worlds_[player]);
+		events_.clear();
+		worlds_[player].Step(input, events_);
+	}
+}
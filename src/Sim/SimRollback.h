@@ -0,0 +1,148 @@
+#pragma once
+#include "Sim/SimEvent.h"
+#include "Sim/SimInput.h"
+#include "Sim/SimWorld.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+class MapChipField;
+
+/// <summary>
+/// 直近のフレームの SimWorld を保存しておき、過去のフレームへ巻き戻せるようにする（ロールバック用）
+/// 保存は確保済みの枠への SimWorld のコピー代入なので、毎フレーム行っても割り当ては起きない
+/// </summary>
+class SimRollbackBuffer {
+public:
+	// 巻き戻せる最大フレーム数
+	static inline const uint32_t kMaxRollbackFrames = 8;
+
+	/// <summary>
+	/// 全ての枠を world のコピーで埋めて領域を確保しておく（保存済みのフレームは無しになる）
+	/// </summary>
+	void Initialize(const SimWorld& world);
+
+	/// <summary>
+	/// world を、そのフレーム（GetFrameCount）を進める前の状態として保存する
+	/// </summary>
+	void Save(const SimWorld& world);
+
+	/// <summary>
+	/// 保存したフレームの状態を world へ戻す
+	/// </summary>
+	/// <param name="frame">戻すフレーム（そのフレームを進める前の状態になる）</param>
+	/// <param name="world">戻す先</param>
+	/// <returns>保存していない（古すぎる）フレームなら false</returns>
+	bool Load(uint32_t frame, SimWorld& world) const;
+
+	bool HasFrame(uint32_t frame) const { return frames_[frame % kSlotCount] == frame; }
+
+private:
+	// 現在のフレームの分も含めて kMaxRollbackFrames + 1 個
+	static inline const uint32_t kSlotCount = kMaxRollbackFrames + 1;
+
+	std::array<SimWorld, kSlotCount> slots_;
+	// 各枠に保存したフレーム（UINT32_MAX は空）
+	std::array<uint32_t, kSlotCount> frames_ = {};
+};
+
+/// <summary>
+/// 複数人のレース（各プレイヤーが同じステージをそれぞれの SimWorld で走る）をロールバック方式で進める
+/// 相手の入力が届いていないフレームは「最後に届いた入力のボタンを押し続けている」と予測して進め、
+/// 届いた入力が予測と違っていたら、そのフレームまで全プレイヤーの状態を巻き戻して現在のフレームまで進め直す。
+/// 進め直したステップのイベントは捨てる（演出や音は確定した結果ではなく、最初に進めたときのものを使う）
+/// </summary>
+class SimRollbackSession {
+public:
+	// 巻き戻しの統計
+	struct Stats {
+		// 巻き戻した回数と、進め直したフレーム数の合計
+		uint64_t rollbackCount = 0;
+		uint64_t resimulatedFrames = 0;
+		// 1回で巻き戻した最大フレーム数
+		uint32_t maxRollbackDepth = 0;
+		// 巻き戻し（状態の復元と進め直し）にかかった時間の合計と、1回あたりの最大
+		double totalRollbackSeconds = 0.0;
+		double maxRollbackSeconds = 0.0;
+	};
+
+	// 入力を覚えておくフレーム数（届いた先のフレームの入力もここに入れておく）
+	static inline const uint32_t kInputHistorySize = 64;
+
+	/// <summary>
+	/// 初期化
+	/// </summary>
+	/// <param name="mapChipField">読み込み済みのマップ（セッションより長く生存すること）</param>
+	/// <param name="stageNo">ステージ番号</param>
+	/// <param name="playerCount">プレイヤー数</param>
+	void Initialize(const MapChipField* mapChipField, int stageNo, uint32_t playerCount);
+
+	/// <summary>
+	/// プレイヤーの入力を確定させる（自分の入力も相手から届いた入力もこれで渡す。同じフレームを何度渡してもよい）
+	/// 進めたフレームの入力が予測と違っていたら、次の AdvanceFrame で巻き戻す
+	/// </summary>
+	void SetInput(uint32_t player, uint32_t frame, const SimInput& input);
+
+	/// <summary>
+	/// 次のフレームへ進められるか（入力が確定していないフレームが巻き戻せる数に達していたら待つ）
+	/// </summary>
+	bool CanAdvance() const;
+
+	/// <summary>
+	/// 必要なら巻き戻して進め直したうえで、現在のフレームを1フレーム進める
+	/// </summary>
+	void AdvanceFrame();
+
+	/// <summary>
+	/// 予測と違う入力が届いていれば、巻き戻して現在のフレームまで進め直す（新しいフレームは進めない）
+	/// </summary>
+	void ApplyPendingRollback();
+
+	/// <summary>
+	/// 確定した入力を取得する（相手へ送り直す用）
+	/// </summary>
+	/// <returns>まだ確定していない・古すぎるフレームなら false</returns>
+	bool GetConfirmedInput(uint32_t player, uint32_t frame, SimInput& outInput) const;
+
+	// 次に進めるフレーム
+	uint32_t GetCurrentFrame() const { return currentFrame_; }
+	// 全プレイヤーの入力がそろっているフレーム数（このフレームより前は確定している）
+	uint32_t GetConfirmedFrame() const;
+	uint32_t GetPlayerCount() const { return static_cast<uint32_t>(worlds_.size()); }
+	const SimWorld& GetWorld(uint32_t player) const { return worlds_[player]; }
+	const Stats& GetStats() const { return stats_; }
+
+private:
+	// プレイヤーごとの入力の履歴
+	struct InputHistory {
+		// 確定した入力と、そのフレーム（UINT32_MAX は空）
+		std::array<SimInput, kInputHistorySize> confirmedInputs = {};
+		std::array<uint32_t, kInputHistorySize> confirmedFrames = {};
+		// 実際に進めるのに使った入力（予測を含む）
+		std::array<SimInput, kInputHistorySize> usedInputs = {};
+		// このフレームより前の入力は全て確定している
+		uint32_t confirmedCount = 0;
+	};
+
+	/// <summary>
+	/// フレームの入力を取得する（確定していなければ予測する）
+	/// </summary>
+	SimInput GetInputForFrame(uint32_t player, uint32_t frame) const;
+
+	/// <summary>
+	/// 全プレイヤーを1フレーム進める（進める前の状態を保存し、使った入力を覚えておく）
+	/// </summary>
+	void StepFrame(uint32_t frame);
+
+	std::vector<SimWorld> worlds_;
+	std::vector<SimRollbackBuffer> rollbackBuffers_;
+	std::vector<InputHistory> inputHistories_;
+	// 進めたステップのイベント（捨てる）
+	std::vector<SimEvent> events_;
+
+	uint32_t currentFrame_ = 0;
+	// 巻き戻す必要のある最も古いフレーム（UINT32_MAX は巻き戻し不要）
+	uint32_t rollbackFrame_ = UINT32_MAX;
+
+	Stats stats_;
+};
@@ -0,0 +1,293 @@
+#include "Sim/SimShooterEnemy.h"
+#include "System/GameTime.h"
+#include "Utils/Easing.h"
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace {
+// 弾を撃つ敵のチューニング値
+constexpr const EnemyArchetype& kArchetype = EnemyArchetypes::kShooter;
+} // namespace
+
+void SimShooterEnemy::Initialize(const MapChipField* mapChipField, const SimVector3& position) {
+	mapChipField_ = mapChipField;
+
+	projectiles_.clear();
+
+	hot_ = EnemyHotState{};
+	hot_.translation = position;
+
+	// --- 向きの修正 ---
+	// 左に進むため、最初から左(270度)に向けておく
+	hot_.rotationY = std::numbers::pi_v<float> * 1.5f;
+
+	hot_.scale = kArchetype.initialScale;
+
+	// 移動速度は左方向
+	hot_.velocity = {-kArchetype.moveSpeed, 0.0f, 0.0f};
+
+	// 内部の向き管理フラグも左
+	hot_.lrDirection = EnemyLRDirection::kLeft;
+
+	hot_.shootTimer = 0.0f;
+
+	// --- 旋回アニメーション管理変数の初期化 ---
+	// 最初は旋回しなくていい（完了状態）ので 1.0f に設定
+	hot_.turnTimer = 1.0f;
+	// 念のため開始角度変数も現在の向きに合わせておく
+	hot_.turnFirstRotationY = hot_.rotationY;
+
+	// --- 状態の初期化 ---
+	hot_.state = EnemyState::kAlive;
+}
+
+void SimShooterEnemy::MapCollisionRight(SimVector3& move) {
+	// --- 1. 壁判定 (既存の処理) ---
+	const SimReal checkHeight = kArchetype.height * 0.8f;
+	SimVector3 centerNew = hot_.translation + move;
+	SimVector3 rightTopCheck = centerNew + SimVector3{kArchetype.width / 2.0f, checkHeight / 2.0f, 0.0f};
+	SimVector3 rightBottomCheck = centerNew + SimVector3{kArchetype.width / 2.0f, -checkHeight / 2.0f, 0.0f};
+
+	auto idxTop = mapChipField_->GetMapChipIndexSetByPosition(rightTopCheck);
+	auto idxBottom = mapChipField_->GetMapChipIndexSetByPosition(rightBottomCheck);
+
+	if ((mapChipField_->GetMapChipTypeByIndex(idxTop.xIndex, idxTop.yIndex) == MapChipType::kBlock ||
+	     mapChipField_->GetMapChipTypeByIndex(idxBottom.xIndex, idxBottom.yIndex) == MapChipType::kBlock) &&
+	    hot_.lrDirection == EnemyLRDirection::kRight) {
+		// 壁接触 -> 反転
+		hot_.lrDirection = EnemyLRDirection::kLeft;
+		move.x = 0.0f;
+
+		if (hot_.turnTimer >= 1.0f) {
+			hot_.lrDirection = EnemyLRDirection::kLeft;
+			hot_.turnFirstRotationY = hot_.rotationY;
+			hot_.turnTimer = 0.0f;
+		}
+		return; // 壁に当たったらここで終了
+	}
+
+	// --- 2. 崖判定 ---
+	// 「移動先の足元」をチェックする
+	// 右端(width/2.0f) のさらに少し下(-checkHeight / 2.0f - 0.2f) を調べる
+	SimVector3 rightFloorCheck = centerNew + SimVector3{kArchetype.width / 2.0f, -kArchetype.height / 2.0f - 0.2f, 0.0f};
+	auto idxFloor = mapChipField_->GetMapChipIndexSetByPosition(rightFloorCheck);
+
+	// 足元がブロックじゃなかったら（＝穴だったら）反転
+	if (mapChipField_->GetMapChipTypeByIndex(idxFloor.xIndex, idxFloor.yIndex) != MapChipType::kBlock) {
+		hot_.lrDirection = EnemyLRDirection::kLeft;
+		move.x = 0.0f;
+
+		if (hot_.turnTimer >= 1.0f) {
+			hot_.lrDirection = EnemyLRDirection::kLeft;
+			hot_.turnFirstRotationY = hot_.rotationY;
+			hot_.turnTimer = 0.0f;
+		}
+	}
+}
+
+void SimShooterEnemy::MapCollisionLeft(SimVector3& move) {
+	if (!mapChipField_)
+		return;
+	if (move.x >= 0)
+		return;
+
+	// --- 1. 壁判定 (既存の処理) ---
+	const SimReal checkHeight = kArchetype.height * 0.8f;
+	SimVector3 centerNew = hot_.translation + move;
+	SimVector3 leftTopCheck = centerNew + SimVector3{-kArchetype.width / 2.0f, checkHeight / 2.0f, 0.0f};
+	SimVector3 leftBottomCheck = centerNew + SimVector3{-kArchetype.width / 2.0f, -checkHeight / 2.0f, 0.0f};
+
+	auto idxTop = mapChipField_->GetMapChipIndexSetByPosition(leftTopCheck);
+	auto idxBottom = mapChipField_->GetMapChipIndexSetByPosition(leftBottomCheck);
+
+	if ((mapChipField_->GetMapChipTypeByIndex(idxTop.xIndex, idxTop.yIndex) == MapChipType::kBlock ||
+	     mapChipField_->GetMapChipTypeByIndex(idxBottom.xIndex, idxBottom.yIndex) == MapChipType::kBlock) &&
+	    hot_.lrDirection == EnemyLRDirection::kLeft) {
+		hot_.lrDirection = EnemyLRDirection::kRight;
+		move.x = 0.0f;
+
+		if (hot_.turnTimer >= 1.0f) {
+			hot_.lrDirection = EnemyLRDirection::kLeft;
+			hot_.turnFirstRotationY = hot_.rotationY;
+			hot_.turnTimer = 0.0f;
+		}
+		return; // 壁に当たったらここで終了
+	}
+
+	// --- 2. 崖判定　---
+	// 「移動先の足元」をチェックする
+	// 左端(-width/2.0f) のさらに少し下(-height / 2.0f - 0.2f) を調べる
+	SimVector3 leftFloorCheck = centerNew + SimVector3{-kArchetype.width / 2.0f, -kArchetype.height / 2.0f - 0.2f, 0.0f};
+	auto idxFloor = mapChipField_->GetMapChipIndexSetByPosition(leftFloorCheck);
+
+	// 足元がブロックじゃなかったら（＝穴だったら）反転
+	if (mapChipField_->GetMapChipTypeByIndex(idxFloor.xIndex, idxFloor.yIndex) != MapChipType::kBlock) {
+		hot_.lrDirection = EnemyLRDirection::kRight;
+		move.x = 0.0f;
+
+		if (hot_.turnTimer >= 1.0f) {
+			hot_.lrDirection = EnemyLRDirection::kLeft;
+			hot_.turnFirstRotationY = hot_.rotationY;
+			hot_.turnTimer = 0.0f;
+		}
+	}
+}
+
+void SimShooterEnemy::Update() {
+
+	// --- 弾の更新は死んでいても常に行う ---
+	UpdateProjectiles();
+
+	// --- 完全に死亡(kDead)なら、これ以降の移動処理は行わない ---
+	if (hot_.state == EnemyState::kDead) {
+		return;
+	}
+
+	// --- 死亡演出中(kDying)のアニメーション処理 ---
+	if (hot_.state == EnemyState::kDying) {
+		float totalDuration = kArchetype.deathSpinDuration + kArchetype.deathShrinkDuration;
+		hot_.deathTimer += GameTime::GetDeltaTime();
+
+		if (hot_.deathTimer < kArchetype.deathSpinDuration) {
+			// 回転フェーズ：Y軸回転のみ
+			hot_.rotationY += kArchetype.deathSpinSpeed * GameTime::GetDeltaTime();
+		} else {
+			// 縮小フェーズ（回転は停止）
+			float shrinkElapsed = hot_.deathTimer - kArchetype.deathSpinDuration;
+			float t = std::clamp(shrinkElapsed / kArchetype.deathShrinkDuration, 0.0f, 1.0f);
+
+			// スケール線形補間 1.0 -> 0.0
+			float scale = (1.0f - t) * kArchetype.initialScale;
+			hot_.scale = scale;
+
+		}
+
+		// 演出終了判定
+		if (hot_.deathTimer >= totalDuration) {
+			hot_.state = EnemyState::kDead;
+		}
+		// 死亡演出中は移動や発射を行わないのでリターン
+		return;
+	}
+
+	// 左右速度は向きに従う
+	hot_.velocity.x = (hot_.lrDirection == EnemyLRDirection::kLeft) ? -kArchetype.moveSpeed : kArchetype.moveSpeed;
+
+	// 移動とマップ衝突（左右のみ簡易）
+	SimVector3 move = {hot_.velocity.x, 0.0f, 0.0f};
+	MapCollisionRight(move);
+	MapCollisionLeft(move);
+	hot_.translation.x += move.x;
+
+	if (hot_.turnTimer < 1.0f) {
+		hot_.turnTimer += GameTime::GetDeltaTime() / kArchetype.timeTurn;
+		if (hot_.turnTimer > 1.0f) {
+			hot_.turnTimer = 1.0f;
+		}
+
+		float distinationRotationYTable[] = {
+			std::numbers::pi_v<float> * 0.5f,
+			std::numbers::pi_v<float> * 1.5f
+		};
+		float distinationRotationY = distinationRotationYTable[static_cast<uint32_t>(hot_.lrDirection)];
+
+		// 線形補間 (Lerp)
+		// Enemy.cppで使われている Lerp 関数があればそれを使います
+		// なければ以下の計算式: start + (end - start) * t
+		hot_.rotationY = Lerp(hot_.turnFirstRotationY, distinationRotationY, hot_.turnTimer);
+	}
+
+	// 発射タイマー
+	hot_.shootTimer += GameTime::GetDeltaTime();
+
+	// --- スケール制御（反動・通常・予兆） ---
+
+	// 発射までの残り時間
+	float timeToShoot = kArchetype.shootInterval - hot_.shootTimer;
+
+	// 1. 【反動フェーズ】 発射直後（タイマーがまだ小さい時）
+	if (hot_.shootTimer < kArchetype.recoilDuration) {
+		// 進行度 t (0.0 → 1.0)
+		float t = hot_.shootTimer / kArchetype.recoilDuration;
+
+		// 最大サイズ(maxChargeScale) から 通常サイズ(initialScale) へ戻る
+		// 計算式: Start + (End - Start) * t
+		float scale = kArchetype.maxChargeScale + (kArchetype.initialScale - kArchetype.maxChargeScale) * t;
+		hot_.scale = scale;
+	}
+	// 2. 【攻撃予兆フェーズ】 発射直前（残り時間が1秒を切った時）
+	else if (timeToShoot <= kArchetype.chargeDuration && timeToShoot > 0.0f) {
+		// 進行度 t (0.0 → 1.0)
+		float t = 1.0f - (timeToShoot / kArchetype.chargeDuration);
+
+		// 通常サイズ(initialScale) から 最大サイズ(maxChargeScale) へ膨らむ
+		float scale = kArchetype.initialScale + (kArchetype.maxChargeScale - kArchetype.initialScale) * t;
+		hot_.scale = scale;
+	}
+	// 3. 【通常待機フェーズ】 それ以外
+	else {
+		hot_.scale = kArchetype.initialScale;
+	}
+
+	if (hot_.shootTimer >= kArchetype.shootInterval) {
+		hot_.shootTimer = 0.0f;
+
+		// 発射位置（敵のワールド座標）
+		SimVector3 enemyPos = hot_.translation;
+
+		// 敵の向いている方向(hot_.lrDirection)に応じて発射方向を決める
+		SimVector3 dir = {0.0f, 0.0f, 0.0f};
+		if (hot_.lrDirection == EnemyLRDirection::kLeft) {
+			dir = {-1.0f, 0.0f, 0.0f}; // 左向き
+		} else {
+			dir = {1.0f, 0.0f, 0.0f}; // 右向き
+		}
+
+		// 速度ベクトルを計算
+		SimVector3 vel = {dir.x * kArchetype.projectileSpeed, dir.y * kArchetype.projectileSpeed, dir.z * kArchetype.projectileSpeed};
+
+		// 弾の生成
+		SimProjectile& p = projectiles_.emplace_back();
+		p.Initialize(enemyPos, vel, mapChipField_, kArchetype.projectileLifeTime);
+	}
+
+	// 弾の更新と掃除
+	UpdateProjectiles();
+}
+
+void SimShooterEnemy::UpdateProjectiles() {
+	for (SimProjectile& p : projectiles_) {
+		if (p.IsAlive())
+			p.Update();
+	}
+	projectiles_.erase(std::remove_if(projectiles_.begin(), projectiles_.end(), [](const SimProjectile& p) { return !p.IsAlive(); }), projectiles_.end());
+}
+
+AABB SimShooterEnemy::GetAABB() const {
+	SimVector3 worldPos = hot_.translation;
+	AABB aabb;
+	aabb.min = {worldPos.x - kArchetype.width / 2.0f, worldPos.y - kArchetype.height / 2.0f, worldPos.z - kArchetype.width / 2.0f};
+	aabb.max = {worldPos.x + kArchetype.width / 2.0f, worldPos.y + kArchetype.height / 2.0f, worldPos.z + kArchetype.width / 2.0f};
+	return aabb;
+}
+
+void SimShooterEnemy::SetIsAlive(bool isAlive) {
+	// --- Enemy.cpp と同様の状態遷移 ---
+	if (isAlive) {
+		// 復活・初期化
+		hot_.state = EnemyState::kAlive;
+		hot_.deathTimer = 0.0f;
+		hot_.scale = kArchetype.initialScale;
+		// hot_.velocity や onGround_ のリセットが必要ならここで行う
+	} else {
+		// 生存状態から死亡アニメーションへ移行
+		if (hot_.state == EnemyState::kAlive) {
+			hot_.state = EnemyState::kDying;
+			hot_.deathTimer = 0.0f;
+			// 動きを止める
+			hot_.velocity = {0.0f, 0.0f, 0.0f};
+			projectiles_.clear();
+		}
+	}
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include "Sim/SimEnemyData.h"
+#include "Sim/SimMath.h"
+#include "Sim/SimProjectile.h"
+#include "System/Collision.h"
+#include "System/MapChipField.h"
+#include <vector>
+
+/// <summary>
+/// 弾を撃つ敵のシミュレーション
+/// </summary>
+class SimShooterEnemy {
+private:
+	// 毎フレーム更新するデータ（ホット）
+	EnemyHotState hot_;
+
+	const MapChipField* mapChipField_ = nullptr;
+
+	// 射撃関連
+	std::vector<SimProjectile> projectiles_;
+
+	// マップ衝突（左右のみ）
+	void MapCollisionRight(SimVector3& move);
+	void MapCollisionLeft(SimVector3& move);
+
+	// 弾の更新と掃除
+	void UpdateProjectiles();
+
+public:
+	void Initialize(const MapChipField* mapChipField, const SimVector3& position);
+
+	void Update();
+
+	// 生存状態をセット（false を渡すと死亡アニメーションを開始）
+	void SetIsAlive(bool isAlive);
+	bool GetIsAlive() const { return hot_.state == EnemyState::kAlive; }
+
+	// AABBを取得
+	AABB GetAABB() const;
+
+	// 表示側へ渡すホットデータ
+	const EnemyHotState& GetHotState() const { return hot_; }
+
+	// 弾との当たり判定・描画のためにリストを公開
+	const std::vector<SimProjectile>& GetProjectiles() const { return projectiles_; }
+	std::vector<SimProjectile>& GetProjectiles() { return projectiles_; }
+
+	// チューニング値
+	static const EnemyArchetype& GetArchetype() { return EnemyArchetypes::kShooter; }
+};
@@ -0,0 +1,274 @@
+#include "Sim/SimStageSolver.h"
+#include "System/JobSystem.h"
+#include "System/MapChipField.h"
+#include <algorithm>
+#include <deque>
+#include <numeric>
+#include <unordered_set>
+
+namespace {
+
+// 開始演出・ゴール演出を空入力で進めるときの最大フレーム数
+const uint32_t kMaxCutsceneFrames = 60 * 10;
+
+// 評価値で HP 1 あたりに上乗せする値（同じくらい進んでいるなら被弾していない方を残す）
+const float kHpWeight = 2.0f;
+// 同じマスの中で差をつけるため、直線距離に掛けて引く値
+const float kStraightDistanceWeight = 0.25f;
+
+// 同じ状態とみなす座標の細かさ（この値で割って丸める）
+const float kKeyCellSize = 0.5f;
+
+} // namespace
+
+SimInput SimStageSolver::MakeInput(uint8_t action, uint32_t frameInMacro) {
+	// 方向（なし/右/左）× ボタン（なし/ジャンプ/攻撃）
+	static const uint8_t kDirections[] = {0, static_cast<uint8_t>(SimButton::kRight), static_cast<uint8_t>(SimButton::kLeft)};
+	static const uint8_t kButtons[] = {0, static_cast<uint8_t>(SimButton::kJump), static_cast<uint8_t>(SimButton::kAttack)};
+	uint8_t button = kButtons[action / 3];
+
+	SimInput input;
+	input.held = kDirections[action % 3] | button;
+	input.triggered = (frameInMacro == 0) ? button : 0;
+	return input;
+}
+
+SimStageSolver::Result SimStageSolver::Solve(const MapChipField* mapChipField, int stageNo, const Settings& settings) {
+	Result result;
+	tree_.clear();
+
+	// --- 開始演出は入力を受け付けないので、空入力で kPlay まで進める ---
+	SimWorld startWorld;
+	startWorld.Initialize(mapChipField, stageNo);
+	std::vector<SimEvent> events;
+	introFrames_ = 0;
+	while (startWorld.GetPhase() != SimPhase::kPlay && introFrames_ < kMaxCutsceneFrames) {
+		events.clear();
+		startWorld.Step(SimInput{}, events);
+		++introFrames_;
+	}
+	const SimVector3 goalPosition = startWorld.GetGoalPosition();
+	mapChipField_ = mapChipField;
+	BuildGoalDistances(mapChipField, goalPosition);
+
+	// 現在の深さで残っている状態と、それに対応する探索木のノード（根は UINT32_MAX）
+	std::vector<SimWorld> beam(1, startWorld);
+	std::vector<uint32_t> beamNodes(1, UINT32_MAX);
+	// 展開先（確保した領域は深さをまたいで使い回す）
+	std::vector<SimWorld> children;
+	std::vector<SimWorld> nextBeam;
+	std::vector<Candidate> candidates;
+	std::vector<uint32_t> order;
+	std::unordered_set<uint64_t> visitedKeys;
+
+	uint32_t furthestNode = UINT32_MAX;
+	result.furthestPosition = startWorld.GetPlayer().GetTranslation();
+	result.furthestDistance = ToFloat(Length(goalPosition - result.furthestPosition));
+
+	uint32_t maxDepth = settings.maxFrames / (std::max)(settings.macroFrames, 1u);
+	for (uint32_t depth = 0; depth < maxDepth && !beam.empty(); ++depth) {
+		result.depth = depth + 1;
+
+		// --- 展開（各状態に 9 通りの行動を試す） ---
+		uint32_t childCount = static_cast<uint32_t>(beam.size()) * kActionCount;
+		if (children.size() < childCount) {
+			children.resize(childCount);
+		}
+		candidates.assign(childCount, Candidate{});
+		JobSystem::GetInstance()->ParallelFor(childCount, kExpandGrainSize, [&](uint32_t begin, uint32_t end) {
+			std::vector<SimEvent> childEvents;
+			for (uint32_t i = begin; i < end; ++i) {
+				SimWorld& world = children[i];
+				Candidate& candidate = candidates[i];
+				world = beam[i / kActionCount];
+				uint8_t action = static_cast<uint8_t>(i % kActionCount);
+
+				for (uint32_t frame = 0; frame < settings.macroFrames; ++frame) {
+					childEvents.clear();
+					world.Step(MakeInput(action, frame), childEvents);
+					candidate.frames = frame + 1;
+					if (world.GetPhase() == SimPhase::kGoalAnimation) {
+						candidate.isCleared = true;
+						break;
+					}
+					if (world.GetPhase() == SimPhase::kDeath || world.GetPlayer().GetIsDeadAnimating()) {
+						candidate.isDead = true;
+						break;
+					}
+				}
+
+				const SimPlayer& player = world.GetPlayer();
+				const SimVector3& position = player.GetTranslation();
+				candidate.score = Evaluate(world);
+
+				// 同じマス・同じ上下の向き・同じ HP の状態は1つだけ残す
+				SimReal velocityY = player.GetVelocity().y;
+				uint64_t velocityBucket = velocityY > 0.05f ? 2 : (velocityY < -0.05f ? 0 : 1);
+				uint64_t cellX = static_cast<uint16_t>(static_cast<int32_t>(position.x / kKeyCellSize));
+				uint64_t cellY = static_cast<uint16_t>(static_cast<int32_t>(position.y / kKeyCellSize));
+				candidate.key = (cellX << 32) | (cellY << 16) | (velocityBucket << 8) | static_cast<uint8_t>(player.GetHp());
+			}
+		});
+		result.expandedCount += childCount;
+
+		// --- クリアした候補があれば、この手の中で最も早くゴールしたもの（同じなら番号の小さいもの）を採用 ---
+		uint32_t clearedIndex = UINT32_MAX;
+		for (uint32_t i = 0; i < childCount; ++i) {
+			if (candidates[i].isCleared && (clearedIndex == UINT32_MAX || candidates[i].frames < candidates[clearedIndex].frames)) {
+				clearedIndex = i;
+			}
+		}
+		if (clearedIndex != UINT32_MAX) {
+			tree_.push_back({beamNodes[clearedIndex / kActionCount], static_cast<uint8_t>(clearedIndex % kActionCount), candidates[clearedIndex].frames});
+			result.isCleared = true;
+			result.playFrames = depth * settings.macroFrames + candidates[clearedIndex].frames;
+			result.furthestPosition = children[clearedIndex].GetPlayer().GetTranslation();
+			result.furthestDistance = 0.0f;
+			BuildRecording(static_cast<uint32_t>(tree_.size() - 1), stageNo, result);
+
+			// ゴール演出が終わるまで空入力を足し、再生したときにクリアまで進むようにする
+			SimWorld& world = children[clearedIndex];
+			for (uint32_t frame = 0; frame < kMaxCutsceneFrames && world.GetPhase() != SimPhase::kCleared; ++frame) {
+				events.clear();
+				world.Step(SimInput{}, events);
+				result.recording.Push(SimInput{});
+			}
+			return result;
+		}
+
+		// --- 評価値の高い順（同じなら番号順）に並べ、重複を除いて beamWidth 個残す ---
+		order.resize(childCount);
+		std::iota(order.begin(), order.end(), 0u);
+		std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+			if (candidates[a].score != candidates[b].score) {
+				return candidates[a].score > candidates[b].score;
+			}
+			return a < b;
+		});
+
+		visitedKeys.clear();
+		nextBeam.resize((std::min)(childCount, settings.beamWidth));
+		std::vector<uint32_t> nextBeamNodes;
+		for (uint32_t index : order) {
+			if (nextBeamNodes.size() >= settings.beamWidth) {
+				break;
+			}
+			const Candidate& candidate = candidates[index];
+			if (candidate.isDead || !visitedKeys.insert(candidate.key).second) {
+				continue;
+			}
+			tree_.push_back({beamNodes[index / kActionCount], static_cast<uint8_t>(index % kActionCount), settings.macroFrames});
+			std::swap(nextBeam[nextBeamNodes.size()], children[index]);
+			nextBeamNodes.push_back(static_cast<uint32_t>(tree_.size() - 1));
+		}
+		nextBeam.resize(nextBeamNodes.size());
+		std::swap(beam, nextBeam);
+		beamNodes = std::move(nextBeamNodes);
+
+		// 評価値が最も高い状態がこれまでで最もゴールに近ければ記録する
+		if (!beam.empty()) {
+			const SimVector3& position = beam[0].GetPlayer().GetTranslation();
+			float distance = ToFloat(Length(goalPosition - position));
+			if (distance < result.furthestDistance) {
+				furthestNode = beamNodes[0];
+				result.furthestPosition = position;
+				result.furthestDistance = distance;
+				result.playFrames = (depth + 1) * settings.macroFrames;
+			}
+		}
+	}
+
+	// クリアできなかったので、最もゴールに近づいた状態までの入力を返す
+	BuildRecording(furthestNode, stageNo, result);
+	return result;
+}
+
+void SimStageSolver::BuildGoalDistances(const MapChipField* mapChipField, const SimVector3& goalPosition) {
+	uint32_t width = mapChipField->GetNumBlockHorizontal();
+	uint32_t height = mapChipField->GetNumBlockVertical();
+	goalDistances_.assign(static_cast<size_t>(width) * height, UINT32_MAX);
+
+	MapChipField::IndexSet goal = mapChipField->GetMapChipIndexSetByPosition(goalPosition);
+	if (goal.xIndex >= width || goal.yIndex >= height) {
+		return;
+	}
+
+	// 一番下のブロックより下のマス（床の下の何もない空間）は、穴から落ちないと入れず落ちれば死亡するので通らない
+	uint32_t lowestBlockRow = 0;
+	for (uint32_t y = 0; y < height; ++y) {
+		for (uint32_t x = 0; x < width; ++x) {
+			if (mapChipField->GetMapChipTypeByIndex(x, y) == MapChipType::kBlock) {
+				lowestBlockRow = y;
+				break;
+			}
+		}
+	}
+
+	// 幅優先探索
+	std::deque<MapChipField::IndexSet> queue;
+	goalDistances_[goal.yIndex * width + goal.xIndex] = 0;
+	queue.push_back(goal);
+	while (!queue.empty()) {
+		MapChipField::IndexSet current = queue.front();
+		queue.pop_front();
+		uint32_t distance = goalDistances_[current.yIndex * width + current.xIndex];
+
+		const int32_t kOffsets[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+		for (const auto& offset : kOffsets) {
+			// 範囲外は符号なしの桁あふれで弾く
+			uint32_t x = current.xIndex + offset[0];
+			uint32_t y = current.yIndex + offset[1];
+			if (x >= width || y >= height || mapChipField->GetMapChipTypeByIndex(x, y) == MapChipType::kBlock) {
+				continue;
+			}
+			// 落ちたら死亡する高さのマスは通らない
+			if (y > lowestBlockRow || mapChipField->GetMapChipPositionByIndex(x, y).y < SimPlayer::kDeadlyHeight) {
+				continue;
+			}
+			uint32_t& neighbor = goalDistances_[y * width + x];
+			if (neighbor == UINT32_MAX) {
+				neighbor = distance + 1;
+				queue.push_back({x, y});
+			}
+		}
+	}
+}
+
+float SimStageSolver::Evaluate(const SimWorld& world) const {
+	const SimPlayer& player = world.GetPlayer();
+	const SimVector3& position = player.GetTranslation();
+	float straightDistance = ToFloat(Length(world.GetGoalPosition() - position));
+
+	// マスの距離（マップの外やたどり着けないマスは全マス分の距離とする）
+	uint32_t width = mapChipField_->GetNumBlockHorizontal();
+	uint32_t height = mapChipField_->GetNumBlockVertical();
+	uint32_t tileDistance = width * height;
+	MapChipField::IndexSet index = mapChipField_->GetMapChipIndexSetByPosition(position);
+	if (position.x >= 0.0f && position.y >= 0.0f && index.xIndex < width && index.yIndex < height) {
+		tileDistance = (std::min)(tileDistance, goalDistances_[index.yIndex * width + index.xIndex]);
+	}
+
+	// マスの距離はマップの単位（1マス = ブロック1個分の幅）に直す
+	float blockSize = ToFloat(mapChipField_->GetMapChipPositionByIndex(1, 0).x - mapChipField_->GetMapChipPositionByIndex(0, 0).x);
+	return -(tileDistance * blockSize + straightDistance * kStraightDistanceWeight) + player.GetHp() * kHpWeight;
+}
+
+void SimStageSolver::BuildRecording(uint32_t nodeIndex, int stageNo, Result& result) const {
+	// 根までたどってから逆順に並べる
+	std::vector<uint32_t> path;
+	for (uint32_t index = nodeIndex; index != UINT32_MAX; index = tree_[index].parent) {
+		path.push_back(index);
+	}
+	std::reverse(path.begin(), path.end());
+
+	result.recording.Start(stageNo);
+	for (uint32_t frame = 0; frame < introFrames_; ++frame) {
+		result.recording.Push(SimInput{});
+	}
+	for (uint32_t index : path) {
+		const TreeNode& node = tree_[index];
+		for (uint32_t frame = 0; frame < node.frames; ++frame) {
+			result.recording.Push(MakeInput(node.action, frame));
+		}
+	}
+}
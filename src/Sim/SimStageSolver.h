@@ -0,0 +1,105 @@
+#pragma once
+#include "Sim/InputRecording.h"
+#include "Sim/SimWorld.h"
+#include <cstdint>
+#include <vector>
+
+class MapChipField;
+
+/// <summary>
+/// ステージがクリアできるかを、入力列のビームサーチで確かめる
+/// 「方向（なし/右/左）× ボタン（なし/ジャンプ/攻撃）」の 9 通りの行動を一定フレームずつ続けたものを1手とし、
+/// 各深さでゴールに近い状態（ブロックを避けてマス伝いに測った距離で評価）だけを beamWidth 個残して次の手を試す。
+/// 状態の複製は SimWorld のコピー（確保済みの領域への代入なので割り当ては起きない）で行い、
+/// 1つの深さの展開は JobSystem で並列に行う（各候補は自分の枠にだけ書き込むので、結果はスレッド数によらない）
+/// </summary>
+class SimStageSolver {
+public:
+	// 設定
+	struct Settings {
+		// 各深さで残す状態の数
+		uint32_t beamWidth = 256;
+		// 1手で同じ入力を続けるフレーム数
+		uint32_t macroFrames = 6;
+		// 探索する最大フレーム数（開始演出を除く）
+		uint32_t maxFrames = 60 * 120;
+	};
+
+	// 結果
+	struct Result {
+		// クリアできたか
+		bool isCleared = false;
+		// クリアできた場合はクリアまでの入力、できなかった場合は最もゴールに近づいた状態までの入力
+		// （ステージ開始演出の空入力から始まるので、そのまま再生できる）
+		InputRecording recording;
+		// 最もゴールに近づいたときのプレイヤーの座標とゴールまでの距離
+		SimVector3 furthestPosition = {};
+		float furthestDistance = 0.0f;
+		// クリア（または最も近づいた状態）までのフレーム数（開始演出を除く）
+		uint32_t playFrames = 0;
+		// 探索した深さと展開した状態の数
+		uint32_t depth = 0;
+		uint64_t expandedCount = 0;
+	};
+
+	/// <summary>
+	/// 探索する
+	/// </summary>
+	/// <param name="mapChipField">読み込み済みのマップ</param>
+	/// <param name="stageNo">ステージ番号</param>
+	/// <param name="settings">設定</param>
+	/// <returns>結果</returns>
+	Result Solve(const MapChipField* mapChipField, int stageNo, const Settings& settings);
+
+	// 1手の行動の数
+	static inline const uint32_t kActionCount = 9;
+
+	// 1手の行動から1フレーム分の入力を作る（frameInMacro が 0 のときだけボタンを押した瞬間にする）
+	static SimInput MakeInput(uint8_t action, uint32_t frameInMacro);
+
+	// 並列展開の分割単位
+	static inline const uint32_t kExpandGrainSize = 8;
+
+private:
+	// 探索木の1ノード（入力列の復元用）
+	struct TreeNode {
+		uint32_t parent = UINT32_MAX;
+		uint8_t action = 0;
+		// この手の途中でクリアした場合の、その手の中でのフレーム数
+		uint32_t frames = 0;
+	};
+
+	// 展開した候補
+	struct Candidate {
+		float score = 0.0f;
+		uint64_t key = 0;
+		bool isDead = false;
+		bool isCleared = false;
+		uint32_t frames = 0;
+	};
+
+	/// <summary>
+	/// ゴールのマスから、ブロック以外のマスを上下左右にたどった距離（マス数）を全マスについて求める
+	/// （一番下のブロックより下のマスと、落ちたら死亡する高さのマスは通らない）
+	/// </summary>
+	void BuildGoalDistances(const MapChipField* mapChipField, const SimVector3& goalPosition);
+
+	/// <summary>
+	/// 状態の評価値（大きいほどゴールに近い）
+	/// </summary>
+	float Evaluate(const SimWorld& world) const;
+
+	/// <summary>
+	/// ノードまでの入力を記録に書き出す
+	/// </summary>
+	void BuildRecording(uint32_t nodeIndex, int stageNo, Result& result) const;
+
+	const MapChipField* mapChipField_ = nullptr;
+	// 各マスからゴールまでの距離（マス数。たどり着けないマスは UINT32_MAX）
+	std::vector<uint32_t> goalDistances_;
+
+	// 開始演出の空入力の数
+	uint32_t introFrames_ = 0;
+	// 全深さのノード
+	std::vector<TreeNode> tree_;
+};
@@ -0,0 +1,142 @@
+#include "Sim/SimStateHash.h"
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+namespace {
+
+void WriteU64(std::vector<uint8_t>& bytes, uint64_t value) {
+	for (uint32_t i = 0; i < 8; ++i) {
+		bytes.push_back(static_cast<uint8_t>(value >> (i * 8)));
+	}
+}
+
+uint64_t ReadU64(const uint8_t* bytes) {
+	uint64_t value = 0;
+	for (uint32_t i = 0; i < 8; ++i) {
+		value |= static_cast<uint64_t>(bytes[i]) << (i * 8);
+	}
+	return value;
+}
+
+// ヘッダの大きさ（識別子・バージョン・ステージ番号・ステップ数を 8 バイトずつ）
+const size_t kHeaderSize = 8 * 4;
+// 1ステップ分の大きさ
+const size_t kStepSize = 8 * static_cast<size_t>(SimHashField::kCount);
+
+} // namespace
+
+const char* ToString(SimHashField field) {
+	switch (field) {
+	case SimHashField::kPhase:
+		return "phase";
+	case SimHashField::kPlayer:
+		return "player";
+	case SimHashField::kEnemies:
+		return "enemies";
+	case SimHashField::kChasingEnemies:
+		return "chasingEnemies";
+	case SimHashField::kShooterEnemies:
+		return "shooterEnemies";
+	case SimHashField::kProjectiles:
+		return "projectiles";
+	case SimHashField::kCount:
+		return "length";
+	}
+	return "unknown";
+}
+
+uint64_t SimStateHash::Combined() const {
+	SimHasher hasher;
+	for (uint64_t field : fields) {
+		hasher.Add(field);
+	}
+	return hasher.Finish();
+}
+
+void SimHashLog::Start(int stageNo) {
+	stageNo_ = stageNo;
+	hashes_.clear();
+}
+
+bool SimHashLog::SaveToFile(const std::string& filePath) const {
+	std::vector<uint8_t> bytes;
+	bytes.reserve(kHeaderSize + kStepSize * hashes_.size());
+
+	// --- ヘッダ ---
+	WriteU64(bytes, kMagic);
+	WriteU64(bytes, kVersion);
+	WriteU64(bytes, static_cast<uint64_t>(stageNo_));
+	WriteU64(bytes, hashes_.size());
+
+	// --- 本体 ---
+	for (const SimStateHash& hash : hashes_) {
+		for (uint64_t field : hash.fields) {
+			WriteU64(bytes, field);
+		}
+	}
+
+	std::ofstream file(filePath, std::ios::binary);
+	if (!file.is_open()) {
+		return false;
+	}
+	file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+	return file.good();
+}
+
+bool SimHashLog::LoadFromFile(const std::string& filePath) {
+	hashes_.clear();
+
+	std::ifstream file(filePath, std::ios::binary);
+	if (!file.is_open()) {
+		return false;
+	}
+	std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+	// --- ヘッダ ---
+	if (bytes.size() < kHeaderSize || ReadU64(&bytes[0]) != kMagic || ReadU64(&bytes[8]) != kVersion) {
+		return false;
+	}
+	uint64_t stepCount = ReadU64(&bytes[24]);
+	// 途中で切れた記録が残っていれば壊れている
+	if ((bytes.size() - kHeaderSize) % kStepSize != 0 || (bytes.size() - kHeaderSize) / kStepSize != stepCount) {
+		return false;
+	}
+	stageNo_ = static_cast<int>(ReadU64(&bytes[16]));
+
+	// --- 本体 ---
+	hashes_.resize(static_cast<size_t>(stepCount));
+	const uint8_t* cursor = bytes.data() + kHeaderSize;
+	for (SimStateHash& hash : hashes_) {
+		for (uint64_t& field : hash.fields) {
+			field = ReadU64(cursor);
+			cursor += 8;
+		}
+	}
+	return true;
+}
+
+bool SimHashLog::FindFirstMismatch(const SimHashLog& other, SimHashMismatch& outMismatch) const {
+	size_t count = std::min(hashes_.size(), other.hashes_.size());
+	for (size_t step = 0; step < count; ++step) {
+		if (hashes_[step] == other.hashes_[step]) {
+			continue;
+		}
+		// 前の区分ほど他の区分へ影響しやすいので、最初にずれた区分を報告する
+		for (size_t field = 0; field < static_cast<size_t>(SimHashField::kCount); ++field) {
+			if (hashes_[step].fields[field] != other.hashes_[step].fields[field]) {
+				outMismatch.step = static_cast<uint32_t>(step);
+				outMismatch.field = static_cast<SimHashField>(field);
+				return true;
+			}
+		}
+	}
+
+	// 共通部分は一致していて長さだけが違う
+	if (hashes_.size() != other.hashes_.size()) {
+		outMismatch.step = static_cast<uint32_t>(count);
+		outMismatch.field = SimHashField::kCount;
+		return true;
+	}
+	return false;
+}
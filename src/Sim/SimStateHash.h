@@ -0,0 +1,196 @@
+#pragma once
+#include "Sim/SimMath.h"
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/// <summary>
+/// シミュレーション状態のハッシュを取るときの区分
+/// 不一致が見つかったとき、どの区分がずれたかを報告するのに使う
+/// </summary>
+enum class SimHashField : uint8_t {
+	kPhase,          // フェーズ・演出タイマー・フレーム数
+	kPlayer,         // プレイヤー
+	kEnemies,        // 歩行する敵
+	kChasingEnemies, // 追尾する敵
+	kShooterEnemies, // 弾を撃つ敵（本体）
+	kProjectiles,    // 弾
+	kCount,          // 要素数
+};
+
+/// <summary>
+/// 区分の名前を取得
+/// </summary>
+const char* ToString(SimHashField field);
+
+/// <summary>
+/// 64ビットの逐次ハッシュ（xxHash64 と同じく 32 バイトを4レーンに分けて並行に混ぜる）
+/// 値は 32 ビット単位で詰め、32 バイトたまるごとに処理する
+/// float（固定小数点のときは内部表現）はビット列をそのまま入れるので、同じ計算をした結果でなければ一致しない
+/// </summary>
+class SimHasher {
+public:
+	explicit SimHasher(uint64_t seed = 0) : lanes_{seed + kPrime1 + kPrime2, seed + kPrime2, seed, seed - kPrime1} {}
+
+	void Add(uint32_t value) {
+		words_[wordCount_++] = value;
+		if (wordCount_ == kStripeWords) {
+			ConsumeStripe();
+		}
+	}
+	void Add(uint64_t value) {
+		Add(static_cast<uint32_t>(value));
+		Add(static_cast<uint32_t>(value >> 32));
+	}
+	void Add(int value) { Add(static_cast<uint32_t>(value)); }
+	void Add(bool value) { Add(static_cast<uint32_t>(value ? 1 : 0)); }
+	void Add(float value) { Add(std::bit_cast<uint32_t>(value)); }
+#ifdef SIM_FIXED_POINT
+	void Add(SimFixed value) { Add(static_cast<uint32_t>(value.GetRaw())); }
+#endif
+	void Add(const SimVector3& value) {
+		Add(value.x);
+		Add(value.y);
+		Add(value.z);
+	}
+	template<typename Enum>
+	    requires std::is_enum_v<Enum>
+	void Add(Enum value) {
+		Add(static_cast<uint32_t>(value));
+	}
+
+	/// <summary>
+	/// ハッシュ値を取得（レーンをまとめ、残りの値を混ぜてからビットを攪拌する）
+	/// </summary>
+	uint64_t Finish() const {
+		uint64_t h = std::rotl(lanes_[0], 1) + std::rotl(lanes_[1], 7) + std::rotl(lanes_[2], 12) + std::rotl(lanes_[3], 18);
+		for (uint64_t lane : lanes_) {
+			h = (h ^ Round(0, lane)) * kPrime1 + kPrime4;
+		}
+		h += totalWords_ * 4 + wordCount_ * 4;
+		for (uint32_t i = 0; i < wordCount_; ++i) {
+			h ^= words_[i] * kPrime1;
+			h = std::rotl(h, 23) * kPrime2 + kPrime3;
+		}
+		h ^= h >> 33;
+		h *= kPrime2;
+		h ^= h >> 29;
+		h *= kPrime3;
+		h ^= h >> 32;
+		return h;
+	}
+
+private:
+	static constexpr uint64_t kPrime1 = 0x9E3779B185EBCA87ull;
+	static constexpr uint64_t kPrime2 = 0xC2B2AE3D27D4EB4Full;
+	static constexpr uint64_t kPrime3 = 0x165667B19E3779F9ull;
+	static constexpr uint64_t kPrime4 = 0x85EBCA77C2B2AE63ull;
+	// 1回に処理する 32 ビット値の数（32 バイト）
+	static constexpr uint32_t kStripeWords = 8;
+
+	static uint64_t Round(uint64_t acc, uint64_t input) { return std::rotl(acc + input * kPrime2, 31) * kPrime1; }
+
+	// たまった 32 バイトを4レーンへ混ぜる（レーン同士は依存しないので並行に計算される）
+	void ConsumeStripe() {
+		for (uint32_t lane = 0; lane < 4; ++lane) {
+			uint64_t input = static_cast<uint64_t>(words_[lane * 2]) | (static_cast<uint64_t>(words_[lane * 2 + 1]) << 32);
+			lanes_[lane] = Round(lanes_[lane], input);
+		}
+		totalWords_ += kStripeWords;
+		wordCount_ = 0;
+	}
+
+	std::array<uint64_t, 4> lanes_;
+	std::array<uint32_t, kStripeWords> words_ = {};
+	uint32_t wordCount_ = 0;
+	uint64_t totalWords_ = 0;
+};
+
+/// <summary>
+/// 1ステップ分の状態ハッシュ（区分ごと）
+/// </summary>
+struct SimStateHash {
+	std::array<uint64_t, static_cast<size_t>(SimHashField::kCount)> fields = {};
+
+	uint64_t& operator[](SimHashField field) { return fields[static_cast<size_t>(field)]; }
+	uint64_t operator[](SimHashField field) const { return fields[static_cast<size_t>(field)]; }
+
+	/// <summary>
+	/// 全区分をまとめた1つの値
+	/// </summary>
+	uint64_t Combined() const;
+
+	bool operator==(const SimStateHash& other) const = default;
+};
+
+/// <summary>
+/// 2つのハッシュ列が最初にずれた場所
+/// </summary>
+struct SimHashMismatch {
+	// ずれたステップ（0始まり）
+	uint32_t step = 0;
+	// ずれた区分（長さだけが違う場合は kCount）
+	SimHashField field = SimHashField::kCount;
+};
+
+/// <summary>
+/// 1プレイ分の状態ハッシュ列（1ステップにつき1件）
+/// ファイルにはヘッダ（識別子・バージョン・ステージ番号・ステップ数）の後に、
+/// 各ステップの区分ごとのハッシュをリトルエンディアンで並べて保存する
+/// </summary>
+class SimHashLog {
+public:
+	// ファイルの識別子 "AL4H"
+	static inline const uint32_t kMagic = 0x48344C41;
+	// 形式のバージョン（区分や形式、同じ入力から出るハッシュの値を変えたら上げる）
+	// 2: sin/cos を FastMath に変えて、プレイヤー・敵のスケールや傾きの値が変わった
+	static inline const uint32_t kVersion = 2;
+
+	/// <summary>
+	/// 記録を空にして新しく開始する
+	/// </summary>
+	void Start(int stageNo);
+
+	/// <summary>
+	/// 1ステップ分のハッシュを追加する
+	/// </summary>
+	void Push(const SimStateHash& hash) { hashes_.push_back(hash); }
+
+	/// <summary>
+	/// 先頭から stepCount ステップ分だけを残す（ロールバックで巻き戻したステップを取り消す）
+	/// </summary>
+	void Truncate(size_t stepCount) {
+		if (stepCount < hashes_.size()) {
+			hashes_.resize(stepCount);
+		}
+	}
+
+	/// <summary>
+	/// ファイルへ保存する
+	/// </summary>
+	bool SaveToFile(const std::string& filePath) const;
+
+	/// <summary>
+	/// ファイルから読み込む（形式が不正なら false を返し、中身は空になる）
+	/// </summary>
+	bool LoadFromFile(const std::string& filePath);
+
+	/// <summary>
+	/// 他のハッシュ列と比べ、最初にずれた場所を探す
+	/// </summary>
+	/// <param name="other">比べる相手</param>
+	/// <param name="outMismatch">ずれた場所（一致したときは変更しない）</param>
+	/// <returns>ずれていたら true</returns>
+	bool FindFirstMismatch(const SimHashLog& other, SimHashMismatch& outMismatch) const;
+
+	int GetStageNo() const { return stageNo_; }
+	const std::vector<SimStateHash>& GetHashes() const { return hashes_; }
+	size_t GetStepCount() const { return hashes_.size(); }
+
+private:
+	int stageNo_ = 1;
+	std::vector<SimStateHash> hashes_;
+};
@@ -0,0 +1,369 @@
+#include "Sim/SimWorld.h"
+#include "System/GameTime.h"
+#include "System/JobSystem.h"
+#include "System/MapChipField.h"
+
+void SimWorld::Initialize(const MapChipField* mapChipField, int stageNo) {
+	mapChipField_ = mapChipField;
+	stageNo_ = stageNo;
+	frameCount_ = 0;
+
+	// 敵の生成、プレイヤーの配置などを実行
+	Reset();
+
+	// Reset ではリトライ用に FadeIn になるが、
+	// ステージ開始時は「ステージ番号表示演出」を行いたいので上書きする
+	phase_ = SimPhase::kStageStart;
+}
+
+void SimWorld::Reset() {
+	// --- 1. プレイヤーの再配置と初期化 ---
+	SimVector3 playerPosition = mapChipField_->GetMapChipPositionByIndex(1, 9); // フォールバック
+
+	MapChipField::IndexSet startIdx;
+	if (mapChipField_->FindFirstIndexByType(MapChipType::kPlayerStart, startIdx)) {
+		playerPosition = mapChipField_->GetMapChipPositionByIndex(startIdx.xIndex, startIdx.yIndex);
+	}
+
+	player_.Initialize(mapChipField_, playerPosition);
+
+	// --- 2. 敵の全削除と再生成 ---
+	enemies_.clear();
+	chasingEnemies_.clear();
+	shooterEnemies_.clear();
+
+	// マップから敵を生成
+	for (uint32_t y = 0; y < mapChipField_->GetNumBlockVertical(); ++y) {
+		for (uint32_t x = 0; x < mapChipField_->GetNumBlockHorizontal(); ++x) {
+			MapChipType t = mapChipField_->GetMapChipTypeByIndex(x, y);
+			if (t == MapChipType::kEnemy) {
+				SimVector3 enemyPosition = mapChipField_->GetMapChipPositionByIndex(x, y);
+				SimEnemy& newEnemy = enemies_.emplace_back();
+				newEnemy.Initialize(mapChipField_, enemyPosition);
+				newEnemy.SetSpawnIndex(mapChipField_->GetMapChipIndexSetByPosition(enemyPosition));
+			} else if (t == MapChipType::kChasingEnemy) {
+				SimVector3 enemyPosition = mapChipField_->GetMapChipPositionByIndex(x, y);
+				SimChasingEnemy& newEnemy = chasingEnemies_.emplace_back();
+				newEnemy.Initialize(enemyPosition);
+			} else if (t == MapChipType::kShooter) {
+				SimVector3 enemyPosition = mapChipField_->GetMapChipPositionByIndex(x, y);
+				SimShooterEnemy& newEnemy = shooterEnemies_.emplace_back();
+				newEnemy.Initialize(mapChipField_, enemyPosition);
+			}
+		}
+	}
+
+	// --- 3. ゴールのリセット ---
+	// 全マップを走査して kGoal を探し、見つかった中で「最も右側(x 最大)」を採用する
+	bool foundGoal = false;
+	MapChipField::IndexSet bestGoalIdx = {0, 0};
+	for (uint32_t y = 0; y < mapChipField_->GetNumBlockVertical(); ++y) {
+		for (uint32_t x = 0; x < mapChipField_->GetNumBlockHorizontal(); ++x) {
+			if (mapChipField_->GetMapChipTypeByIndex(x, y) == MapChipType::kGoal) {
+				if (!foundGoal || x > bestGoalIdx.xIndex || (x == bestGoalIdx.xIndex && y > bestGoalIdx.yIndex)) {
+					bestGoalIdx.xIndex = x;
+					bestGoalIdx.yIndex = y;
+					foundGoal = true;
+				}
+			}
+		}
+	}
+
+	if (foundGoal) {
+		goalPosition_ = mapChipField_->GetMapChipPositionByIndex(bestGoalIdx.xIndex, bestGoalIdx.yIndex);
+	} else {
+		// 互換性のために従来のフォールバック（ステージによる固定位置）を残す
+		switch (stageNo_) {
+		case 1:
+			goalPosition_ = mapChipField_->GetMapChipPositionByIndex(49, 3);
+			break;
+		case 2:
+		case 3:
+			goalPosition_ = mapChipField_->GetMapChipPositionByIndex(37, 10);
+			break;
+		default:
+			goalPosition_ = mapChipField_->GetMapChipPositionByIndex(5, 4);
+			break;
+		}
+	}
+
+	// --- 4. フェーズのリセット ---
+	// デフォルトではリトライ用のフェードイン
+	phase_ = SimPhase::kFadeIn;
+	stageStartTimer_ = 0.0f;
+	phaseTimer_ = 0.0f;
+}
+
+void SimWorld::Step(const SimInput& input, std::vector<SimEvent>& events) {
+	++frameCount_;
+
+	// リスタートはフェーズに関係なく最優先で処理する
+	if (input.IsTriggered(SimButton::kRestart)) {
+		Reset();
+		events.push_back({.type = SimEventType::kReset, .phase = phase_, .position = player_.GetTranslation()});
+		return;
+	}
+
+	switch (phase_) {
+	case SimPhase::kStageStart:
+		// ステージ開始演出（暗転＆番号表示）
+		stageStartTimer_ += GameTime::GetDeltaTime();
+
+		// 3秒経過したらフェードイン開始
+		if (stageStartTimer_ >= kStageStartDuration) {
+			ChangePhase(SimPhase::kFadeIn, events);
+		}
+		break;
+
+	case SimPhase::kFadeIn:
+		if (AdvancePhaseTimer(kFadeDuration)) {
+			ChangePhase(SimPhase::kPlay, events);
+		}
+		break;
+
+	case SimPhase::kPlay:
+		UpdatePlay(input, events);
+		break;
+
+	case SimPhase::kGoalAnimation:
+		// プレイヤーの演出更新（重力などは演出内で制御）
+		player_.UpdateGoalAnimation();
+
+		// プレイヤーの演出が終わったらフェードアウトへ
+		if (player_.GetGoalAnimationPhase() == GoalAnimationPhase::kEnd) {
+			ChangePhase(SimPhase::kFadeOut, events);
+		}
+		break;
+
+	case SimPhase::kDeath:
+		if (AdvancePhaseTimer(kDeathEffectDuration)) {
+			ChangePhase(SimPhase::kDeathFadeOut, events);
+		}
+		break;
+
+	case SimPhase::kDeathFadeOut:
+		if (AdvancePhaseTimer(kFadeDuration)) {
+			Reset();
+			events.push_back({.type = SimEventType::kReset, .phase = phase_, .position = player_.GetTranslation()});
+		}
+		break;
+
+	case SimPhase::kFadeOut:
+		if (AdvancePhaseTimer(kFadeDuration)) {
+			ChangePhase(SimPhase::kCleared, events);
+		}
+		break;
+
+	case SimPhase::kCleared:
+		break;
+	}
+}
+
+void SimWorld::UpdatePlay(const SimInput& input, std::vector<SimEvent>& events) {
+	if (input.IsTriggered(SimButton::kReset)) {
+		Reset();
+		events.push_back({.type = SimEventType::kReset, .phase = phase_, .position = player_.GetTranslation()});
+		return;
+	}
+
+	SimVector3 gravityVector = {0.0f, -SimPlayer::GetGravityAcceleration(), 0.0f};
+
+	// タイムスケールの計算
+	float timeScale = 1.0f; // 通常は1倍速
+	if (player_.GetIsDeadAnimating()) {
+		timeScale = 0.2f; // 死亡演出中は0.2倍速（スローモーション）
+	}
+
+	player_.Update(input, gravityVector, timeScale, events);
+
+	// 近接攻撃が発生していたら、範囲内の敵を倒す
+	AABB meleeHitBox;
+	if (player_.TakeMeleeHitBox(meleeHitBox)) {
+		for (SimEnemy& enemy : enemies_) {
+			if (enemy.GetIsAlive() && IsColliding(meleeHitBox, enemy.GetAABB())) {
+				enemy.SetIsAlive(false);
+			}
+		}
+		for (SimChasingEnemy& enemy : chasingEnemies_) {
+			if (enemy.GetIsAlive() && IsColliding(meleeHitBox, enemy.GetAABB())) {
+				enemy.SetIsAlive(false);
+			}
+		}
+		for (SimShooterEnemy& enemy : shooterEnemies_) {
+			if (enemy.GetIsAlive() && IsColliding(meleeHitBox, enemy.GetAABB())) {
+				enemy.SetIsAlive(false);
+			}
+		}
+	}
+
+	// 敵の更新は互いに独立しているので並列に行う（各敵は自分のデータだけを書き換える）
+	const SimVector3 playerPosition = player_.GetTranslation();
+	JobSystem* jobSystem = JobSystem::GetInstance();
+	jobSystem->ParallelForEach(enemies_, kEntityGrainSize, [](SimEnemy& enemy) { enemy.Update(); });
+	jobSystem->ParallelForEach(chasingEnemies_, kEntityGrainSize, [playerPosition](SimChasingEnemy& enemy) { enemy.Update(playerPosition); });
+	jobSystem->ParallelForEach(shooterEnemies_, kEntityGrainSize, [](SimShooterEnemy& enemy) { enemy.Update(); });
+
+	// 更新中に要求されたSEはリスト順にイベントにする（単一スレッド実行と同じ順序になる）
+	for (SimChasingEnemy& enemy : chasingEnemies_) {
+		if (enemy.TakeDeathSoundRequest()) {
+			events.push_back({.type = SimEventType::kEnemyDeath, .position = enemy.GetHotState().translation});
+		}
+	}
+
+	CheckAllCollisions(events);
+
+	// プレイヤーが死亡したらデス演出へ
+	if (phase_ == SimPhase::kPlay && !player_.GetIsAlive()) {
+		ChangePhase(SimPhase::kDeath, events);
+	}
+}
+
+/// <summary>
+/// aabb と各対象の交差判定を並列に行い、結果を hits に書き込む
+/// 応答（状態の書き換え）は呼び出し側がリスト順に行うので、結果は単一スレッド実行と一致する
+/// </summary>
+template<typename T>
+static void CollectCollisionHits(const std::vector<T>& targets, const AABB& aabb, bool requireAlive, uint32_t grainSize, std::vector<uint8_t>& hits) {
+	hits.assign(targets.size(), 0);
+	JobSystem::GetInstance()->ParallelFor(static_cast<uint32_t>(targets.size()), grainSize, [&](uint32_t begin, uint32_t end) {
+		for (uint32_t i = begin; i < end; ++i) {
+			if (requireAlive && !targets[i].GetIsAlive()) {
+				continue;
+			}
+			hits[i] = IsColliding(aabb, targets[i].GetAABB()) ? 1 : 0;
+		}
+	});
+}
+
+void SimWorld::CheckAllCollisions(std::vector<SimEvent>& events) {
+	AABB aabb1, aabb2;
+
+	if (player_.GetIsInvincible() == false) {
+		aabb1 = player_.GetAABB();
+
+		CollectCollisionHits(enemies_, aabb1, true, kCollisionGrainSize, collisionHits_);
+		for (size_t i = 0; i < enemies_.size(); ++i) {
+			if (player_.GetIsAlive() && collisionHits_[i]) {
+				player_.OnCollision(enemies_[i].GetHotState().translation, events);
+			}
+		}
+
+		CollectCollisionHits(chasingEnemies_, aabb1, true, kCollisionGrainSize, collisionHits_);
+		for (size_t i = 0; i < chasingEnemies_.size(); ++i) {
+			if (player_.GetIsAlive() && collisionHits_[i]) {
+				player_.OnCollision(chasingEnemies_[i].GetHotState().translation, events);
+			}
+		}
+
+		for (SimShooterEnemy& enemy : shooterEnemies_) {
+			if (player_.GetIsAlive() && enemy.GetIsAlive()) {
+				aabb2 = enemy.GetAABB();
+				if (IsColliding(aabb1, aabb2)) {
+					player_.OnCollision(enemy.GetHotState().translation, events);
+				}
+
+				for (SimProjectile& projectile : enemy.GetProjectiles()) {
+					if (projectile.IsAlive()) {
+						aabb2 = projectile.GetAABB();
+						if (IsColliding(aabb1, aabb2)) {
+							player_.OnCollision(projectile.GetWorldPosition(), events);
+							projectile.OnCollision();
+						}
+					}
+				}
+			}
+		}
+	}
+
+	if (player_.GetIsAttacking() == true) {
+		aabb1 = player_.GetAABB();
+		CollectCollisionHits(enemies_, aabb1, false, kCollisionGrainSize, collisionHits_);
+		for (size_t i = 0; i < enemies_.size(); ++i) {
+			if (collisionHits_[i]) {
+				enemies_[i].SetIsAlive(false);
+			}
+		}
+		CollectCollisionHits(chasingEnemies_, aabb1, false, kCollisionGrainSize, collisionHits_);
+		for (size_t i = 0; i < chasingEnemies_.size(); ++i) {
+			if (collisionHits_[i]) {
+				chasingEnemies_[i].SetIsAlive(false);
+			}
+		}
+		CollectCollisionHits(shooterEnemies_, aabb1, false, kCollisionGrainSize, collisionHits_);
+		for (size_t i = 0; i < shooterEnemies_.size(); ++i) {
+			if (collisionHits_[i]) {
+				shooterEnemies_[i].SetIsAlive(false);
+			}
+		}
+	}
+
+	aabb1 = player_.GetAABB();
+	aabb2.min = {goalPosition_.x - (kGoalWidth / 2.0f), goalPosition_.y - (kGoalHeight / 2.0f), goalPosition_.z - (kGoalWidth / 2.0f)};
+	aabb2.max = {goalPosition_.x + (kGoalWidth / 2.0f), goalPosition_.y + (kGoalHeight / 2.0f), goalPosition_.z + (kGoalWidth / 2.0f)};
+
+	// 死亡演出中や既に死亡状態のときはゴール判定を無視する
+	if (IsColliding(aabb1, aabb2)) {
+		if (phase_ == SimPhase::kPlay && player_.GetIsAlive() && !player_.GetIsDeadAnimating()) {
+			player_.StartGoalAnimation();
+			ChangePhase(SimPhase::kGoalAnimation, events);
+		}
+	}
+}
+
+SimStateHash SimWorld::ComputeStateHash() const {
+	SimStateHash hash;
+
+	SimHasher phaseHasher;
+	phaseHasher.Add(phase_);
+	phaseHasher.Add(stageStartTimer_);
+	phaseHasher.Add(phaseTimer_);
+	phaseHasher.Add(frameCount_);
+	phaseHasher.Add(goalPosition_);
+	hash[SimHashField::kPhase] = phaseHasher.Finish();
+
+	SimHasher playerHasher;
+	player_.Hash(playerHasher);
+	hash[SimHashField::kPlayer] = playerHasher.Finish();
+
+	// 敵は数も入れる（生成・削除のずれも検出するため）
+	SimHasher enemyHasher;
+	enemyHasher.Add(static_cast<uint64_t>(enemies_.size()));
+	for (const SimEnemy& enemy : enemies_) {
+		enemy.GetHotState().Hash(enemyHasher);
+	}
+	hash[SimHashField::kEnemies] = enemyHasher.Finish();
+
+	SimHasher chasingHasher;
+	chasingHasher.Add(static_cast<uint64_t>(chasingEnemies_.size()));
+	for (const SimChasingEnemy& enemy : chasingEnemies_) {
+		enemy.GetHotState().Hash(chasingHasher);
+	}
+	hash[SimHashField::kChasingEnemies] = chasingHasher.Finish();
+
+	SimHasher shooterHasher;
+	SimHasher projectileHasher;
+	shooterHasher.Add(static_cast<uint64_t>(shooterEnemies_.size()));
+	for (const SimShooterEnemy& enemy : shooterEnemies_) {
+		enemy.GetHotState().Hash(shooterHasher);
+		projectileHasher.Add(static_cast<uint64_t>(enemy.GetProjectiles().size()));
+		for (const SimProjectile& projectile : enemy.GetProjectiles()) {
+			projectile.Hash(projectileHasher);
+		}
+	}
+	hash[SimHashField::kShooterEnemies] = shooterHasher.Finish();
+	hash[SimHashField::kProjectiles] = projectileHasher.Finish();
+
+	return hash;
+}
+
+void SimWorld::ChangePhase(SimPhase phase, std::vector<SimEvent>& events) {
+	phase_ = phase;
+	phaseTimer_ = 0.0f;
+	events.push_back({.type = SimEventType::kPhaseChanged, .phase = phase, .position = player_.GetTranslation()});
+}
+
+bool SimWorld::AdvancePhaseTimer(float duration) {
+	// フェード・パーティクルと同じく、1ステップ分ずつ加算して判定する
+	phaseTimer_ += GameTime::GetDeltaTime();
+	return phaseTimer_ >= duration;
+}
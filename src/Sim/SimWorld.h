@@ -0,0 +1,113 @@
+#pragma once
+#include "Sim/SimChasingEnemy.h"
+#include "Sim/SimEnemy.h"
+#include "Sim/SimEvent.h"
+#include "Sim/SimInput.h"
+#include "Sim/SimPlayer.h"
+#include "Sim/SimShooterEnemy.h"
+#include "Sim/SimStateHash.h"
+#include "System/Collision.h"
+#include <cstdint>
+#include <vector>
+
+class MapChipField;
+
+/// <summary>
+/// 1ステージ分のゲームシミュレーション
+/// プレイヤー・敵・ゴールとフェーズ遷移を持ち、入力を受け取って1フレームずつ進める。
+/// エンジン（描画・音・入力デバイス）には依存しないので、ヘッドレスでも実行できる
+/// </summary>
+class SimWorld {
+public:
+	/// <summary>
+	/// 初期化（ステージ開始演出から始める）
+	/// </summary>
+	/// <param name="mapChipField">読み込み済みのマップ（SimWorld より長く生存すること）</param>
+	/// <param name="stageNo">ステージ番号（ゴールが見つからないときの配置に使う）</param>
+	void Initialize(const MapChipField* mapChipField, int stageNo);
+
+	/// <summary>
+	/// プレイヤー・敵・ゴールを配置し直し、フェードインから再開する
+	/// </summary>
+	void Reset();
+
+	/// <summary>
+	/// 1フレーム進める
+	/// </summary>
+	/// <param name="input">このフレームの入力</param>
+	/// <param name="events">発行したイベントの追加先（呼び出し側でクリアすること）</param>
+	void Step(const SimInput& input, std::vector<SimEvent>& events);
+
+	/// <summary>
+	/// 現在の状態のハッシュを区分ごとに計算する（決定性の確認用）
+	/// </summary>
+	SimStateHash ComputeStateHash() const;
+
+	SimPhase GetPhase() const { return phase_; }
+	int GetStageNo() const { return stageNo_; }
+	// 経過フレーム数（Initialize からの通算）
+	uint32_t GetFrameCount() const { return frameCount_; }
+
+	const SimPlayer& GetPlayer() const { return player_; }
+	const std::vector<SimEnemy>& GetEnemies() const { return enemies_; }
+	const std::vector<SimChasingEnemy>& GetChasingEnemies() const { return chasingEnemies_; }
+	const std::vector<SimShooterEnemy>& GetShooterEnemies() const { return shooterEnemies_; }
+	const SimVector3& GetGoalPosition() const { return goalPosition_; }
+
+	// ゴールの当たり判定サイズ
+	static inline const float kGoalWidth = 1.0f;
+	static inline const float kGoalHeight = 1.0f;
+
+	// ステージ開始演出の時間（秒）
+	static inline const float kStageStartDuration = 3.0f;
+	// フェードの時間（秒）
+	static inline const float kFadeDuration = 1.0f;
+	// デス演出（パーティクル）の時間（秒）
+	static inline const float kDeathEffectDuration = 1.0f;
+
+	// --- 並列更新（JobSystem）の分割単位 ---
+	// 敵の更新
+	static inline const uint32_t kEntityGrainSize = 16;
+	// 当たり判定
+	static inline const uint32_t kCollisionGrainSize = 32;
+
+private:
+	/// <summary>
+	/// kPlay 中の更新
+	/// </summary>
+	void UpdatePlay(const SimInput& input, std::vector<SimEvent>& events);
+
+	/// <summary>
+	/// 当たり判定と応答
+	/// </summary>
+	void CheckAllCollisions(std::vector<SimEvent>& events);
+
+	/// <summary>
+	/// フェーズを切り替えてイベントを発行する
+	/// </summary>
+	void ChangePhase(SimPhase phase, std::vector<SimEvent>& events);
+
+	/// <summary>
+	/// 演出の時間を進め、終わったら true を返す
+	/// </summary>
+	bool AdvancePhaseTimer(float duration);
+
+	const MapChipField* mapChipField_ = nullptr;
+	int stageNo_ = 1;
+
+	SimPlayer player_;
+	std::vector<SimEnemy> enemies_;
+	std::vector<SimChasingEnemy> chasingEnemies_;
+	std::vector<SimShooterEnemy> shooterEnemies_;
+	SimVector3 goalPosition_ = {};
+
+	SimPhase phase_ = SimPhase::kStageStart;
+	// ステージ開始時のタイマー
+	float stageStartTimer_ = 0.0f;
+	// フェード・デス演出のタイマー
+	float phaseTimer_ = 0.0f;
+	uint32_t frameCount_ = 0;
+
+	// 並列判定の結果バッファ（vector<bool> はビット詰めで同時書き込みできないので uint8_t）
+	std::vector<uint8_t> collisionHits_;
+};
@@ -1,9 +1,19 @@
 #pragma once
-#include "KamataEngine.h"
+#include "Sim/SimMath.h"
 /// <summary>
 /// AABB (Axis-Aligned Bounding Box)
 /// </summary>
 struct AABB {
-	KamataEngine::Vector3 min; // 最小点
-	KamataEngine::Vector3 max; // 最大点
+	SimVector3 min; // 最小点
+	SimVector3 max; // 最大点
 };
+
+/// <summary>
+/// AABB同士の交差判定
+/// </summary>
+inline bool IsColliding(const AABB& aabb1, const AABB& aabb2) {
+	if ((aabb1.min.x <= aabb2.max.x && aabb1.max.x >= aabb2.min.x) && (aabb1.min.y <= aabb2.max.y && aabb1.max.y >= aabb2.min.y) && (aabb1.min.z <= aabb2.max.z && aabb1.max.z >= aabb2.min.z)) {
+		return true;
+	}
+	return false;
+}
@@ -0,0 +1,48 @@
+#include "FrameWorker.h"
+
+FrameWorker::FrameWorker() { thread_ = std::thread(&FrameWorker::ThreadMain, this); }
+
+FrameWorker::~FrameWorker() {
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		isRunning_ = false;
+	}
+	condition_.notify_all();
+	thread_.join();
+}
+
+void FrameWorker::Kick(std::function<void()> task) {
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		task_ = std::move(task);
+		hasTask_ = true;
+	}
+	condition_.notify_all();
+}
+
+void FrameWorker::Wait() {
+	std::unique_lock<std::mutex> lock(mutex_);
+	condition_.wait(lock, [this] { return !hasTask_; });
+}
+
+void FrameWorker::ThreadMain() {
+	while (true) {
+		std::function<void()> task;
+		{
+			std::unique_lock<std::mutex> lock(mutex_);
+			condition_.wait(lock, [this] { return hasTask_ || !isRunning_; });
+			if (!isRunning_) {
+				return;
+			}
+			task = std::move(task_);
+		}
+
+		task();
+
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			hasTask_ = false;
+		}
+		condition_.notify_all();
+	}
+}
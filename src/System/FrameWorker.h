@@ -0,0 +1,37 @@
+#pragma once
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/// <summary>
+/// 1フレーム分の処理を別スレッドで実行するためのワーカー
+/// Kick で処理を投げ、Wait で完了を待つ（同時に投げられるのは1件まで）
+/// </summary>
+class FrameWorker {
+public:
+	FrameWorker();
+	~FrameWorker();
+	FrameWorker(const FrameWorker&) = delete;
+	FrameWorker& operator=(const FrameWorker&) = delete;
+
+	/// <summary>
+	/// 処理を開始する（前回の処理は Wait 済みであること）
+	/// </summary>
+	void Kick(std::function<void()> task);
+
+	/// <summary>
+	/// Kick した処理の完了を待つ（何も投げていなければ即座に戻る）
+	/// </summary>
+	void Wait();
+
+private:
+	void ThreadMain();
+
+	std::thread thread_;
+	std::mutex mutex_;
+	std::condition_variable condition_;
+	std::function<void()> task_;
+	bool hasTask_ = false;
+	bool isRunning_ = true;
+};
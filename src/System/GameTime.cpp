@@ -1,8 +1,49 @@
 #include "GameTime.h"
+#include <algorithm>
+#include <cmath>
 
-const float GameTime::deltaTime_ = 1.0f / 60.0f;
+GameTime::Clock::time_point GameTime::previousTime_;
+bool GameTime::hasPreviousTime_ = false;
+float GameTime::accumulator_ = 0.0f;
+float GameTime::frameTime_ = 0.0f;
+float GameTime::alpha_ = 0.0f;
+uint32_t GameTime::stepCount_ = 1;
 
-float GameTime::GetDeltaTime() { return deltaTime_; }
+float GameTime::GetDeltaTime() { return kFixedDeltaTime; }
 
-void GameTime::Update() {}
+void GameTime::Update() {
+	Clock::time_point now = Clock::now();
 
+	// 最初のフレームは1ステップだけ進める
+	if (!hasPreviousTime_) {
+		previousTime_ = now;
+		hasPreviousTime_ = true;
+		accumulator_ = 0.0f;
+		frameTime_ = kFixedDeltaTime;
+		alpha_ = 0.0f;
+		stepCount_ = 1;
+		return;
+	}
+
+	frameTime_ = std::chrono::duration<float>(now - previousTime_).count();
+	previousTime_ = now;
+	frameTime_ = std::clamp(frameTime_, 0.0f, kMaxFrameTime);
+
+	accumulator_ += frameTime_;
+
+	// 貯まった時間の分だけステップを進める
+	stepCount_ = 0;
+	while (accumulator_ >= kFixedDeltaTime && stepCount_ < kMaxStepsPerFrame) {
+		accumulator_ -= kFixedDeltaTime;
+		++stepCount_;
+	}
+
+	// 上限に達しても追いつけない分は捨てる（ゲームがゆっくりになるが、固まりはしない）
+	if (accumulator_ >= kFixedDeltaTime) {
+		accumulator_ = std::fmod(accumulator_, kFixedDeltaTime);
+	}
+
+	alpha_ = accumulator_ / kFixedDeltaTime;
+}
+
+void GameTime::Reset() { hasPreviousTime_ = false; }
@@ -1,9 +1,58 @@
 #pragma once
+#include <chrono>
+#include <cstdint>
+
+/// <summary>
+/// ゲーム内時間
+/// シミュレーションは固定ステップ（GetDeltaTime）で進め、実時間との差はアキュムレータに貯めて
+/// 1フレームあたりのステップ数（GetStepCount）と描画用の補間係数（GetAlpha）に変換する
+/// </summary>
 class GameTime {
 public:
+	// シミュレーションの1ステップの時間（秒）
+	static inline const float kFixedDeltaTime = 1.0f / 60.0f;
+	// 1フレームで進める最大ステップ数（処理落ちが続いても追いつこうとして止まらないようにする）
+	static inline const uint32_t kMaxStepsPerFrame = 5;
+	// 1フレームの経過時間の上限（秒）。デバッガで止めた後などに大量のステップを積まない
+	static inline const float kMaxFrameTime = 0.25f;
+
+	/// <summary>
+	/// シミュレーションの1ステップの時間（秒）を取得
+	/// </summary>
 	static float GetDeltaTime();
+
+	/// <summary>
+	/// 実時間を計測し、このフレームで進めるステップ数と補間係数を決める（毎フレーム1回呼ぶ）
+	/// </summary>
 	static void Update();
 
+	/// <summary>
+	/// 計測をやり直す（シーン切り替え直後など、前フレームからの経過時間を捨てたいとき）
+	/// </summary>
+	static void Reset();
+
+	/// <summary>
+	/// このフレームで進めるシミュレーションのステップ数
+	/// </summary>
+	static uint32_t GetStepCount() { return stepCount_; }
+
+	/// <summary>
+	/// 描画用の補間係数 [0, 1)（最後のステップから次のステップまでの進み具合）
+	/// </summary>
+	static float GetAlpha() { return alpha_; }
+
+	/// <summary>
+	/// 前フレームからの実経過時間（秒）
+	/// </summary>
+	static float GetFrameTime() { return frameTime_; }
+
 private:
-	static const float deltaTime_;
+	using Clock = std::chrono::steady_clock;
+
+	static Clock::time_point previousTime_;
+	static bool hasPreviousTime_;
+	static float accumulator_;
+	static float frameTime_;
+	static float alpha_;
+	static uint32_t stepCount_;
 };
@@ -0,0 +1,150 @@
+#include "JobSystem.h"
+#include <algorithm>
+
+namespace {
+// 現在のスレッドが使うキュー番号（メインスレッドおよび外部スレッドは 0）
+thread_local uint32_t tQueueIndex = 0;
+// 現在のスレッドで実行中のジョブの深さ（ジョブの中から呼ばれた ParallelFor の判定に使う）
+thread_local uint32_t tJobDepth = 0;
+} // namespace
+
+JobSystem* JobSystem::GetInstance() {
+	static JobSystem instance;
+	return &instance;
+}
+
+JobSystem::~JobSystem() { Finalize(); }
+
+void JobSystem::Initialize(uint32_t workerCount) {
+	// 二重初期化を防ぐ
+	Finalize();
+
+	if (workerCount == UINT32_MAX) {
+		uint32_t hardwareCount = std::thread::hardware_concurrency();
+		workerCount = (hardwareCount > 1) ? hardwareCount - 1 : 0;
+	}
+
+	queues_.clear();
+	for (uint32_t i = 0; i < workerCount + 1; ++i) {
+		queues_.push_back(std::make_unique<WorkQueue>());
+	}
+
+	isRunning_ = true;
+	for (uint32_t i = 0; i < workerCount; ++i) {
+		workers_.emplace_back(&JobSystem::WorkerMain, this, i + 1);
+	}
+}
+
+void JobSystem::Finalize() {
+	if (!isRunning_) {
+		return;
+	}
+	{
+		std::lock_guard<std::mutex> lock(wakeMutex_);
+		isRunning_ = false;
+	}
+	wakeCondition_.notify_all();
+	for (std::thread& worker : workers_) {
+		worker.join();
+	}
+	workers_.clear();
+	queues_.clear();
+}
+
+bool JobSystem::PopLocal(uint32_t queueIndex, Job& job) {
+	WorkQueue& queue = *queues_[queueIndex];
+	std::lock_guard<std::mutex> lock(queue.mutex);
+	if (queue.jobs.empty()) {
+		return false;
+	}
+	job = std::move(queue.jobs.back());
+	queue.jobs.pop_back();
+	return true;
+}
+
+bool JobSystem::Steal(uint32_t thiefIndex, Job& job) {
+	uint32_t queueCount = static_cast<uint32_t>(queues_.size());
+	// 隣から順に見ていく（全員が同じキューに群がらないように）
+	for (uint32_t offset = 1; offset < queueCount; ++offset) {
+		WorkQueue& queue = *queues_[(thiefIndex + offset) % queueCount];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (queue.jobs.empty()) {
+			continue;
+		}
+		job = std::move(queue.jobs.front());
+		queue.jobs.pop_front();
+		return true;
+	}
+	return false;
+}
+
+bool JobSystem::RunOne(uint32_t queueIndex) {
+	Job job;
+	if (!PopLocal(queueIndex, job) && !Steal(queueIndex, job)) {
+		return false;
+	}
+	queuedJobCount_.fetch_sub(1, std::memory_order_relaxed);
+	++tJobDepth;
+	job.func();
+	--tJobDepth;
+	job.pending->fetch_sub(1, std::memory_order_release);
+	return true;
+}
+
+void JobSystem::WorkerMain(uint32_t queueIndex) {
+	tQueueIndex = queueIndex;
+	while (true) {
+		if (RunOne(queueIndex)) {
+			continue;
+		}
+		// 仕事が無ければ次のジョブが積まれるまで眠る
+		std::unique_lock<std::mutex> lock(wakeMutex_);
+		wakeCondition_.wait(lock, [this] { return !isRunning_ || queuedJobCount_.load(std::memory_order_relaxed) > 0; });
+		if (!isRunning_) {
+			return;
+		}
+	}
+}
+
+void JobSystem::ParallelFor(uint32_t count, uint32_t grainSize, const std::function<void(uint32_t begin, uint32_t end)>& func) {
+	if (count == 0) {
+		return;
+	}
+	grainSize = (std::max)(grainSize, 1u);
+
+	// 無効時、1ジョブに収まる場合、またはジョブの中から呼ばれた場合はその場で実行する
+	// （外側で十分に分割されているので、内側まで分けると待ち合わせの分だけ遅くなる）
+	if (!IsEnabled() || count <= grainSize || tJobDepth > 0) {
+		func(0, count);
+		return;
+	}
+
+	uint32_t jobCount = (count + grainSize - 1) / grainSize;
+	std::atomic<uint32_t> pending = jobCount;
+
+	uint32_t queueIndex = tQueueIndex;
+	{
+		WorkQueue& queue = *queues_[queueIndex];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		// 取り出される前に数を増やしておく（RunOne での減算と順序を揃える）
+		queuedJobCount_.fetch_add(jobCount, std::memory_order_relaxed);
+		// 自分は後ろから取るので、逆順で積んで先頭の範囲から処理する（盗まれるのは末尾側）
+		for (uint32_t i = jobCount; i-- > 0;) {
+			uint32_t begin = i * grainSize;
+			uint32_t end = (std::min)(begin + grainSize, count);
+			queue.jobs.push_back(Job{[&func, begin, end] { func(begin, end); }, &pending});
+		}
+	}
+	{
+		// 待機判定との競合で起こし損ねないよう、ロックを経由してから通知する
+		std::lock_guard<std::mutex> lock(wakeMutex_);
+	}
+	wakeCondition_.notify_all();
+
+	// 呼び出しスレッドも処理に参加し、全ジョブの完了を待つ
+	while (pending.load(std::memory_order_acquire) > 0) {
+		if (!RunOne(queueIndex)) {
+			std::this_thread::yield();
+		}
+	}
+}
@@ -0,0 +1,102 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// <summary>
+/// ワークスティーリング方式のジョブシステム
+/// ワーカーごとにデックを持ち、自分のデックは後ろから（LIFO）、
+/// 他人のデックは前から（FIFO）盗んで実行する
+/// </summary>
+class JobSystem {
+public:
+	// シングルトン取得
+	static JobSystem* GetInstance();
+
+	/// <summary>
+	/// 初期化（ワーカースレッドの起動）
+	/// </summary>
+	/// <param name="workerCount">ワーカー数（メインスレッドを除く）。UINT32_MAX なら論理コア数-1</param>
+	void Initialize(uint32_t workerCount = UINT32_MAX);
+
+	/// <summary>
+	/// 終了処理（ワーカースレッドの停止）
+	/// </summary>
+	void Finalize();
+
+	/// <summary>
+	/// [0, count) を grainSize ごとのジョブに分割して並列実行し、全て終わるまで待つ
+	/// 呼び出しスレッドも実行に参加する
+	/// ジョブの中から呼んだ場合は分割せず、呼び出しスレッドでその場で実行する
+	/// 結果を決定的にするため、func は自分の担当範囲のインデックスにだけ書き込むこと
+	/// </summary>
+	/// <param name="count">要素数</param>
+	/// <param name="grainSize">1ジョブあたりの要素数</param>
+	/// <param name="func">func(begin, end) の形で範囲を受け取る処理</param>
+	void ParallelFor(uint32_t count, uint32_t grainSize, const std::function<void(uint32_t begin, uint32_t end)>& func);
+
+	/// <summary>
+	/// コンテナの各要素に対して並列に func を呼ぶ
+	/// </summary>
+	template<typename Container, typename Func>
+	void ParallelForEach(Container& container, uint32_t grainSize, Func func) {
+		ParallelFor(static_cast<uint32_t>(container.size()), grainSize, [&](uint32_t begin, uint32_t end) {
+			for (uint32_t i = begin; i < end; ++i) {
+				func(container[i]);
+			}
+		});
+	}
+
+	// 有効/無効の切り替え（無効時は呼び出しスレッドで順番に実行する。単一スレッド実行との比較用）
+	void SetEnabled(bool enabled) { enabled_ = enabled; }
+	bool IsEnabled() const { return enabled_ && !workers_.empty(); }
+
+	// ワーカー数（メインスレッドを除く）
+	uint32_t GetWorkerCount() const { return static_cast<uint32_t>(workers_.size()); }
+
+private:
+	JobSystem() = default;
+	~JobSystem();
+	JobSystem(const JobSystem&) = delete;
+	JobSystem& operator=(const JobSystem&) = delete;
+
+	// ジョブ1つ分
+	struct Job {
+		std::function<void()> func;
+		// 完了時にデクリメントする残りジョブ数
+		std::atomic<uint32_t>* pending = nullptr;
+	};
+
+	// ワーカーごとのデック
+	struct WorkQueue {
+		std::mutex mutex;
+		std::deque<Job> jobs;
+	};
+
+	// 自分のデックの後ろから取り出す
+	bool PopLocal(uint32_t queueIndex, Job& job);
+	// 他のデックの前から盗む
+	bool Steal(uint32_t thiefIndex, Job& job);
+	// 1つ取り出して実行する（無ければ false）
+	bool RunOne(uint32_t queueIndex);
+	// ワーカースレッドの本体
+	void WorkerMain(uint32_t queueIndex);
+
+	// キュー[0] はメインスレッド用、[1..] が各ワーカー用
+	std::vector<std::unique_ptr<WorkQueue>> queues_;
+	std::vector<std::thread> workers_;
+
+	// 待機中のワーカーを起こすための仕組み
+	std::mutex wakeMutex_;
+	std::condition_variable wakeCondition_;
+	std::atomic<uint32_t> queuedJobCount_ = 0;
+	std::atomic<bool> isRunning_ = false;
+
+	bool enabled_ = true;
+};
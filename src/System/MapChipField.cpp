@@ -1,11 +1,11 @@
 #include "MapChipField.h"
+#include <cassert>
+#include <cctype>
 #include <fstream>
 #include <map>
 #include <sstream>
 #include <algorithm>
 
-using namespace KamataEngine;
-
 namespace {
 
 std::map<std::string, MapChipType> mapChipTable = {
@@ -77,7 +77,7 @@ void MapChipField::LoadMapChipCsv(const std::string& filePath) {
 	file.close();
 }
 
-MapChipType MapChipField::GetMapChipTypeByIndex(uint32_t xIndex, uint32_t yIndex) {
+MapChipType MapChipField::GetMapChipTypeByIndex(uint32_t xIndex, uint32_t yIndex) const {
 	// 安全な範囲チェック（符号付き比較は不要）
 	if (xIndex >= kNumBlockHorizontal || yIndex >= kNumBlockVertical) {
 		return MapChipType::kBlank;
@@ -85,19 +85,25 @@ MapChipType MapChipField::GetMapChipTypeByIndex(uint32_t xIndex, uint32_t yIndex
 	return mapChipData_.data[yIndex][xIndex];
 }
 
-Vector3 MapChipField::GetMapChipPositionByIndex(uint32_t xIndex, uint32_t yIndex) {
+SimVector3 MapChipField::GetMapChipPositionByIndex(uint32_t xIndex, uint32_t yIndex) const {
 	//                                                         簡易的な座標変換
-	return Vector3(kBlockWidth * xIndex, kBlockHeight * (kNumBlockVertical - 1 - yIndex ), 0);
+	return SimVector3{kBlockWidth * static_cast<int>(xIndex), kBlockHeight * static_cast<int>(kNumBlockVertical - 1 - yIndex), 0.0f};
 }
 
-uint32_t MapChipField::GetNumBlockVertical() { return kNumBlockVertical; }
+uint32_t MapChipField::GetNumBlockVertical() const { return kNumBlockVertical; }
 
-uint32_t MapChipField::GetNumBlockHorizontal() { return kNumBlockHorizontal; }
+uint32_t MapChipField::GetNumBlockHorizontal() const { return kNumBlockHorizontal; }
 
  // MapChipField::GetMapChipIndexSetByPosition の実装
-MapChipField::IndexSet MapChipField::GetMapChipIndexSetByPosition(const KamataEngine::Vector3 position) {
+MapChipField::IndexSet MapChipField::GetMapChipIndexSetByPosition(const SimVector3 position) const {
 	IndexSet indexSet{};
+	const SimReal kEpsilon = 0.01f;
 
+#ifdef SIM_FIXED_POINT
+	// 固定小数点のときは、半ブロック分ずらした内部表現を右シフトするだけで番号になる（算術シフトなので -∞ 方向への切り捨て）
+	indexSet.xIndex = static_cast<uint32_t>((position.x + kBlockWidth / 2).GetRaw() >> kBlockSizeShift);
+	uint32_t revertedYIndex = static_cast<uint32_t>((position.y + kBlockHeight / 2 + kEpsilon).GetRaw() >> kBlockSizeShift);
+#else
 	// X番号の計算 (変更なし)
 	indexSet.xIndex = static_cast<uint32_t>(std::floor((position.x + kBlockWidth / 2.0f) / kBlockWidth));
 
@@ -105,8 +111,8 @@ MapChipField::IndexSet MapChipField::GetMapChipIndexSetByPosition(const KamataEn
 	// 1. 反転前のY番号を計算
 	// ワールド座標のYにブロック高さの半分を足して、ブロック高さで割る
 	// ここに微小な正の値を加算することで、わずかな浮き上がりを考慮し、誤って下のブロックのインデックスを取得するのを防ぐ
-	const float kEpsilon = 0.01f;                                                                                             // 例: 非常に小さい値
 	uint32_t revertedYIndex = static_cast<uint32_t>(std::floor((position.y + kBlockHeight / 2.0f + kEpsilon) / kBlockHeight));
+#endif
 
 	// 2. 正しいY番号に反転させる
 	indexSet.yIndex = kNumBlockVertical - 1 - revertedYIndex;
@@ -115,9 +121,9 @@ MapChipField::IndexSet MapChipField::GetMapChipIndexSetByPosition(const KamataEn
 }
 
 // MapChipField::GetRectByIndex の実装
-MapChipField::Rect MapChipField::GetRectByIndex(uint32_t xIndex, uint32_t yIndex) {
+MapChipField::Rect MapChipField::GetRectByIndex(uint32_t xIndex, uint32_t yIndex) const {
 	// 指定ブロックの中心座標を取得する
-	KamataEngine::Vector3 center = GetMapChipPositionByIndex(xIndex, yIndex);
+	SimVector3 center = GetMapChipPositionByIndex(xIndex, yIndex);
 
 	Rect rect;
 	rect.left = center.x - kBlockWidth / 2.0f;
@@ -129,7 +135,7 @@ MapChipField::Rect MapChipField::GetRectByIndex(uint32_t xIndex, uint32_t yIndex
 }
 
 // 指定タイプの最初のマップチップインデックスを探す実装
-bool MapChipField::FindFirstIndexByType(MapChipType type, IndexSet& outIndex) {
+bool MapChipField::FindFirstIndexByType(MapChipType type, IndexSet& outIndex) const {
 	for (uint32_t y = 0; y < kNumBlockVertical; ++y) {
 		for (uint32_t x = 0; x < kNumBlockHorizontal; ++x) {
 			if (mapChipData_.data[y][x] == type) {
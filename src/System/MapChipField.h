@@ -1,5 +1,8 @@
 #pragma once
-#include "KamataEngine.h"
+#include "Sim/SimMath.h"
+#include <cstdint>
+#include <string>
+#include <vector>
 /// <summary>
 /// マップチップフィールド
 /// </summary>
@@ -21,8 +24,12 @@ struct MapChipData {
 class MapChipField {
 private:
 	// 1ブロックのサイズ
-	static inline const float kBlockWidth = 2.0f;
-	static inline const float kBlockHeight = 2.0f;
+	static inline const SimReal kBlockWidth = 2.0f;
+	static inline const SimReal kBlockHeight = 2.0f;
+#ifdef SIM_FIXED_POINT
+	// 固定小数点の座標からマスの番号を求めるときの右シフト量（1ブロック = 2.0 = 2^1）
+	static inline const int kBlockSizeShift = SimFixed::kFractionBits + 1;
+#endif
 	// ブロックの個数
 	static inline const uint32_t kNumBlockVertical = 20;
 	static inline const uint32_t kNumBlockHorizontal = 100;
@@ -40,35 +47,35 @@ public:
 
 	// 範囲矩形
 	struct Rect {
-		float left;   // 左端
-		float right;  // 右端
-		float bottom; // 下端
-		float top;    // 上端
+		SimReal left;   // 左端
+		SimReal right;  // 右端
+		SimReal bottom; // 下端
+		SimReal top;    // 上端
 	};
 
 	void ResetMapChipData();
 
 	void LoadMapChipCsv(const std::string& filePath);
 
-	MapChipType GetMapChipTypeByIndex(uint32_t xIndex, uint32_t yIndex);
+	MapChipType GetMapChipTypeByIndex(uint32_t xIndex, uint32_t yIndex) const;
 
-	KamataEngine::Vector3 GetMapChipPositionByIndex(uint32_t xIndex, uint32_t yIndex);
+	SimVector3 GetMapChipPositionByIndex(uint32_t xIndex, uint32_t yIndex) const;
 
 	//ブロックの数のゲッター
-	uint32_t GetNumBlockVertical();
-	uint32_t GetNumBlockHorizontal();
+	uint32_t GetNumBlockVertical() const;
+	uint32_t GetNumBlockHorizontal() const;
 
 	/// <summary>
 	/// 座標からマップチップ番号を計算
 	/// </summary>
 	/// <param name="position">ワールド座標</param>
 	/// <returns>マップチップのインデックス</returns>
-	IndexSet GetMapChipIndexSetByPosition(const KamataEngine::Vector3 position);
+	IndexSet GetMapChipIndexSetByPosition(const SimVector3 position) const;
 
 	// kBlockHeight のゲッター
-    float GetBlockHeight() const { return kBlockHeight; }
+    SimReal GetBlockHeight() const { return kBlockHeight; }
     // kBlockWidth のゲッター (必要に応じて)
-    float GetBlockWidth() const { return kBlockWidth; }
+    SimReal GetBlockWidth() const { return kBlockWidth; }
 
 	/// <summary>
 	/// マップチップ番号を指定して、ブロックの全方向の境界座標を得る関数
@@ -76,11 +83,11 @@ public:
 	/// <param name="xIndex">Xインデックス</param>
 	/// <param name="yIndex">Yインデックス</param>
 	/// <returns>ブロックの境界範囲</returns>
-	Rect GetRectByIndex(uint32_t xIndex, uint32_t yIndex);
+	Rect GetRectByIndex(uint32_t xIndex, uint32_t yIndex) const;
 
 	/// <summary>
 	/// 指定した MapChipType を持つ最初のインデックスを検索する
 	/// 見つかれば true を返し outIndex に格納する。見つからなければ false を返す。
 	/// </summary>
-	bool FindFirstIndexByType(MapChipType type, IndexSet& outIndex);
+	bool FindFirstIndexByType(MapChipType type, IndexSet& outIndex) const;
 };
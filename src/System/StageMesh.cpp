@@ -0,0 +1,484 @@
+#include "System/StageMesh.h"
+#include "System/MapChipField.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace {
+
+// 面の向き
+enum Face {
+	kFront,  // -Z（カメラ側）
+	kBack,   // +Z
+	kRight,  // +X
+	kLeft,   // -X
+	kTop,    // +Y
+	kBottom, // -Y
+	kFaceCount,
+};
+
+const float kNormals[kFaceCount][3] = {
+    {0.0f, 0.0f, -1.0f},
+    {0.0f, 0.0f, 1.0f},
+    {1.0f, 0.0f, 0.0f},
+    {-1.0f, 0.0f, 0.0f},
+    {0.0f, 1.0f, 0.0f},
+    {0.0f, -1.0f, 0.0f},
+};
+
+// ブロックの奥行き（debugCube と同じ -1 ～ 1）
+const float kNearZ = -1.0f;
+const float kFarZ = 1.0f;
+
+// マップをブロックかどうかだけの表にしたもの（範囲外は空白）
+class SolidGrid {
+public:
+	explicit SolidGrid(const MapChipField& mapChipField)
+	    : columnCount_(mapChipField.GetNumBlockHorizontal()), rowCount_(mapChipField.GetNumBlockVertical()), isSolid_(columnCount_ * rowCount_) {
+		for (uint32_t row = 0; row < rowCount_; ++row) {
+			for (uint32_t column = 0; column < columnCount_; ++column) {
+				isSolid_[row * columnCount_ + column] = mapChipField.GetMapChipTypeByIndex(column, row) == MapChipType::kBlock;
+			}
+		}
+	}
+
+	bool IsSolid(int64_t column, int64_t row) const {
+		if (column < 0 || row < 0 || column >= columnCount_ || row >= rowCount_) {
+			return false;
+		}
+		return isSolid_[static_cast<size_t>(row) * columnCount_ + static_cast<size_t>(column)];
+	}
+
+	uint32_t GetColumnCount() const { return columnCount_; }
+	uint32_t GetRowCount() const { return rowCount_; }
+
+private:
+	uint32_t columnCount_;
+	uint32_t rowCount_;
+	std::vector<bool> isSolid_;
+};
+
+// チャンク1つ分を組み立てる
+class ChunkBuilder {
+public:
+	ChunkBuilder(const SolidGrid& grid, const StageMesh::BakeOptions& options, float blockWidth, float blockHeight, uint32_t rowCount)
+	    : grid_(grid), options_(options), blockWidth_(blockWidth), blockHeight_(blockHeight), rowCount_(rowCount) {}
+
+	void Build(StageMesh::Chunk& chunk) {
+		chunk_ = &chunk;
+		uint32_t beginColumn = chunk.firstColumn;
+		uint32_t endColumn = chunk.firstColumn + chunk.columnCount;
+
+		// --- 手前・奥の面（四角形を横に伸ばしてから縦に伸ばしてまとめる） ---
+		for (Face face : {kFront, kBack}) {
+			std::vector<bool> isUsed(static_cast<size_t>(chunk.columnCount) * rowCount_, false);
+			auto isAvailable = [&](uint32_t column, uint32_t row) {
+				return grid_.IsSolid(column, row) && !isUsed[static_cast<size_t>(row) * chunk.columnCount + (column - beginColumn)];
+			};
+			for (uint32_t row = 0; row < rowCount_; ++row) {
+				for (uint32_t column = beginColumn; column < endColumn; ++column) {
+					if (!isAvailable(column, row)) {
+						continue;
+					}
+					uint32_t width = 1;
+					uint32_t height = 1;
+					if (options_.mergeQuads) {
+						while (column + width < endColumn && isAvailable(column + width, row)) {
+							++width;
+						}
+						for (;;) {
+							if (row + height >= rowCount_) {
+								break;
+							}
+							bool isRowAvailable = true;
+							for (uint32_t i = 0; i < width && isRowAvailable; ++i) {
+								isRowAvailable = isAvailable(column + i, row + height);
+							}
+							if (!isRowAvailable) {
+								break;
+							}
+							++height;
+						}
+					}
+					for (uint32_t y = 0; y < height; ++y) {
+						for (uint32_t x = 0; x < width; ++x) {
+							isUsed[static_cast<size_t>(row + y) * chunk.columnCount + (column + x - beginColumn)] = true;
+						}
+					}
+					// 行番号は上から数えるので、一番下の行は row + height - 1
+					AddQuad(face, column, row + height - 1, width, height);
+				}
+			}
+		}
+
+		// --- 左右の面（縦に続くものをまとめる） ---
+		for (Face face : {kRight, kLeft}) {
+			int64_t neighborOffset = face == kRight ? 1 : -1;
+			for (uint32_t column = beginColumn; column < endColumn; ++column) {
+				uint32_t row = 0;
+				while (row < rowCount_) {
+					if (!IsExposed(column, row, neighborOffset, 0)) {
+						++row;
+						continue;
+					}
+					uint32_t height = 1;
+					while (options_.mergeQuads && row + height < rowCount_ && IsExposed(column, row + height, neighborOffset, 0)) {
+						++height;
+					}
+					AddQuad(face, column, row + height - 1, 1, height);
+					row += height;
+				}
+			}
+		}
+
+		// --- 上下の面（横に続くものをまとめる。上は行番号が1つ小さい方） ---
+		for (Face face : {kTop, kBottom}) {
+			int64_t neighborOffset = face == kTop ? -1 : 1;
+			for (uint32_t row = 0; row < rowCount_; ++row) {
+				uint32_t column = beginColumn;
+				while (column < endColumn) {
+					if (!IsExposed(column, row, 0, neighborOffset)) {
+						++column;
+						continue;
+					}
+					uint32_t width = 1;
+					while (options_.mergeQuads && column + width < endColumn && IsExposed(column + width, row, 0, neighborOffset)) {
+						++width;
+					}
+					AddQuad(face, column, row, width, 1);
+					column += width;
+				}
+			}
+		}
+	}
+
+private:
+	// ブロックの面が外から見えるか（隣がブロックなら見えない）
+	bool IsExposed(uint32_t column, uint32_t row, int64_t columnOffset, int64_t rowOffset) const {
+		if (!grid_.IsSolid(column, row)) {
+			return false;
+		}
+		return !options_.removeHiddenFaces || !grid_.IsSolid(static_cast<int64_t>(column) + columnOffset, static_cast<int64_t>(row) + rowOffset);
+	}
+
+	// column 列・bottomRow 行（一番下の行）から右へ width 個、上へ height 個分の面を1枚加える
+	void AddQuad(Face face, uint32_t column, uint32_t bottomRow, uint32_t width, uint32_t height) {
+		// MapChipField::GetMapChipPositionByIndex と同じく、マスの中心は (幅 * 列, 高さ * (行数 - 1 - 行))
+		float x0 = blockWidth_ * static_cast<float>(column) - blockWidth_ / 2.0f;
+		float x1 = x0 + blockWidth_ * static_cast<float>(width);
+		float y0 = blockHeight_ * static_cast<float>(rowCount_ - 1 - bottomRow) - blockHeight_ / 2.0f;
+		float y1 = y0 + blockHeight_ * static_cast<float>(height);
+		float u = static_cast<float>(width);
+		float v = static_cast<float>(height);
+
+		// 外から見て 左下・左上・右上・右下 の順（時計回りが表）
+		float corners[4][3];
+		float texcoords[4][2] = {{0.0f, v}, {0.0f, 0.0f}, {u, 0.0f}, {u, v}};
+		switch (face) {
+		case kFront:
+			SetCorners(corners, {x0, y0, kNearZ}, {x0, y1, kNearZ}, {x1, y1, kNearZ}, {x1, y0, kNearZ});
+			break;
+		case kBack:
+			SetCorners(corners, {x1, y0, kFarZ}, {x1, y1, kFarZ}, {x0, y1, kFarZ}, {x0, y0, kFarZ});
+			break;
+		case kRight:
+			SetCorners(corners, {x1, y0, kNearZ}, {x1, y1, kNearZ}, {x1, y1, kFarZ}, {x1, y0, kFarZ});
+			texcoords[2][0] = texcoords[3][0] = 1.0f;
+			break;
+		case kLeft:
+			SetCorners(corners, {x0, y0, kFarZ}, {x0, y1, kFarZ}, {x0, y1, kNearZ}, {x0, y0, kNearZ});
+			texcoords[2][0] = texcoords[3][0] = 1.0f;
+			break;
+		case kTop:
+			SetCorners(corners, {x0, y1, kNearZ}, {x0, y1, kFarZ}, {x1, y1, kFarZ}, {x1, y1, kNearZ});
+			texcoords[0][1] = texcoords[3][1] = 1.0f;
+			break;
+		case kBottom:
+		default:
+			SetCorners(corners, {x0, y0, kFarZ}, {x0, y0, kNearZ}, {x1, y0, kNearZ}, {x1, y0, kFarZ});
+			texcoords[0][1] = texcoords[3][1] = 1.0f;
+			break;
+		}
+
+		uint32_t baseIndex = static_cast<uint32_t>(chunk_->vertices.size());
+		for (int i = 0; i < 4; ++i) {
+			StageMesh::Vertex vertex;
+			std::memcpy(vertex.position, corners[i], sizeof(vertex.position));
+			std::memcpy(vertex.normal, kNormals[face], sizeof(vertex.normal));
+			std::memcpy(vertex.texcoord, texcoords[i], sizeof(vertex.texcoord));
+			chunk_->vertices.push_back(vertex);
+		}
+		for (uint32_t index : {0u, 1u, 2u, 0u, 2u, 3u}) {
+			chunk_->indices.push_back(baseIndex + index);
+		}
+	}
+
+	struct Corner {
+		float x, y, z;
+	};
+	static void SetCorners(float (&corners)[4][3], Corner c0, Corner c1, Corner c2, Corner c3) {
+		const Corner source[4] = {c0, c1, c2, c3};
+		for (int i = 0; i < 4; ++i) {
+			corners[i][0] = source[i].x;
+			corners[i][1] = source[i].y;
+			corners[i][2] = source[i].z;
+		}
+	}
+
+	const SolidGrid& grid_;
+	const StageMesh::BakeOptions& options_;
+	float blockWidth_;
+	float blockHeight_;
+	uint32_t rowCount_;
+	StageMesh::Chunk* chunk_ = nullptr;
+};
+
+// --- 読み書き（リトルエンディアン固定） ---
+
+void WriteUint32(std::vector<uint8_t>& bytes, uint32_t value) {
+	for (uint32_t i = 0; i < 4; ++i) {
+		bytes.push_back(static_cast<uint8_t>(value >> (i * 8)));
+	}
+}
+
+void WriteUint64(std::vector<uint8_t>& bytes, uint64_t value) {
+	WriteUint32(bytes, static_cast<uint32_t>(value));
+	WriteUint32(bytes, static_cast<uint32_t>(value >> 32));
+}
+
+void WriteFloat(std::vector<uint8_t>& bytes, float value) {
+	uint32_t bits = 0;
+	std::memcpy(&bits, &value, sizeof(bits));
+	WriteUint32(bytes, bits);
+}
+
+bool ReadUint32(const std::vector<uint8_t>& bytes, size_t& offset, uint32_t& outValue) {
+	if (offset + 4 > bytes.size()) {
+		return false;
+	}
+	outValue = 0;
+	for (uint32_t i = 0; i < 4; ++i) {
+		outValue |= static_cast<uint32_t>(bytes[offset + i]) << (i * 8);
+	}
+	offset += 4;
+	return true;
+}
+
+bool ReadUint64(const std::vector<uint8_t>& bytes, size_t& offset, uint64_t& outValue) {
+	uint32_t low = 0;
+	uint32_t high = 0;
+	if (!ReadUint32(bytes, offset, low) || !ReadUint32(bytes, offset, high)) {
+		return false;
+	}
+	outValue = static_cast<uint64_t>(high) << 32 | low;
+	return true;
+}
+
+bool ReadFloat(const std::vector<uint8_t>& bytes, size_t& offset, float& outValue) {
+	uint32_t bits = 0;
+	if (!ReadUint32(bytes, offset, bits)) {
+		return false;
+	}
+	std::memcpy(&outValue, &bits, sizeof(outValue));
+	return true;
+}
+
+} // namespace
+
+void StageMesh::Bake(const MapChipField& mapChipField, const BakeOptions& options) {
+	chunks_.clear();
+	sourceHash_ = ComputeSourceHash(mapChipField, options);
+
+	SolidGrid grid(mapChipField);
+	float blockWidth = ToFloat(mapChipField.GetBlockWidth());
+	float blockHeight = ToFloat(mapChipField.GetBlockHeight());
+	ChunkBuilder builder(grid, options, blockWidth, blockHeight, grid.GetRowCount());
+
+	for (uint32_t firstColumn = 0; firstColumn < grid.GetColumnCount(); firstColumn += kChunkColumnCount) {
+		Chunk& chunk = chunks_.emplace_back();
+		chunk.firstColumn = firstColumn;
+		chunk.columnCount = (std::min)(kChunkColumnCount, grid.GetColumnCount() - firstColumn);
+		builder.Build(chunk);
+	}
+}
+
+bool StageMesh::LoadOrBake(const std::string& stageFilePath, const MapChipField& mapChipField, const BakeOptions& options) {
+	std::string cachePath = GetCachePath(stageFilePath);
+	if (LoadFromFile(cachePath) && sourceHash_ == ComputeSourceHash(mapChipField, options)) {
+		return true;
+	}
+	Bake(mapChipField, options);
+	// 保存できなくても（読み取り専用の場所など）作ったものはそのまま使う
+	SaveToFile(cachePath);
+	return false;
+}
+
+std::string StageMesh::GetCachePath(const std::string& stageFilePath) {
+	size_t separator = stageFilePath.find_last_of("/\\");
+	size_t dot = stageFilePath.find_last_of('.');
+	if (dot == std::string::npos || (separator != std::string::npos && dot < separator)) {
+		return stageFilePath + ".mesh";
+	}
+	return stageFilePath.substr(0, dot) + ".mesh";
+}
+
+uint64_t StageMesh::ComputeSourceHash(const MapChipField& mapChipField, const BakeOptions& options) {
+	// FNV-1a
+	uint64_t hash = 14695981039346656037ull;
+	auto mix = [&hash](uint64_t value) {
+		for (int i = 0; i < 8; ++i) {
+			hash ^= (value >> (i * 8)) & 0xFF;
+			hash *= 1099511628211ull;
+		}
+	};
+	mix(kVersion);
+	mix(kChunkColumnCount);
+	mix(options.removeHiddenFaces ? 1 : 0);
+	mix(options.mergeQuads ? 1 : 0);
+	uint32_t columnCount = mapChipField.GetNumBlockHorizontal();
+	uint32_t rowCount = mapChipField.GetNumBlockVertical();
+	mix(columnCount);
+	mix(rowCount);
+	for (uint32_t row = 0; row < rowCount; ++row) {
+		for (uint32_t column = 0; column < columnCount; ++column) {
+			mix(mapChipField.GetMapChipTypeByIndex(column, row) == MapChipType::kBlock ? 1 : 0);
+		}
+	}
+	return hash;
+}
+
+std::vector<uint8_t> StageMesh::Serialize() const {
+	std::vector<uint8_t> bytes;
+
+	// --- ヘッダ ---
+	WriteUint32(bytes, kMagic);
+	WriteUint32(bytes, kVersion);
+	WriteUint64(bytes, sourceHash_);
+	WriteUint32(bytes, static_cast<uint32_t>(chunks_.size()));
+
+	// --- チャンク ---
+	for (const Chunk& chunk : chunks_) {
+		WriteUint32(bytes, chunk.firstColumn);
+		WriteUint32(bytes, chunk.columnCount);
+		WriteUint32(bytes, static_cast<uint32_t>(chunk.vertices.size()));
+		WriteUint32(bytes, static_cast<uint32_t>(chunk.indices.size()));
+		for (const Vertex& vertex : chunk.vertices) {
+			for (float value : vertex.position) {
+				WriteFloat(bytes, value);
+			}
+			for (float value : vertex.normal) {
+				WriteFloat(bytes, value);
+			}
+			for (float value : vertex.texcoord) {
+				WriteFloat(bytes, value);
+			}
+		}
+		for (uint32_t index : chunk.indices) {
+			WriteUint32(bytes, index);
+		}
+	}
+	return bytes;
+}
+
+bool StageMesh::Deserialize(const std::vector<uint8_t>& bytes) {
+	chunks_.clear();
+	sourceHash_ = 0;
+
+	// --- ヘッダ ---
+	size_t offset = 0;
+	uint32_t magic = 0;
+	uint32_t version = 0;
+	uint64_t sourceHash = 0;
+	uint32_t chunkCount = 0;
+	if (!ReadUint32(bytes, offset, magic) || magic != kMagic || !ReadUint32(bytes, offset, version) || version != kVersion) {
+		return false;
+	}
+	if (!ReadUint64(bytes, offset, sourceHash) || !ReadUint32(bytes, offset, chunkCount)) {
+		return false;
+	}
+
+	// --- チャンク ---
+	const size_t kVertexByteSize = sizeof(float) * 8;
+	// チャンクの見出しは1つ 16 バイト（先頭の列・列数・頂点数・インデックス数）。数が残りの長さに収まらなければ確保しない
+	const size_t kChunkHeaderSize = sizeof(uint32_t) * 4;
+	if (chunkCount > (bytes.size() - offset) / kChunkHeaderSize) {
+		return false;
+	}
+	std::vector<Chunk> chunks(chunkCount);
+	for (Chunk& chunk : chunks) {
+		uint32_t vertexCount = 0;
+		uint32_t indexCount = 0;
+		if (!ReadUint32(bytes, offset, chunk.firstColumn) || !ReadUint32(bytes, offset, chunk.columnCount) || !ReadUint32(bytes, offset, vertexCount) ||
+		    !ReadUint32(bytes, offset, indexCount)) {
+			return false;
+		}
+		// 壊れたファイルで大きな領域を確保しないよう、先に残りの長さを確かめる
+		if (bytes.size() - offset < static_cast<uint64_t>(vertexCount) * kVertexByteSize + static_cast<uint64_t>(indexCount) * sizeof(uint32_t)) {
+			return false;
+		}
+		chunk.vertices.resize(vertexCount);
+		for (Vertex& vertex : chunk.vertices) {
+			for (float& value : vertex.position) {
+				ReadFloat(bytes, offset, value);
+			}
+			for (float& value : vertex.normal) {
+				ReadFloat(bytes, offset, value);
+			}
+			for (float& value : vertex.texcoord) {
+				ReadFloat(bytes, offset, value);
+			}
+		}
+		chunk.indices.resize(indexCount);
+		for (uint32_t& index : chunk.indices) {
+			ReadUint32(bytes, offset, index);
+			if (index >= vertexCount) {
+				return false;
+			}
+		}
+	}
+	if (offset != bytes.size()) {
+		return false;
+	}
+
+	chunks_ = std::move(chunks);
+	sourceHash_ = sourceHash;
+	return true;
+}
+
+bool StageMesh::SaveToFile(const std::string& filePath) const {
+	std::ofstream file(filePath, std::ios::binary);
+	if (!file.is_open()) {
+		return false;
+	}
+	std::vector<uint8_t> bytes = Serialize();
+	file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+	return file.good();
+}
+
+bool StageMesh::LoadFromFile(const std::string& filePath) {
+	std::ifstream file(filePath, std::ios::binary);
+	if (!file.is_open()) {
+		chunks_.clear();
+		sourceHash_ = 0;
+		return false;
+	}
+	std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	return Deserialize(bytes);
+}
+
+size_t StageMesh::GetVertexCount() const {
+	size_t count = 0;
+	for (const Chunk& chunk : chunks_) {
+		count += chunk.vertices.size();
+	}
+	return count;
+}
+
+size_t StageMesh::GetTriangleCount() const {
+	size_t count = 0;
+	for (const Chunk& chunk : chunks_) {
+		count += chunk.indices.size() / 3;
+	}
+	return count;
+}
@@ -0,0 +1,93 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class MapChipField;
+
+/// <summary>
+/// StageMesh の作り方（既定値を引数の既定値に使うので、クラスの外に置く）
+/// </summary>
+struct StageMeshBakeOptions {
+	// 隣がブロックの面を作らない
+	bool removeHiddenFaces = true;
+	// 同じ平面で隣り合う面をまとめる
+	bool mergeQuads = true;
+};
+
+/// <summary>
+/// ステージのブロック（kBlock）をまとめた静的なメッシュ
+/// 横方向に kChunkColumnCount 列ずつのチャンクに分け、チャンクごとに1つの頂点・インデックス配列を持つ。
+/// 隣がブロックの面（外から見えない面）は作らず、同じ平面で隣り合う面は1枚の四角形にまとめる。
+/// エンジンに依存しないので、頂点数・三角形数を Linux でも確かめられる。
+/// 座標は MapChipField と同じ（1ブロックはマスの中心から ±幅/2、奥行きは -1 ～ 1。debugCube と同じ大きさ）
+/// ファイルにはヘッダ（識別子・バージョン・元のマップのハッシュ・チャンク数）の後に、チャンクごとの頂点とインデックスを並べて保存する
+/// </summary>
+class StageMesh {
+public:
+	// ファイルの識別子 "AL4M"
+	static inline const uint32_t kMagic = 0x4D344C41;
+	// 形式のバージョン（形式や作り方を変えたら上げる。古いキャッシュは使われなくなる）
+	static inline const uint32_t kVersion = 1;
+	// 1チャンクの列数
+	static inline const uint32_t kChunkColumnCount = 16;
+
+	struct Vertex {
+		float position[3];
+		float normal[3];
+		// ブロック1個分で 0 ～ 1（まとめた面ではテクスチャを繰り返す）
+		float texcoord[2];
+	};
+
+	struct Chunk {
+		uint32_t firstColumn = 0;
+		uint32_t columnCount = 0;
+		std::vector<Vertex> vertices;
+		std::vector<uint32_t> indices;
+	};
+
+	using BakeOptions = StageMeshBakeOptions;
+
+	/// <summary>
+	/// マップから作る
+	/// </summary>
+	void Bake(const MapChipField& mapChipField, const BakeOptions& options = {});
+
+	/// <summary>
+	/// キャッシュ（ステージのファイルと同じ場所の .mesh）が今のマップと一致すれば読み込み、無ければ作って保存する
+	/// </summary>
+	/// <returns>キャッシュを使えたら true</returns>
+	bool LoadOrBake(const std::string& stageFilePath, const MapChipField& mapChipField, const BakeOptions& options = {});
+
+	/// <summary>
+	/// ステージのファイル名からキャッシュのファイル名を作る（stage1.csv → stage1.mesh）
+	/// </summary>
+	static std::string GetCachePath(const std::string& stageFilePath);
+
+	/// <summary>
+	/// マップ（ブロックの配置）と作り方のハッシュ。キャッシュが古くないかの確認に使う
+	/// </summary>
+	static uint64_t ComputeSourceHash(const MapChipField& mapChipField, const BakeOptions& options);
+
+	/// <summary>
+	/// バイト列へ変換する
+	/// </summary>
+	std::vector<uint8_t> Serialize() const;
+
+	/// <summary>
+	/// バイト列から読み込む（形式が不正なら false を返し、中身は空になる）
+	/// </summary>
+	bool Deserialize(const std::vector<uint8_t>& bytes);
+
+	bool SaveToFile(const std::string& filePath) const;
+	bool LoadFromFile(const std::string& filePath);
+
+	const std::vector<Chunk>& GetChunks() const { return chunks_; }
+	uint64_t GetSourceHash() const { return sourceHash_; }
+	size_t GetVertexCount() const;
+	size_t GetTriangleCount() const;
+
+private:
+	std::vector<Chunk> chunks_;
+	uint64_t sourceHash_ = 0;
+};
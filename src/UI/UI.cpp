@@ -1,20 +1,18 @@
 #include "UI.h"
 #include "Objects/Player.h"
+#include "Render/RenderSnapshot.h"
+#include "Render/UiAtlas.h"
 #include "System/Gamepad.h"
 #include <algorithm>
 
 using namespace KamataEngine;
 
 void UI::Initialize() {
-	pausedHnadle_ = TextureManager::GetInstance()->Load("UI/pause.png");
-	backGroundHandle_ = TextureManager::GetInstance()->Load("white1x1.png");
-	arrowHandle_ = TextureManager::GetInstance()->Load("UI/arrow.png");
-	pausedSprite_ = Sprite::Create(pausedHnadle_, {});
-	pausedSprite_->SetSize({768, 432});
-	backGroundSprite_ = Sprite::Create(backGroundHandle_, {});
-	backGroundSprite_->SetSize({1280, 720});
-	arrowSprite_ = Sprite::Create(arrowHandle_, {});
-	arrowSprite_->SetSize({80, 32});
+	UiAtlas* atlas = UiAtlas::GetInstance();
+	atlas->Load();
+	// 画面中央に配置（サイズは固定なのでここで計算しておく）
+	Vector2 pausedSize = atlas->GetSize(UiAtlas::Region::kPause);
+	pausedSpritePosition_ = {1280 / 2 - pausedSize.x / 2.0f, 720 / 2 - pausedSize.y / 2.0f};
 
 	// 初期はキーボード表示
 	lastInputIsGamepad_ = false;
@@ -116,23 +114,17 @@ void UI::HandlePauseInput(int& pauseMenuIndex, bool& outConfirm, bool& outCancel
 	}
 }
 
-void UI::Draw(int pauseMenuIndex) {
-	KamataEngine::DirectXCommon* dxCommon = KamataEngine::DirectXCommon::GetInstance();
+void UI::Draw(RenderSnapshot& snapshot, int pauseMenuIndex) {
+	const Vector4 white = {1.0f, 1.0f, 1.0f, 1.0f};
+	UiAtlas* atlas = UiAtlas::GetInstance();
 
-	Sprite::PreDraw(dxCommon->GetCommandList());
-	backGroundSprite_->SetColor({0.0f, 0.0f, 0.0f, 0.8f});
-	backGroundSprite_->Draw();
-	pausedSpritePosition_ = {1280 / 2 - pausedSprite_->GetSize().x / 2.0f, 720 / 2 - pausedSprite_->GetSize().y / 2.0f};
-	pausedSprite_->SetPosition({pausedSpritePosition_});
-	pausedSprite_->Draw();
+	snapshot.AddSprite(atlas->Get(UiAtlas::Region::kWhite), {0.0f, 0.0f}, kBackGroundSize, {0.0f, 0.0f, 0.0f, 0.8f});
+	snapshot.AddSprite(atlas->Get(UiAtlas::Region::kPause), pausedSpritePosition_, white);
 
 	// 矢印は選択インデックスに合わせて表示
-	if (pauseMenuIndex == 0) {
-		arrowSprite_->SetPosition({350, 370});
-	} else if (pauseMenuIndex == 1) {
-		arrowSprite_->SetPosition({350, 470});
+	Vector2 arrowPosition = {350, 370};
+	if (pauseMenuIndex == 1) {
+		arrowPosition = {350, 470};
 	}
-	arrowSprite_->Draw();
-
-	Sprite::PostDraw();
+	snapshot.AddSprite(atlas->Get(UiAtlas::Region::kArrow), arrowPosition, white);
 }
@@ -2,6 +2,7 @@
 #include "KamataEngine.h"
 
 class Player;
+class RenderSnapshot;
 
 class UI {
 public:
@@ -16,17 +17,15 @@ public:
 	// - outCancel: キャンセルが押されたら true に設定される（呼び出し側で処理する）
 	void HandlePauseInput(int& pauseMenuIndex, bool& outConfirm, bool& outCancel);
 
-	void Draw(int pauseMenuIndex);
+	// 描画内容をスナップショットへ記録
+	void Draw(RenderSnapshot& snapshot, int pauseMenuIndex);
 
 private:
-	uint32_t pausedHnadle_;
-	uint32_t backGroundHandle_;
-	uint32_t arrowHandle_;
-	KamataEngine::Sprite* pausedSprite_ = {};
-	KamataEngine::Sprite* backGroundSprite_ = {};
-	KamataEngine::Sprite* arrowSprite_ = {};
+	// 画像は UiAtlas の領域（ポーズの文字 kPause・矢印 kArrow・背景は白い領域 kWhite を黒くする）
 	KamataEngine::Vector2 pausedSpritePosition_ = {};
 
+	static inline const KamataEngine::Vector2 kBackGroundSize = {1280.0f, 720.0f};
+
 	// 最後に使われた入力がコントローラか（true = controller, false = keyboard）
 	bool lastInputIsGamepad_ = false;
 
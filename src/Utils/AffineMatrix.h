@@ -0,0 +1,133 @@
+#pragma once
+#include "Utils/FastMath.h"
+
+/// <summary>
+/// スケール・回転・平行移動からワールド行列（S * Rx * Ry * Rz * T、行ベクトル）を直接組み立てる
+/// 4x4 行列を掛け合わせる代わりに、展開済みの式で各要素を1回ずつ計算する。
+/// エンジンに依存しないよう、x/y/z を持つベクトルと m[4][4] を持つ行列なら何でも受け取れるようにしている
+/// </summary>
+namespace AffineMatrix {
+
+// sin と cos を同じ角度で求める（TransformBatch の SIMD 版と同じ値になるよう FastMath を使う）
+inline void SinCos(float radian, float& outSin, float& outCos) { FastMath::SinCos(radian, outSin, outCos); }
+
+// 3x3 の部分と平行移動を書き込む（4列目は 0, 0, 0, 1）
+template<typename Matrix, typename Vector>
+inline void SetRows(
+    Matrix& result, float m00, float m01, float m02, float m10, float m11, float m12, float m20, float m21, float m22, const Vector& translate) {
+	result.m[0][0] = m00;
+	result.m[0][1] = m01;
+	result.m[0][2] = m02;
+	result.m[0][3] = 0.0f;
+	result.m[1][0] = m10;
+	result.m[1][1] = m11;
+	result.m[1][2] = m12;
+	result.m[1][3] = 0.0f;
+	result.m[2][0] = m20;
+	result.m[2][1] = m21;
+	result.m[2][2] = m22;
+	result.m[2][3] = 0.0f;
+	result.m[3][0] = translate.x;
+	result.m[3][1] = translate.y;
+	result.m[3][2] = translate.z;
+	result.m[3][3] = 1.0f;
+}
+
+/// <summary>
+/// 平行移動だけ（回転なし・スケール 1。ブロックなど）
+/// </summary>
+template<typename Matrix, typename Vector>
+inline void MakeTranslate(Matrix& result, const Vector& translate) {
+	SetRows(result, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, translate);
+}
+
+/// <summary>
+/// スケールと平行移動だけ（回転なし。パーティクルなど）
+/// </summary>
+template<typename Matrix, typename Vector>
+inline void MakeScaleTranslate(Matrix& result, const Vector& scale, const Vector& translate) {
+	SetRows(result, scale.x, 0.0f, 0.0f, 0.0f, scale.y, 0.0f, 0.0f, 0.0f, scale.z, translate);
+}
+
+/// <summary>
+/// Z軸まわりの回転だけ（剣の振り・カメラのロールなど）
+/// </summary>
+template<typename Matrix, typename Vector>
+inline void MakeRotateZ(Matrix& result, const Vector& scale, float rotateZ, const Vector& translate) {
+	float sz, cz;
+	SinCos(rotateZ, sz, cz);
+	SetRows(result, scale.x * cz, scale.x * sz, 0.0f, scale.y * -sz, scale.y * cz, 0.0f, 0.0f, 0.0f, scale.z, translate);
+}
+
+// 回転部分（Rx * Ry * Rz）を展開したもの。掛け算の順番は行列同士の掛け算と同じにしてある
+template<typename Vector>
+inline void MakeRotation(const Vector& rotate, float (&r)[3][3]) {
+	float sx, cx, sy, cy, sz, cz;
+	SinCos(rotate.x, sx, cx);
+	SinCos(rotate.y, sy, cy);
+	SinCos(rotate.z, sz, cz);
+
+	// Rx * Ry
+	float xy10 = sx * sy;
+	float xy12 = sx * cy;
+	float xy20 = cx * sy;
+	float xy22 = cx * cy;
+
+	// (Rx * Ry) * Rz
+	r[0][0] = cy * cz;
+	r[0][1] = cy * sz;
+	r[0][2] = -sy;
+	r[1][0] = xy10 * cz + cx * -sz;
+	r[1][1] = xy10 * sz + cx * cz;
+	r[1][2] = xy12;
+	r[2][0] = xy20 * cz + -sx * -sz;
+	r[2][1] = xy20 * sz + -sx * cz;
+	r[2][2] = xy22;
+}
+
+/// <summary>
+/// 等倍スケール（敵など。スケールは1つの値を掛けるだけ）
+/// </summary>
+template<typename Matrix, typename Vector>
+inline void MakeUniformScale(Matrix& result, float scale, const Vector& rotate, const Vector& translate) {
+	float r[3][3];
+	MakeRotation(rotate, r);
+	SetRows(
+	    result, scale * r[0][0], scale * r[0][1], scale * r[0][2], scale * r[1][0], scale * r[1][1], scale * r[1][2], scale * r[2][0], scale * r[2][1],
+	    scale * r[2][2], translate);
+}
+
+/// <summary>
+/// 一般の場合（軸ごとのスケールと3軸の回転）
+/// </summary>
+template<typename Matrix, typename Vector>
+inline void MakeGeneral(Matrix& result, const Vector& scale, const Vector& rotate, const Vector& translate) {
+	float r[3][3];
+	MakeRotation(rotate, r);
+	SetRows(
+	    result, scale.x * r[0][0], scale.x * r[0][1], scale.x * r[0][2], scale.y * r[1][0], scale.y * r[1][1], scale.y * r[1][2], scale.z * r[2][0],
+	    scale.z * r[2][1], scale.z * r[2][2], translate);
+}
+
+/// <summary>
+/// 値を見て、使える中で一番軽い組み立て方を選ぶ
+/// </summary>
+template<typename Matrix, typename Vector>
+inline void Make(Matrix& result, const Vector& scale, const Vector& rotate, const Vector& translate) {
+	bool isUniformScale = scale.x == scale.y && scale.y == scale.z;
+	if (rotate.x == 0.0f && rotate.y == 0.0f) {
+		if (rotate.z != 0.0f) {
+			MakeRotateZ(result, scale, rotate.z, translate);
+		} else if (isUniformScale && scale.x == 1.0f) {
+			MakeTranslate(result, translate);
+		} else {
+			MakeScaleTranslate(result, scale, translate);
+		}
+	} else if (isUniformScale) {
+		MakeUniformScale(result, scale.x, rotate, translate);
+	} else {
+		MakeGeneral(result, scale, rotate, translate);
+	}
+}
+
+} // namespace AffineMatrix
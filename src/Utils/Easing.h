@@ -1,10 +1,43 @@
 #pragma once
-float EaseOutQuint(float t);
+// 式で計算する版（constexpr なので表を作るときにも使う）
+constexpr float EaseOutQuint(float t) {
+	float f = t - 1.0f;
+	return f * f * f * f * f + 1.0f;
+}
 
-float EaseOutQuad(float t);
+constexpr float EaseOutQuad(float t) { return 1.0f - (1.0f - t) * (1.0f - t); }
 
-float Lerp(float start, float end, float t);
-float EaseOutQuart(float t);
-float EaseInOutQuad(float t);
+constexpr float Lerp(float start, float end, float t) { return start + (end - start) * t; }
 
-float EaseOutBack(float t);
+// EaseOutQuart (4乗の減速)
+constexpr float EaseOutQuart(float t) {
+	float f = t - 1.0f;
+	return 1.0f - (f * f * f * f);
+}
+
+// EaseInOutQuad (前半加速・後半減速)
+constexpr float EaseInOutQuad(float t) {
+	if (t < 0.5f) {
+		return 2.0f * t * t;
+	} else {
+		float f = -2.0f * t + 2.0f;
+		return 1.0f - (f * f) / 2.0f;
+	}
+}
+
+// t は 0.0 ～ 1.0 の範囲
+constexpr float EaseOutBack(float t) {
+	const float c1 = 1.70158f;
+	const float c3 = c1 + 1.0f;
+	float f = t - 1.0f;
+	return 1.0f + c3 * (f * f * f) + c1 * (f * f);
+}
+
+// 表を引く版（Easing.cpp でコンパイル時に作った表を線形補間する。t は 0.0 ～ 1.0 に収める）
+// 表と式の差の最大は fast_math_bench で確認している（どれも 4e-5 以下）。
+// 今の式は掛け算数回で表を引くより速いものがほとんどなので、普段は式の版を使う（表は式を重くしたとき用）
+float EaseOutQuintBaked(float t);
+float EaseOutQuadBaked(float t);
+float EaseOutQuartBaked(float t);
+float EaseInOutQuadBaked(float t);
+float EaseOutBackBaked(float t);
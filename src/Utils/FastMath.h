@@ -0,0 +1,206 @@
+#pragma once
+#include "Utils/SimdMath.h" // 使う命令セット（SIMD_MATH_SSE）を合わせるために必要
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+/// <summary>
+/// 三角関数の近似と、コンパイル時に作る表
+/// sin/cos は範囲を π/4 ごとに折りたたんでから多項式で求める（Cephes の sinf/cosf と同じ係数）。
+/// 標準ライブラリを呼ばないので constexpr でも使える。乗算と加算を FMA にまとめない（-ffp-contract=off・/fp:precise）ビルドなら、どの環境でも同じ値になる
+/// （/fp:fast などでまとめると下位ビットが変わる。シミュレーションの座標に入る値は Sim/SimMath.h の SimReal 版を使う）。
+/// スカラー版と SIMD 版は計算の順番を同じにしてあるので、結果は1ビットも違わない。
+/// 誤差（std::sin / std::cos を double で計算した値との差の最大。fast_math_bench で確認）
+/// |x| ≦ 8192 で 1.0e-7 以下（float の丸め1回分程度）。
+/// 8192 より大きい角度は折りたたみの誤差が増えるので扱わない（呼び出し側で範囲に収めておくこと）
+/// </summary>
+namespace FastMath {
+
+// 正しく計算できる角度の大きさの上限
+inline constexpr float kMaxRadian = 8192.0f;
+
+namespace Detail {
+
+inline constexpr float kFourOverPi = 1.27323954473516f;
+// π/4 を3つに分けたもの（引き算の丸め誤差を減らす）
+inline constexpr float kQuarterPi1 = 0.78515625f;
+inline constexpr float kQuarterPi2 = 2.4187564849853515625e-4f;
+inline constexpr float kQuarterPi3 = 3.77489497744594108e-8f;
+// sin(r) = r + r^3 * (s0 * z^2 + s1 * z + s2)、z = r^2
+inline constexpr float kSin0 = -1.9515295891e-4f;
+inline constexpr float kSin1 = 8.3321608736e-3f;
+inline constexpr float kSin2 = -1.6666654611e-1f;
+// cos(r) = 1 - z / 2 + z^2 * (c0 * z^2 + c1 * z + c2)
+inline constexpr float kCos0 = 2.443315711809948e-5f;
+inline constexpr float kCos1 = -1.388731625493765e-3f;
+inline constexpr float kCos2 = 4.166664568298827e-2f;
+
+inline constexpr uint32_t kSignBit = 0x80000000u;
+
+constexpr float FlipSign(float value, bool isFlipped) { return isFlipped ? std::bit_cast<float>(std::bit_cast<uint32_t>(value) ^ kSignBit) : value; }
+
+} // namespace Detail
+
+/// <summary>
+/// sin と cos を同時に求める
+/// </summary>
+constexpr void SinCos(float radian, float& outSin, float& outCos) {
+	using namespace Detail;
+
+	uint32_t bits = std::bit_cast<uint32_t>(radian);
+	bool isNegative = (bits & kSignBit) != 0;
+	float absolute = std::bit_cast<float>(bits & ~kSignBit);
+
+	// 一番近い π/4 の偶数倍（j）を引いて、-π/4 ～ π/4 に折りたたむ
+	int32_t quadrant = static_cast<int32_t>(absolute * kFourOverPi);
+	quadrant = (quadrant + 1) & ~1;
+	float y = static_cast<float>(quadrant);
+	float r = ((absolute - y * kQuarterPi1) - y * kQuarterPi2) - y * kQuarterPi3;
+	float z = r * r;
+
+	float sinPolynomial = ((kSin0 * z + kSin1) * z + kSin2) * z * r + r;
+	float cosPolynomial = ((kCos0 * z + kCos1) * z + kCos2) * z * z - 0.5f * z + 1.0f;
+
+	// j が 2, 6 のときは sin と cos が入れ替わり、j によって符号が変わる
+	bool isSwapped = (quadrant & 2) != 0;
+	outSin = FlipSign(isSwapped ? cosPolynomial : sinPolynomial, ((quadrant & 4) != 0) != isNegative);
+	outCos = FlipSign(isSwapped ? sinPolynomial : cosPolynomial, ((quadrant + 2) & 4) != 0);
+}
+
+constexpr float Sin(float radian) {
+	float sinValue = 0.0f;
+	float cosValue = 0.0f;
+	SinCos(radian, sinValue, cosValue);
+	return sinValue;
+}
+
+constexpr float Cos(float radian) {
+	float sinValue = 0.0f;
+	float cosValue = 0.0f;
+	SinCos(radian, sinValue, cosValue);
+	return cosValue;
+}
+
+#if defined(SIMD_MATH_SSE)
+/// <summary>
+/// 4つの角度の sin と cos を同時に求める（スカラー版 SinCos と同じ値になる）
+/// </summary>
+inline void SinCos4(__m128 radian, __m128& outSin, __m128& outCos) {
+	using namespace Detail;
+	const __m128 signMask = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(kSignBit)));
+	const __m128i two = _mm_set1_epi32(2);
+	const __m128i four = _mm_set1_epi32(4);
+
+	__m128 sign = _mm_and_ps(radian, signMask);
+	__m128 absolute = _mm_andnot_ps(signMask, radian);
+
+	__m128i quadrant = _mm_cvttps_epi32(_mm_mul_ps(absolute, _mm_set1_ps(kFourOverPi)));
+	quadrant = _mm_and_si128(_mm_add_epi32(quadrant, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+	__m128 y = _mm_cvtepi32_ps(quadrant);
+	__m128 r = _mm_sub_ps(absolute, _mm_mul_ps(y, _mm_set1_ps(kQuarterPi1)));
+	r = _mm_sub_ps(r, _mm_mul_ps(y, _mm_set1_ps(kQuarterPi2)));
+	r = _mm_sub_ps(r, _mm_mul_ps(y, _mm_set1_ps(kQuarterPi3)));
+	__m128 z = _mm_mul_ps(r, r);
+
+	__m128 sinPolynomial = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(kSin0), z), _mm_set1_ps(kSin1));
+	sinPolynomial = _mm_add_ps(_mm_mul_ps(sinPolynomial, z), _mm_set1_ps(kSin2));
+	sinPolynomial = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(sinPolynomial, z), r), r);
+	__m128 cosPolynomial = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(kCos0), z), _mm_set1_ps(kCos1));
+	cosPolynomial = _mm_add_ps(_mm_mul_ps(cosPolynomial, z), _mm_set1_ps(kCos2));
+	cosPolynomial = _mm_sub_ps(_mm_mul_ps(_mm_mul_ps(cosPolynomial, z), z), _mm_mul_ps(_mm_set1_ps(0.5f), z));
+	cosPolynomial = _mm_add_ps(cosPolynomial, _mm_set1_ps(1.0f));
+
+	__m128 isSwapped = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, two), two));
+	__m128 sinValue = _mm_or_ps(_mm_and_ps(isSwapped, cosPolynomial), _mm_andnot_ps(isSwapped, sinPolynomial));
+	__m128 cosValue = _mm_or_ps(_mm_and_ps(isSwapped, sinPolynomial), _mm_andnot_ps(isSwapped, cosPolynomial));
+
+	// 4 のビットを符号ビットの位置へずらして反転に使う
+	__m128 sinSign = _mm_xor_ps(_mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, four), 29)), sign);
+	__m128 cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, two), four), 29));
+	outSin = _mm_xor_ps(sinValue, sinSign);
+	outCos = _mm_xor_ps(cosValue, cosSign);
+}
+#endif
+
+/// <summary>
+/// 配列の全ての角度の sin と cos を求める（SSE が使えれば4つずつ）
+/// </summary>
+inline void SinCos(const float* radians, float* outSin, float* outCos, size_t count) {
+	size_t i = 0;
+#if defined(SIMD_MATH_SSE)
+	for (; i + 4 <= count; i += 4) {
+		__m128 sinValue;
+		__m128 cosValue;
+		SinCos4(_mm_loadu_ps(radians + i), sinValue, cosValue);
+		_mm_storeu_ps(outSin + i, sinValue);
+		_mm_storeu_ps(outCos + i, cosValue);
+	}
+#endif
+	for (; i < count; ++i) {
+		SinCos(radians[i], outSin[i], outCos[i]);
+	}
+}
+
+// --- コンパイル時に作る表 ---
+
+/// <summary>
+/// XY 平面上の向き（長さ 1）
+/// </summary>
+struct Direction2 {
+	float x;
+	float y;
+};
+
+/// <summary>
+/// 円を count 等分した向きの表（0番目が +X、反時計回り）
+/// </summary>
+template<size_t count>
+constexpr std::array<Direction2, count> MakeDirectionTable() {
+	std::array<Direction2, count> table{};
+	const float angleUnit = (2.0f * 3.14159265f) / static_cast<float>(count);
+	for (size_t i = 0; i < count; ++i) {
+		float sinValue = 0.0f;
+		float cosValue = 0.0f;
+		SinCos(angleUnit * static_cast<float>(i), sinValue, cosValue);
+		table[i] = {cosValue, sinValue};
+	}
+	return table;
+}
+
+/// <summary>
+/// 0 ～ 1 の関数を等間隔で計算しておき、線形補間で引く表
+/// 誤差は 区間幅^2 / 8 * |f''| の最大 以下
+/// </summary>
+template<size_t intervalCount>
+class CurveTable {
+public:
+	template<typename Function>
+	constexpr explicit CurveTable(Function function) {
+		for (size_t i = 0; i <= intervalCount; ++i) {
+			values_[i] = function(static_cast<float>(i) / static_cast<float>(intervalCount));
+		}
+	}
+
+	/// <summary>
+	/// t の値を引く（0 ～ 1 の外は端の値）
+	/// </summary>
+	constexpr float operator()(float t) const {
+		float position = t * static_cast<float>(intervalCount);
+		// NaN も 0 側に寄せる
+		if (!(position > 0.0f)) {
+			return values_[0];
+		}
+		if (position >= static_cast<float>(intervalCount)) {
+			return values_[intervalCount];
+		}
+		size_t index = static_cast<size_t>(position);
+		float fraction = position - static_cast<float>(index);
+		return values_[index] + (values_[index + 1] - values_[index]) * fraction;
+	}
+
+private:
+	std::array<float, intervalCount + 1> values_{};
+};
+
+} // namespace FastMath
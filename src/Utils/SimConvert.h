@@ -0,0 +1,9 @@
+#pragma once
+#include "KamataEngine.h"
+#include "Sim/SimMath.h"
+
+// シミュレーションのベクトルをエンジンのベクトルへ変換（固定小数点のときはここで float に戻す）
+inline KamataEngine::Vector3 ToVector3(const SimVector3& v) { return {ToFloat(v.x), ToFloat(v.y), ToFloat(v.z)}; }
+
+// エンジンのベクトルをシミュレーションのベクトルへ変換
+inline SimVector3 ToSimVector3(const KamataEngine::Vector3& v) { return {v.x, v.y, v.z}; }
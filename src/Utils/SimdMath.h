@@ -0,0 +1,314 @@
+#pragma once
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+
+// 使う命令セットはコンパイル時に決める（SIMD_MATH_FORCE_SCALAR を定義すると SIMD を使わない）
+// ・AVX2 : /arch:AVX2 や -mavx2 を付けたとき。2行（2点）ずつ 256 ビットで計算する
+// ・SSE  : x64 なら常に使える。1行（1点）ずつ 128 ビットで計算する
+// ・scalar : それ以外
+#if !defined(SIMD_MATH_FORCE_SCALAR) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define SIMD_MATH_SSE 1
+#if defined(__AVX2__)
+#define SIMD_MATH_AVX2 1
+#endif
+#include <immintrin.h>
+#endif
+
+/// <summary>
+/// Vector3 / Vector4 / Matrix4x4（行ベクトル・行優先）の演算
+/// どの命令セットでも足し算・掛け算の順番をスカラーの式と同じにしているので、結果は命令セットによらず同じになる。
+/// エンジンに依存しないよう、x/y/z(/w) を持つベクトルと m[4][4] を持つ行列なら何でも受け取れるようにしている
+/// </summary>
+namespace SimdMath {
+
+// 使っている命令セットの名前（ベンチマークの表示用）
+#if defined(SIMD_MATH_AVX2)
+inline constexpr const char* kInstructionSet = "avx2";
+#elif defined(SIMD_MATH_SSE)
+inline constexpr const char* kInstructionSet = "sse";
+#else
+inline constexpr const char* kInstructionSet = "scalar";
+#endif
+
+// --- 1つのベクトル同士の演算（SIMD にしても速くならないのでスカラーで計算する） ---
+
+template<typename Vec3>
+inline float Dot(const Vec3& v1, const Vec3& v2) {
+	return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z;
+}
+
+template<typename Vec3>
+inline Vec3 Cross(const Vec3& v1, const Vec3& v2) {
+	return {v1.y * v2.z - v1.z * v2.y, v1.z * v2.x - v1.x * v2.z, v1.x * v2.y - v1.y * v2.x};
+}
+
+template<typename Vec3>
+inline float Length(const Vec3& v) {
+	return std::sqrt(Dot(v, v));
+}
+
+// 長さ 0 のベクトルはそのまま返す
+template<typename Vec3>
+inline Vec3 Normalize(const Vec3& v) {
+	float length = Length(v);
+	if (length != 0.0f) {
+		return {v.x / length, v.y / length, v.z / length};
+	}
+	return v;
+}
+
+namespace Detail {
+
+#if defined(SIMD_MATH_SSE)
+// v.x * row0 + v.y * row1 + v.z * row2 (+ v.w * row3)
+inline __m128 MultiplyRow(__m128 x, __m128 y, __m128 z, const float (&m)[4][4]) {
+	__m128 result = _mm_mul_ps(x, _mm_loadu_ps(m[0]));
+	result = _mm_add_ps(result, _mm_mul_ps(y, _mm_loadu_ps(m[1])));
+	return _mm_add_ps(result, _mm_mul_ps(z, _mm_loadu_ps(m[2])));
+}
+inline __m128 MultiplyRow(__m128 x, __m128 y, __m128 z, __m128 w, const float (&m)[4][4]) {
+	return _mm_add_ps(MultiplyRow(x, y, z, m), _mm_mul_ps(w, _mm_loadu_ps(m[3])));
+}
+#endif
+
+#if defined(SIMD_MATH_AVX2)
+// 2点（w = 1）を同じ行列で変換する（下位 128 ビットに1点目、上位に2点目）
+inline __m256 TransformPoint2(const float (&point1)[3], const float (&point2)[3], const float (&m)[4][4]) {
+	__m256 x = _mm256_set_m128(_mm_set1_ps(point2[0]), _mm_set1_ps(point1[0]));
+	__m256 y = _mm256_set_m128(_mm_set1_ps(point2[1]), _mm_set1_ps(point1[1]));
+	__m256 z = _mm256_set_m128(_mm_set1_ps(point2[2]), _mm_set1_ps(point1[2]));
+	__m256 result = _mm256_mul_ps(x, _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m[0])));
+	result = _mm256_add_ps(result, _mm256_mul_ps(y, _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m[1]))));
+	result = _mm256_add_ps(result, _mm256_mul_ps(z, _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m[2]))));
+	return _mm256_add_ps(result, _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m[3])));
+}
+#endif
+
+// 行列 b の4行
+struct MatrixRows {
+#if defined(SIMD_MATH_SSE)
+	__m128 rows[4];
+#else
+	float rows[4][4];
+#endif
+};
+
+inline MatrixRows LoadRows(const float (&m)[4][4]) {
+	MatrixRows result;
+#if defined(SIMD_MATH_SSE)
+	for (int i = 0; i < 4; ++i) {
+		result.rows[i] = _mm_loadu_ps(m[i]);
+	}
+#else
+	for (int i = 0; i < 4; ++i) {
+		for (int j = 0; j < 4; ++j) {
+			result.rows[i][j] = m[i][j];
+		}
+	}
+#endif
+	return result;
+}
+
+// 行列 a（4行）と、読み込み済みの行列 b の積を out へ書き込む（out は a と同じでもよい）
+inline void MultiplyMatrix(const float (&a)[4][4], const MatrixRows& b, float (&out)[4][4]) {
+#if defined(SIMD_MATH_AVX2)
+	// 2行ずつ（下位 128 ビットに上の行、上位に下の行）。各行の成分は 128 ビットの中で並べ替えて配る
+	__m256 b0 = _mm256_set_m128(b.rows[0], b.rows[0]);
+	__m256 b1 = _mm256_set_m128(b.rows[1], b.rows[1]);
+	__m256 b2 = _mm256_set_m128(b.rows[2], b.rows[2]);
+	__m256 b3 = _mm256_set_m128(b.rows[3], b.rows[3]);
+	__m256 rows01 = _mm256_loadu_ps(a[0]);
+	__m256 rows23 = _mm256_loadu_ps(a[2]);
+	__m256 result01 = _mm256_mul_ps(_mm256_permute_ps(rows01, _MM_SHUFFLE(0, 0, 0, 0)), b0);
+	__m256 result23 = _mm256_mul_ps(_mm256_permute_ps(rows23, _MM_SHUFFLE(0, 0, 0, 0)), b0);
+	result01 = _mm256_add_ps(result01, _mm256_mul_ps(_mm256_permute_ps(rows01, _MM_SHUFFLE(1, 1, 1, 1)), b1));
+	result23 = _mm256_add_ps(result23, _mm256_mul_ps(_mm256_permute_ps(rows23, _MM_SHUFFLE(1, 1, 1, 1)), b1));
+	result01 = _mm256_add_ps(result01, _mm256_mul_ps(_mm256_permute_ps(rows01, _MM_SHUFFLE(2, 2, 2, 2)), b2));
+	result23 = _mm256_add_ps(result23, _mm256_mul_ps(_mm256_permute_ps(rows23, _MM_SHUFFLE(2, 2, 2, 2)), b2));
+	result01 = _mm256_add_ps(result01, _mm256_mul_ps(_mm256_permute_ps(rows01, _MM_SHUFFLE(3, 3, 3, 3)), b3));
+	result23 = _mm256_add_ps(result23, _mm256_mul_ps(_mm256_permute_ps(rows23, _MM_SHUFFLE(3, 3, 3, 3)), b3));
+	_mm256_storeu_ps(out[0], result01);
+	_mm256_storeu_ps(out[2], result23);
+#elif defined(SIMD_MATH_SSE)
+	__m128 result[4];
+	for (int i = 0; i < 4; ++i) {
+		__m128 row = _mm_loadu_ps(a[i]);
+		__m128 value = _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(0, 0, 0, 0)), b.rows[0]);
+		value = _mm_add_ps(value, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(1, 1, 1, 1)), b.rows[1]));
+		value = _mm_add_ps(value, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(2, 2, 2, 2)), b.rows[2]));
+		result[i] = _mm_add_ps(value, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(3, 3, 3, 3)), b.rows[3]));
+	}
+	for (int i = 0; i < 4; ++i) {
+		_mm_storeu_ps(out[i], result[i]);
+	}
+#else
+	float result[4][4];
+	for (int i = 0; i < 4; ++i) {
+		for (int j = 0; j < 4; ++j) {
+			result[i][j] = a[i][0] * b.rows[0][j] + a[i][1] * b.rows[1][j] + a[i][2] * b.rows[2][j] + a[i][3] * b.rows[3][j];
+		}
+	}
+	for (int i = 0; i < 4; ++i) {
+		for (int j = 0; j < 4; ++j) {
+			out[i][j] = result[i][j];
+		}
+	}
+#endif
+}
+
+// 点（w = 1）を変換して w で割る
+inline void TransformPoint(float x, float y, float z, const float (&m)[4][4], float (&out)[3]) {
+#if defined(SIMD_MATH_SSE)
+	__m128 result = _mm_add_ps(MultiplyRow(_mm_set1_ps(x), _mm_set1_ps(y), _mm_set1_ps(z), m), _mm_loadu_ps(m[3]));
+	float values[4];
+	_mm_storeu_ps(values, result);
+	float w = values[3];
+	assert(w != 0.0f);
+	out[0] = values[0] / w;
+	out[1] = values[1] / w;
+	out[2] = values[2] / w;
+#else
+	float w = x * m[0][3] + y * m[1][3] + z * m[2][3] + m[3][3];
+	assert(w != 0.0f);
+	out[0] = (x * m[0][0] + y * m[1][0] + z * m[2][0] + m[3][0]) / w;
+	out[1] = (x * m[0][1] + y * m[1][1] + z * m[2][1] + m[3][1]) / w;
+	out[2] = (x * m[0][2] + y * m[1][2] + z * m[2][2] + m[3][2]) / w;
+#endif
+}
+
+} // namespace Detail
+
+// --- 1つのベクトル・行列の演算 ---
+
+/// <summary>
+/// 点を変換する（w = 1 として変換し、w で割る）
+/// </summary>
+template<typename Vec3, typename Matrix>
+inline Vec3 Transform(const Vec3& vector, const Matrix& matrix) {
+	float out[3];
+	Detail::TransformPoint(vector.x, vector.y, vector.z, matrix.m, out);
+	return {out[0], out[1], out[2]};
+}
+
+/// <summary>
+/// 方向を変換する（平行移動の影響を受けない）
+/// 1つだけなら SIMD レジスタへの出し入れの方が重いので、どの命令セットでもスカラーで計算する
+/// </summary>
+template<typename Vec3, typename Matrix>
+inline Vec3 TransformNormal(const Vec3& vector, const Matrix& matrix) {
+	const float(&m)[4][4] = matrix.m;
+	return {
+	    vector.x * m[0][0] + vector.y * m[1][0] + vector.z * m[2][0], vector.x * m[0][1] + vector.y * m[1][1] + vector.z * m[2][1],
+	    vector.x * m[0][2] + vector.y * m[1][2] + vector.z * m[2][2]};
+}
+
+/// <summary>
+/// 4成分のベクトルを変換する
+/// </summary>
+template<typename Vec4, typename Matrix>
+inline Vec4 Transform4(const Vec4& vector, const Matrix& matrix) {
+	const float(&m)[4][4] = matrix.m;
+#if defined(SIMD_MATH_SSE)
+	float values[4];
+	_mm_storeu_ps(values, Detail::MultiplyRow(_mm_set1_ps(vector.x), _mm_set1_ps(vector.y), _mm_set1_ps(vector.z), _mm_set1_ps(vector.w), m));
+	return {values[0], values[1], values[2], values[3]};
+#else
+	return {
+	    vector.x * m[0][0] + vector.y * m[1][0] + vector.z * m[2][0] + vector.w * m[3][0], vector.x * m[0][1] + vector.y * m[1][1] + vector.z * m[2][1] + vector.w * m[3][1],
+	    vector.x * m[0][2] + vector.y * m[1][2] + vector.z * m[2][2] + vector.w * m[3][2], vector.x * m[0][3] + vector.y * m[1][3] + vector.z * m[2][3] + vector.w * m[3][3]};
+#endif
+}
+
+/// <summary>
+/// 行列の積 a * b
+/// </summary>
+template<typename Matrix>
+inline Matrix Multiply(const Matrix& a, const Matrix& b) {
+	Matrix result;
+	Detail::MultiplyMatrix(a.m, Detail::LoadRows(b.m), result.m);
+	return result;
+}
+
+/// <summary>
+/// ビュー行列（LookAt）を作る
+/// </summary>
+template<typename Matrix, typename Vec3>
+inline Matrix MakeLookAt(const Vec3& eye, const Vec3& target, const Vec3& up) {
+	Vec3 zaxis = Normalize(Vec3{target.x - eye.x, target.y - eye.y, target.z - eye.z});
+	Vec3 xaxis = Normalize(Cross(up, zaxis));
+	Vec3 yaxis = Cross(zaxis, xaxis);
+
+	Matrix result;
+	result.m[0][0] = xaxis.x;
+	result.m[0][1] = yaxis.x;
+	result.m[0][2] = zaxis.x;
+	result.m[0][3] = 0.0f;
+	result.m[1][0] = xaxis.y;
+	result.m[1][1] = yaxis.y;
+	result.m[1][2] = zaxis.y;
+	result.m[1][3] = 0.0f;
+	result.m[2][0] = xaxis.z;
+	result.m[2][1] = yaxis.z;
+	result.m[2][2] = zaxis.z;
+	result.m[2][3] = 0.0f;
+	result.m[3][0] = -Dot(eye, xaxis);
+	result.m[3][1] = -Dot(eye, yaxis);
+	result.m[3][2] = -Dot(eye, zaxis);
+	result.m[3][3] = 1.0f;
+	return result;
+}
+
+// --- 配列へのまとめての演算 ---
+
+/// <summary>
+/// 点の配列をまとめて変換する（in と out は同じ配列でもよい）
+/// </summary>
+template<typename Vec3, typename Matrix>
+inline void TransformPoints(const Vec3* in, Vec3* out, size_t count, const Matrix& matrix) {
+	const float(&m)[4][4] = matrix.m;
+	size_t i = 0;
+#if defined(SIMD_MATH_AVX2)
+	// 2点ずつ（下位 128 ビットに1点目、上位に2点目）
+	for (; i + 2 <= count; i += 2) {
+		const float point1[3] = {in[i].x, in[i].y, in[i].z};
+		const float point2[3] = {in[i + 1].x, in[i + 1].y, in[i + 1].z};
+		__m256 result = Detail::TransformPoint2(point1, point2, m);
+		// 各点の w で割る
+		result = _mm256_div_ps(result, _mm256_permute_ps(result, _MM_SHUFFLE(3, 3, 3, 3)));
+		float values[8];
+		_mm256_storeu_ps(values, result);
+		out[i] = {values[0], values[1], values[2]};
+		out[i + 1] = {values[4], values[5], values[6]};
+	}
+#endif
+	for (; i < count; ++i) {
+		float values[3];
+		Detail::TransformPoint(in[i].x, in[i].y, in[i].z, m, values);
+		out[i] = {values[0], values[1], values[2]};
+	}
+}
+
+/// <summary>
+/// 行列の配列をまとめて掛ける out[i] = a[i] * b[i]（out は a と同じ配列でもよい）
+/// </summary>
+template<typename Matrix>
+inline void MultiplyMatrices(const Matrix* a, const Matrix* b, Matrix* out, size_t count) {
+	for (size_t i = 0; i < count; ++i) {
+		Detail::MultiplyMatrix(a[i].m, Detail::LoadRows(b[i].m), out[i].m);
+	}
+}
+
+/// <summary>
+/// 行列の配列に同じ行列を掛ける out[i] = a[i] * b（ワールド行列にビュー・プロジェクションを掛けるなど。out は a と同じ配列でもよい）
+/// </summary>
+template<typename Matrix>
+inline void MultiplyMatrices(const Matrix* a, const Matrix& b, Matrix* out, size_t count) {
+	// b の行は1回だけ読み込む
+	const Detail::MatrixRows rows = Detail::LoadRows(b.m);
+	for (size_t i = 0; i < count; ++i) {
+		Detail::MultiplyMatrix(a[i].m, rows, out[i].m);
+	}
+}
+
+} // namespace SimdMath
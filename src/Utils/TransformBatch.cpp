@@ -0,0 +1,142 @@
+#include "Utils/TransformBatch.h"
+#include "Utils/FastMath.h"
+
+uint32_t TransformBatch::Add(
+    float scaleX, float scaleY, float scaleZ, float rotationX, float rotationY, float rotationZ, float translationX, float translationY, float translationZ) {
+	// 足りなければ kLaneCount 個ずつ広げる（余りの要素は 0 のまま計算して捨てる）
+	if (count_ == matrices_.size()) {
+		size_t capacity = matrices_.size() + kLaneCount;
+		for (std::vector<float>& component : components_) {
+			component.resize(capacity, 0.0f);
+		}
+		for (std::vector<float>& trigonometric : trigonometrics_) {
+			trigonometric.resize(capacity, 0.0f);
+		}
+		matrices_.resize(capacity);
+	}
+
+	const float values[kComponentCount] = {scaleX, scaleY, scaleZ, rotationX, rotationY, rotationZ, translationX, translationY, translationZ};
+	for (int component = 0; component < kComponentCount; ++component) {
+		components_[component][count_] = values[component];
+	}
+	return static_cast<uint32_t>(count_++);
+}
+
+void TransformBatch::Build() {
+	// 余りの分まで4つずつ計算する
+	size_t laneCount = (count_ + kLaneCount - 1) / kLaneCount * kLaneCount;
+
+	// --- sin/cos をまとめて求める（FastMath の SIMD 版。AffineMatrix::Make と同じ値になる） ---
+	for (int axis = 0; axis < 3; ++axis) {
+		FastMath::SinCos(
+		    components_[kRotationX + axis].data(), trigonometrics_[kSinX + axis * 2].data(), trigonometrics_[kCosX + axis * 2].data(), laneCount);
+	}
+
+	const float* scaleX = components_[kScaleX].data();
+	const float* scaleY = components_[kScaleY].data();
+	const float* scaleZ = components_[kScaleZ].data();
+	const float* translationX = components_[kTranslationX].data();
+	const float* translationY = components_[kTranslationY].data();
+	const float* translationZ = components_[kTranslationZ].data();
+	const float* sinX = trigonometrics_[kSinX].data();
+	const float* cosX = trigonometrics_[kCosX].data();
+	const float* sinY = trigonometrics_[kSinY].data();
+	const float* cosY = trigonometrics_[kCosY].data();
+	const float* sinZ = trigonometrics_[kSinZ].data();
+	const float* cosZ = trigonometrics_[kCosZ].data();
+
+	// --- 行列を組み立てる（式と掛け算の順番は AffineMatrix::MakeGeneral と同じ） ---
+#if defined(SIMD_MATH_SSE)
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 one = _mm_set1_ps(1.0f);
+	// 符号の反転は符号ビットだけを変える（0 - x だと +0 の符号が変わらない）
+	const __m128 signMask = _mm_set1_ps(-0.0f);
+	for (size_t i = 0; i < laneCount; i += kLaneCount) {
+		__m128 sx = _mm_loadu_ps(sinX + i);
+		__m128 cx = _mm_loadu_ps(cosX + i);
+		__m128 sy = _mm_loadu_ps(sinY + i);
+		__m128 cy = _mm_loadu_ps(cosY + i);
+		__m128 sz = _mm_loadu_ps(sinZ + i);
+		__m128 cz = _mm_loadu_ps(cosZ + i);
+		__m128 negativeSx = _mm_xor_ps(sx, signMask);
+		__m128 negativeSy = _mm_xor_ps(sy, signMask);
+		__m128 negativeSz = _mm_xor_ps(sz, signMask);
+
+		// Rx * Ry
+		__m128 xy10 = _mm_mul_ps(sx, sy);
+		__m128 xy12 = _mm_mul_ps(sx, cy);
+		__m128 xy20 = _mm_mul_ps(cx, sy);
+		__m128 xy22 = _mm_mul_ps(cx, cy);
+
+		// (Rx * Ry) * Rz にスケールを掛ける
+		__m128 scale = _mm_loadu_ps(scaleX + i);
+		__m128 row00 = _mm_mul_ps(scale, _mm_mul_ps(cy, cz));
+		__m128 row01 = _mm_mul_ps(scale, _mm_mul_ps(cy, sz));
+		__m128 row02 = _mm_mul_ps(scale, negativeSy);
+		scale = _mm_loadu_ps(scaleY + i);
+		__m128 row10 = _mm_mul_ps(scale, _mm_add_ps(_mm_mul_ps(xy10, cz), _mm_mul_ps(cx, negativeSz)));
+		__m128 row11 = _mm_mul_ps(scale, _mm_add_ps(_mm_mul_ps(xy10, sz), _mm_mul_ps(cx, cz)));
+		__m128 row12 = _mm_mul_ps(scale, xy12);
+		scale = _mm_loadu_ps(scaleZ + i);
+		__m128 row20 = _mm_mul_ps(scale, _mm_add_ps(_mm_mul_ps(xy20, cz), _mm_mul_ps(negativeSx, negativeSz)));
+		__m128 row21 = _mm_mul_ps(scale, _mm_add_ps(_mm_mul_ps(xy20, sz), _mm_mul_ps(negativeSx, cz)));
+		__m128 row22 = _mm_mul_ps(scale, xy22);
+		__m128 row3X = _mm_loadu_ps(translationX + i);
+		__m128 row3Y = _mm_loadu_ps(translationY + i);
+		__m128 row3Z = _mm_loadu_ps(translationZ + i);
+
+		// 4つ分の成分を並べ替えて、行列ごとの行にする
+		__m128 row0W = zero;
+		__m128 row1W = zero;
+		__m128 row2W = zero;
+		__m128 row3W = one;
+		_MM_TRANSPOSE4_PS(row00, row01, row02, row0W);
+		_MM_TRANSPOSE4_PS(row10, row11, row12, row1W);
+		_MM_TRANSPOSE4_PS(row20, row21, row22, row2W);
+		_MM_TRANSPOSE4_PS(row3X, row3Y, row3Z, row3W);
+
+		BatchMatrix* matrices = matrices_.data() + i;
+		_mm_store_ps(matrices[0].m[0], row00);
+		_mm_store_ps(matrices[1].m[0], row01);
+		_mm_store_ps(matrices[2].m[0], row02);
+		_mm_store_ps(matrices[3].m[0], row0W);
+		_mm_store_ps(matrices[0].m[1], row10);
+		_mm_store_ps(matrices[1].m[1], row11);
+		_mm_store_ps(matrices[2].m[1], row12);
+		_mm_store_ps(matrices[3].m[1], row1W);
+		_mm_store_ps(matrices[0].m[2], row20);
+		_mm_store_ps(matrices[1].m[2], row21);
+		_mm_store_ps(matrices[2].m[2], row22);
+		_mm_store_ps(matrices[3].m[2], row2W);
+		_mm_store_ps(matrices[0].m[3], row3X);
+		_mm_store_ps(matrices[1].m[3], row3Y);
+		_mm_store_ps(matrices[2].m[3], row3Z);
+		_mm_store_ps(matrices[3].m[3], row3W);
+	}
+#else
+	for (size_t i = 0; i < laneCount; ++i) {
+		float xy10 = sinX[i] * sinY[i];
+		float xy12 = sinX[i] * cosY[i];
+		float xy20 = cosX[i] * sinY[i];
+		float xy22 = cosX[i] * cosY[i];
+
+		float(&m)[4][4] = matrices_[i].m;
+		m[0][0] = scaleX[i] * (cosY[i] * cosZ[i]);
+		m[0][1] = scaleX[i] * (cosY[i] * sinZ[i]);
+		m[0][2] = scaleX[i] * -sinY[i];
+		m[0][3] = 0.0f;
+		m[1][0] = scaleY[i] * (xy10 * cosZ[i] + cosX[i] * -sinZ[i]);
+		m[1][1] = scaleY[i] * (xy10 * sinZ[i] + cosX[i] * cosZ[i]);
+		m[1][2] = scaleY[i] * xy12;
+		m[1][3] = 0.0f;
+		m[2][0] = scaleZ[i] * (xy20 * cosZ[i] + -sinX[i] * -sinZ[i]);
+		m[2][1] = scaleZ[i] * (xy20 * sinZ[i] + -sinX[i] * cosZ[i]);
+		m[2][2] = scaleZ[i] * xy22;
+		m[2][3] = 0.0f;
+		m[3][0] = translationX[i];
+		m[3][1] = translationY[i];
+		m[3][2] = translationZ[i];
+		m[3][3] = 1.0f;
+	}
+#endif
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// 行列1つ分（エンジンの Matrix4x4 と同じ並び）。1つがちょうどキャッシュライン1本に収まるようそろえる
+/// </summary>
+struct alignas(64) BatchMatrix {
+	float m[4][4];
+};
+
+/// <summary>
+/// 多数のスケール・回転・平行移動から、ワールド行列（S * Rx * Ry * Rz * T）をまとめて作る
+/// 入力は成分ごとの配列（SoA）で持ち、sin/cos を先にまとめて求めてから、4つずつ SIMD で行列を組み立てて
+/// 連続した1つのバッファへ書き出す（バッファはそのまま1回のコピーで GPU へ送れる並び）。
+/// 値は AffineMatrix::Make と同じになる（sin/cos はどちらも FastMath で求める）
+/// </summary>
+class TransformBatch {
+public:
+	/// <summary>
+	/// 積んだものを全て捨てる（確保済みの容量は再利用する）
+	/// </summary>
+	void Clear() { count_ = 0; }
+
+	/// <summary>
+	/// 1つ積む
+	/// </summary>
+	/// <returns>行列の番号（GetMatrix に渡す）</returns>
+	uint32_t Add(float scaleX, float scaleY, float scaleZ, float rotationX, float rotationY, float rotationZ, float translationX, float translationY, float translationZ);
+
+	template<typename Vec3>
+	uint32_t Add(const Vec3& scale, const Vec3& rotation, const Vec3& translation) {
+		return Add(scale.x, scale.y, scale.z, rotation.x, rotation.y, rotation.z, translation.x, translation.y, translation.z);
+	}
+
+	/// <summary>
+	/// 積んだ全ての行列を作る
+	/// </summary>
+	void Build();
+
+	size_t GetCount() const { return count_; }
+	const BatchMatrix& GetMatrix(size_t index) const { return matrices_[index]; }
+	// 作った行列の先頭と、全体のバイト数（GPU へ送るとき用）
+	const BatchMatrix* GetMatrices() const { return matrices_.data(); }
+	size_t GetByteSize() const { return count_ * sizeof(BatchMatrix); }
+
+private:
+	// 一度に組み立てる数（SSE の幅）。配列はこの倍数の長さにしておく
+	static inline const size_t kLaneCount = 4;
+
+	// 成分ごとの配列
+	enum Component {
+		kScaleX,
+		kScaleY,
+		kScaleZ,
+		kRotationX,
+		kRotationY,
+		kRotationZ,
+		kTranslationX,
+		kTranslationY,
+		kTranslationZ,
+		kComponentCount,
+	};
+
+	// 回転の sin/cos（Build の途中で使う）
+	enum Trigonometric {
+		kSinX,
+		kCosX,
+		kSinY,
+		kCosY,
+		kSinZ,
+		kCosZ,
+		kTrigonometricCount,
+	};
+
+	std::vector<float> components_[kComponentCount];
+	std::vector<float> trigonometrics_[kTrigonometricCount];
+	std::vector<BatchMatrix> matrices_;
+	size_t count_ = 0;
+};
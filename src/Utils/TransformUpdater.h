@@ -1,6 +1,18 @@
 #pragma once
 #include"KamataEngine.h"
 
+/// <summary>
+/// 最後に行列を計算したときのスケール・回転・平行移動
+/// （WorldTransform はエンジン側のクラスなので、WorldTransform と並べて持たせる）
+/// </summary>
+struct TransformCache {
+	KamataEngine::Vector3 scale = {};
+	KamataEngine::Vector3 rotation = {};
+	KamataEngine::Vector3 translation = {};
+	// 一度も計算していなければ false（次の更新で必ず計算する）
+	bool isValid = false;
+};
+
 /// <summary>///
 /// 行列を計算・転送する
 /// </summary>///
@@ -9,6 +21,24 @@ class TransformUpdater {
 public:
 	static void WorldTransformUpdate(KamataEngine::WorldTransform& worldTransforme);
 
+	/// <summary>
+	/// スケール・回転・平行移動が前回から変わっていたときだけ、行列を計算して転送する
+	/// </summary>
+	/// <returns>計算し直したら true</returns>
+	static bool WorldTransformUpdate(KamataEngine::WorldTransform& worldTransforme, TransformCache& cache);
+
+	/// <summary>
+	/// 行列の計算だけを行う（転送しない）
+	/// RenderSnapshot 経由で描画するものは、描画側が matWorld_ を自分のワールド変換へ転送するので、こちらを使う
+	/// </summary>
+	static void UpdateMatrix(KamataEngine::WorldTransform& worldTransforme);
+
+	/// <summary>
+	/// スケール・回転・平行移動が前回から変わっていたときだけ、行列を計算する（転送しない）
+	/// </summary>
+	/// <returns>計算し直したら true</returns>
+	static bool UpdateMatrix(KamataEngine::WorldTransform& worldTransforme, TransformCache& cache);
+
 	// Z軸回転行列の作成
 	static KamataEngine::Matrix4x4 MakeRoteZMatrix(float radian);
 
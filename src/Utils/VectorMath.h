@@ -1,15 +1,13 @@
 #pragma once
 #include "KamataEngine.h" // Vector3などの定義が必要なため
+#include "Utils/SimdMath.h"
 #include <cmath>
 
-// Vector3の正規化
-inline KamataEngine::Vector3 Normalize(const KamataEngine::Vector3& v) {
-	float length = std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
-	if (length != 0.0f) {
-		return {v.x / length, v.y / length, v.z / length};
-	}
-	return v; // ゼロベクトルの場合はそのまま返す
-}
+// Vector3の正規化（ゼロベクトルの場合はそのまま返す）
+inline KamataEngine::Vector3 Normalize(const KamataEngine::Vector3& v) { return SimdMath::Normalize(v); }
+
+// Vector3の長さを計算
+inline float Length(const KamataEngine::Vector3& v) { return SimdMath::Length(v); }
 
 // Vector2の長さを計算
 inline float Length(const KamataEngine::Vector2& v) { 
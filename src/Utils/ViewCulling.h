@@ -0,0 +1,136 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+/// <summary>
+/// カメラに映る範囲（XY 平面上の矩形）を求め、画面外の物を描画・更新から外すための判定
+/// ビュー行列（回転と平行移動だけ）と透視投影行列から、画面の四隅を通る視線が
+/// 奥行き nearZ と farZ の平面と交わる点を求め、それを全て含む XY の矩形を映る範囲とする。
+/// カメラが Z 軸まわりに回っていても、回った画面を囲む矩形になる。
+/// エンジンに依存しないよう、m[4][4] を持つ行列なら何でも受け取れるようにしている
+/// </summary>
+namespace ViewCulling {
+
+/// <summary>
+/// XY 平面上の矩形
+/// </summary>
+struct Rect {
+	float left;
+	float right;
+	float bottom;
+	float top;
+
+	/// <summary>
+	/// 全てを含む矩形（映る範囲を求められないとき。何も外さない）
+	/// </summary>
+	static constexpr Rect Infinite() {
+		constexpr float kInfinity = std::numeric_limits<float>::infinity();
+		return {-kInfinity, kInfinity, -kInfinity, kInfinity};
+	}
+
+	/// <summary>
+	/// 点（のまわり半径 margin）が矩形にかかるか
+	/// </summary>
+	bool Contains(float x, float y, float margin = 0.0f) const { return x + margin >= left && x - margin <= right && y + margin >= bottom && y - margin <= top; }
+};
+
+/// <summary>
+/// マップチップの番号の範囲（first ～ last を含む。first > last なら空）
+/// </summary>
+struct TileRange {
+	uint32_t firstColumn;
+	uint32_t lastColumn;
+	uint32_t firstRow;
+	uint32_t lastRow;
+
+	bool IsEmpty() const { return firstColumn > lastColumn || firstRow > lastRow; }
+};
+
+/// <summary>
+/// カメラに映る範囲を求める
+/// </summary>
+/// <param name="nearZ">映る物の奥行きの手前側（ブロックなら -1）</param>
+/// <param name="farZ">映る物の奥行きの奥側（ブロックなら 1）</param>
+/// <param name="outRect">映る範囲</param>
+/// <returns>求められないとき（平面と平行・平面の反対を向いているなど）は false（outRect は Infinite になる）</returns>
+template<typename Matrix>
+inline bool ComputeVisibleRect(const Matrix& matView, const Matrix& matProjection, float nearZ, float farZ, Rect& outRect) {
+	outRect = Rect::Infinite();
+
+	// 透視投影でなければ扱わない
+	const float(&p)[4][4] = matProjection.m;
+	if (p[2][3] != 1.0f || p[0][0] == 0.0f || p[1][1] == 0.0f) {
+		return false;
+	}
+
+	// ビュー行列の列がカメラの向き（行ベクトルなので転置した回転）
+	const float(&v)[4][4] = matView.m;
+	const float axisX[3] = {v[0][0], v[1][0], v[2][0]};
+	const float axisY[3] = {v[0][1], v[1][1], v[2][1]};
+	const float axisZ[3] = {v[0][2], v[1][2], v[2][2]};
+	float eye[3];
+	for (int i = 0; i < 3; ++i) {
+		eye[i] = -(v[3][0] * axisX[i] + v[3][1] * axisY[i] + v[3][2] * axisZ[i]);
+	}
+
+	Rect rect = {std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest()};
+	const float kCorners[4][2] = {{-1.0f, -1.0f}, {-1.0f, 1.0f}, {1.0f, 1.0f}, {1.0f, -1.0f}};
+	for (const float(&corner)[2] : kCorners) {
+		// 画面の隅を通る視線（ビュー空間で z = 1 になる長さ）をワールドへ
+		float viewX = (corner[0] - p[2][0]) / p[0][0];
+		float viewY = (corner[1] - p[2][1]) / p[1][1];
+		float direction[3];
+		for (int i = 0; i < 3; ++i) {
+			direction[i] = viewX * axisX[i] + viewY * axisY[i] + axisZ[i];
+		}
+		if (std::fabs(direction[2]) < 1.0e-6f) {
+			return false;
+		}
+		for (float planeZ : {nearZ, farZ}) {
+			float t = (planeZ - eye[2]) / direction[2];
+			if (t <= 0.0f) {
+				return false;
+			}
+			float x = eye[0] + direction[0] * t;
+			float y = eye[1] + direction[1] * t;
+			rect.left = (std::min)(rect.left, x);
+			rect.right = (std::max)(rect.right, x);
+			rect.bottom = (std::min)(rect.bottom, y);
+			rect.top = (std::max)(rect.top, y);
+		}
+	}
+	outRect = rect;
+	return true;
+}
+
+/// <summary>
+/// 矩形にかかるマップチップの番号の範囲を求める
+/// マス (column, row) の中心は (blockWidth * column, blockHeight * (rowCount - 1 - row))（MapChipField と同じ）
+/// </summary>
+inline TileRange ToTileRange(const Rect& rect, float blockWidth, float blockHeight, uint32_t columnCount, uint32_t rowCount) {
+	// 番号を求めて範囲内に収める（無限大や範囲外も端に寄せる）
+	auto toIndex = [](float position, float blockSize, uint32_t count) {
+		float index = std::floor((position + blockSize / 2.0f) / blockSize);
+		return static_cast<int64_t>(std::clamp(index, -1.0f, static_cast<float>(count)));
+	};
+	int64_t firstColumn = toIndex(rect.left, blockWidth, columnCount);
+	int64_t lastColumn = toIndex(rect.right, blockWidth, columnCount);
+	// 行は上から数えるので、上端が最初の行になる
+	int64_t lastRow = static_cast<int64_t>(rowCount) - 1 - toIndex(rect.bottom, blockHeight, rowCount);
+	int64_t firstRow = static_cast<int64_t>(rowCount) - 1 - toIndex(rect.top, blockHeight, rowCount);
+
+	// 全て範囲外のときは空にする
+	if (lastColumn < 0 || firstColumn >= static_cast<int64_t>(columnCount) || lastRow < 0 || firstRow >= static_cast<int64_t>(rowCount)) {
+		return {1, 0, 1, 0};
+	}
+	TileRange range;
+	range.firstColumn = static_cast<uint32_t>((std::max<int64_t>)(firstColumn, 0));
+	range.lastColumn = static_cast<uint32_t>((std::min<int64_t>)(lastColumn, static_cast<int64_t>(columnCount) - 1));
+	range.firstRow = static_cast<uint32_t>((std::max<int64_t>)(firstRow, 0));
+	range.lastRow = static_cast<uint32_t>((std::min<int64_t>)(lastRow, static_cast<int64_t>(rowCount) - 1));
+	return range;
+}
+
+} // namespace ViewCulling
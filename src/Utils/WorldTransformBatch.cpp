@@ -0,0 +1,21 @@
+#include "Utils/WorldTransformBatch.h"
+#include <cstring>
+
+using namespace KamataEngine;
+
+void WorldTransformBatch::Clear() {
+	batch_.Clear();
+	worldTransforms_.clear();
+}
+
+void WorldTransformBatch::Add(WorldTransform& worldTransform) {
+	batch_.Add(worldTransform.scale_, worldTransform.rotation_, worldTransform.translation_);
+	worldTransforms_.push_back(&worldTransform);
+}
+
+void WorldTransformBatch::Update() {
+	batch_.Build();
+	for (size_t i = 0; i < worldTransforms_.size(); ++i) {
+		std::memcpy(&worldTransforms_[i]->matWorld_, batch_.GetMatrix(i).m, sizeof(Matrix4x4));
+	}
+}
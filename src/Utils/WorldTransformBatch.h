@@ -0,0 +1,33 @@
+#pragma once
+#include "KamataEngine.h"
+#include "Utils/TransformBatch.h"
+#include <vector>
+
+/// <summary>
+/// 毎フレーム動くもののワールド変換を集めて、行列を TransformBatch でまとめて計算する
+/// 各表示はスケール・回転・平行移動を書き込んで Add するだけにし、Update で全員の matWorld_ を埋める
+/// </summary>
+class WorldTransformBatch {
+public:
+	/// <summary>
+	/// 集めたワールド変換を全て捨てる（毎フレームの最初に呼ぶ）
+	/// </summary>
+	void Clear();
+
+	/// <summary>
+	/// ワールド変換を加える（Update までスケール・回転・平行移動を変えないこと）
+	/// </summary>
+	void Add(KamataEngine::WorldTransform& worldTransform);
+
+	/// <summary>
+	/// 集めた全ての行列を計算して、それぞれの matWorld_ へ書き込む（転送はしない）
+	/// </summary>
+	void Update();
+
+	// 計算した行列（連続したバッファ）
+	const TransformBatch& GetBatch() const { return batch_; }
+
+private:
+	TransformBatch batch_;
+	std::vector<KamataEngine::WorldTransform*> worldTransforms_;
+};
@@ -1,11 +1,24 @@
 #include "KamataEngine.h"
+#include "Render/SnapshotChannel.h"
+#include "Render/SnapshotRenderer.h"
 #include "Scenes/GameScene.h"
 #include "Scenes/StageSelectScene.h"
 #include "Scenes/TitleScene.h"
+#include "System/FrameWorker.h"
+#include "System/GameTime.h"
 #include "System/Gamepad.h"
+#include "System/JobSystem.h"
 #include <Windows.h>
 using namespace KamataEngine;
 
+// ゲームシーンの更新（フレーム N+1）と描画（フレーム N）を別スレッドで重ねて実行するか
+// Debug ではシーンの更新中に ImGui を使うので、メインスレッドで順番に実行する
+#ifdef _DEBUG
+constexpr bool kEnablePipelinedFrame = false;
+#else
+constexpr bool kEnablePipelinedFrame = true;
+#endif
+
 // シーンの型
 enum class Scene {
 	kUnknown, // 不明
@@ -21,8 +34,16 @@ TitleScene* titleScene = nullptr;
 StageSelectScene* stageSelectScene = nullptr;
 GameScene* gameScene = nullptr;
 
+// 更新スレッドから描画スレッドへ描画内容を受け渡すキュー
+SnapshotChannel snapshotChannel;
+
 
 void ForceChangeScene(Scene next) {
+	// 解放するシーンのモデルを参照しているスナップショットを破棄
+	snapshotChannel.Reset();
+	// 読み込みにかかった時間をシミュレーションで取り戻そうとしない
+	GameTime::Reset();
+
 	// 現在のシーンインスタンスをすべて安全に解放
 	delete titleScene;
 	titleScene = nullptr;
@@ -121,6 +142,17 @@ void UpdateScene() {
 	}
 }
 
+// ゲームシーンを1フレーム進め、描画内容をキューへ記録する
+void SimulateGameFrame() {
+	gameScene->Update();
+
+	RenderSnapshot* snapshot = snapshotChannel.BeginWrite();
+	if (snapshot) {
+		gameScene->BuildSnapshot(*snapshot);
+		snapshotChannel.EndWrite();
+	}
+}
+
 // DrawScene関数
 void DrawScene() {
 	switch (scene) {
@@ -145,6 +177,11 @@ int WINAPI WinMain(_In_ HINSTANCE, _In_opt_ HINSTANCE, _In_ LPSTR, _In_ int) {
 	DirectXCommon* dxCommon = DirectXCommon::GetInstance();
 	ImGuiManager* imguiManager = ImGuiManager::GetInstance();
 
+	// ジョブシステム（ワーカースレッド）の起動
+	JobSystem::GetInstance()->Initialize();
+	// ゲームシーン更新用のスレッド
+	FrameWorker simulationWorker;
+
 	/*********************************************************
 	 *シーンの初期化
 	 *********************************************************/
@@ -167,6 +204,9 @@ int WINAPI WinMain(_In_ HINSTANCE, _In_opt_ HINSTANCE, _In_ LPSTR, _In_ int) {
 		// 追加: 毎フレームゲームパッド状態を更新（これがないとコントローラ入力が反映されない）
 		Gamepad::GetInstance()->Update();
 
+		// 実時間を計測し、このフレームで進めるシミュレーションのステップ数を決める
+		GameTime::Update();
+
 		imguiManager->Begin();
 
 #ifdef _DEBUG
@@ -191,11 +231,57 @@ int WINAPI WinMain(_In_ HINSTANCE, _In_opt_ HINSTANCE, _In_ LPSTR, _In_ int) {
 				ForceChangeScene(nextScene);
 			}
 		}
+
+		// ジョブシステムの有効/無効（単一スレッド実行との比較用）
+		static bool useJobSystem = true;
+		if (ImGui::Checkbox("JobSystem", &useJobSystem)) {
+			JobSystem::GetInstance()->SetEnabled(useJobSystem);
+		}
+
+		// 直前のフレームの描画の集計
+		const SnapshotRenderer::Statistics& renderStatistics = SnapshotRenderer::GetInstance()->GetStatistics();
+		ImGui::Text("Draw calls: %u (instances %u)", renderStatistics.drawCallCount, renderStatistics.instanceDrawCount);
+		ImGui::Text("Commands: %u  Transfers: %u  Passes: %u  State groups: %u", renderStatistics.commandCount, renderStatistics.transferCount, renderStatistics.passCount,
+		            renderStatistics.stateGroupCount);
+		ImGui::Text("Sprites: %u quads in %u batches", renderStatistics.spriteQuadCount, renderStatistics.spriteBatchCount);
+		ImGui::Text("Submit: %.3f ms", renderStatistics.submitMilliseconds);
 		ImGui::End();
 #endif // _DEBUG
 
 		// 1. シーン切り替え (ゲームプレイによる自然な遷移)
+		GameScene* previousGameScene = gameScene;
 		ChangeScene();
+		if (gameScene != previousGameScene) {
+			// 解放したシーンのスナップショットは再生しない
+			snapshotChannel.Reset();
+			// ステージの読み込みにかかった時間をシミュレーションで取り戻そうとしない
+			GameTime::Reset();
+		}
+
+		if (kEnablePipelinedFrame && scene == Scene::kGame) {
+			// 最初のフレームは描画するものが無いので、その場で1フレーム進めておく
+			if (snapshotChannel.IsEmpty()) {
+				SimulateGameFrame();
+			}
+			const RenderSnapshot* snapshot = snapshotChannel.BeginRead();
+
+			// 2. 次のフレームの更新を別スレッドで開始
+			simulationWorker.Kick(SimulateGameFrame);
+
+			imguiManager->End();
+
+			// 3. 前のフレームで記録した内容を描画
+			dxCommon->PreDraw();
+			SnapshotRenderer::GetInstance()->Execute(*snapshot);
+			snapshotChannel.EndRead();
+			imguiManager->Draw();
+			dxCommon->PostDraw();
+
+			// 更新の完了を待つ（次のフレームのシーン切り替えより前に）
+			simulationWorker.Wait();
+			continue;
+		}
+		snapshotChannel.Reset();
 
 		// 2. 現在シーンの更新
 		UpdateScene();
@@ -219,6 +305,12 @@ int WINAPI WinMain(_In_ HINSTANCE, _In_opt_ HINSTANCE, _In_ LPSTR, _In_ int) {
 	delete stageSelectScene;
 	delete gameScene;
 
+	// 描画用リソースの解放
+	SnapshotRenderer::GetInstance()->Finalize();
+
+	// ジョブシステムの停止
+	JobSystem::GetInstance()->Finalize();
+
 	// エンジンを終了させる処理
 	Finalize();
 
@@ -0,0 +1,600 @@
+#include "PngCodec.h"
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace {
+
+const uint8_t kSignature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+uint32_t ReadBigEndian32(const uint8_t* data) { return static_cast<uint32_t>(data[0]) << 24 | static_cast<uint32_t>(data[1]) << 16 | static_cast<uint32_t>(data[2]) << 8 | data[3]; }
+
+void WriteBigEndian32(std::vector<uint8_t>& out, uint32_t value) {
+	out.push_back(static_cast<uint8_t>(value >> 24));
+	out.push_back(static_cast<uint8_t>(value >> 16));
+	out.push_back(static_cast<uint8_t>(value >> 8));
+	out.push_back(static_cast<uint8_t>(value));
+}
+
+uint32_t Crc32(const uint8_t* data, size_t size, uint32_t crc = 0) {
+	static const std::array<uint32_t, 256> kTable = [] {
+		std::array<uint32_t, 256> table = {};
+		for (uint32_t i = 0; i < 256; ++i) {
+			uint32_t c = i;
+			for (int k = 0; k < 8; ++k) {
+				c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+			}
+			table[i] = c;
+		}
+		return table;
+	}();
+	crc = ~crc;
+	for (size_t i = 0; i < size; ++i) {
+		crc = kTable[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+	}
+	return ~crc;
+}
+
+uint32_t Adler32(const std::vector<uint8_t>& data) {
+	uint32_t a = 1;
+	uint32_t b = 0;
+	for (uint8_t byte : data) {
+		a = (a + byte) % 65521;
+		b = (b + a) % 65521;
+	}
+	return b << 16 | a;
+}
+
+// --- 展開（RFC 1951） ---
+
+// 長さ・距離の符号ごとの基準値と追加ビット数
+const uint16_t kLengthBase[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+const uint8_t kLengthExtra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+const uint16_t kDistanceBase[30] = {1,   2,   3,   4,   5,   7,    9,    13,   17,   25,   33,   49,   65,    97,    129,
+                                    193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+const uint8_t kDistanceExtra[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+// 符号長から作る復号表（長さごとの符号の数と、符号の順に並べた記号）
+struct Huffman {
+	uint16_t counts[16] = {};
+	std::vector<uint16_t> symbols;
+
+	bool Build(const uint8_t* lengths, size_t count) {
+		std::fill(std::begin(counts), std::end(counts), uint16_t{0});
+		for (size_t i = 0; i < count; ++i) {
+			++counts[lengths[i]];
+		}
+		counts[0] = 0;
+		uint16_t offsets[16] = {};
+		for (int length = 1; length < 15; ++length) {
+			offsets[length + 1] = offsets[length] + counts[length];
+		}
+		symbols.assign(count, 0);
+		for (size_t i = 0; i < count; ++i) {
+			if (lengths[i] != 0) {
+				symbols[offsets[lengths[i]]++] = static_cast<uint16_t>(i);
+			}
+		}
+		return true;
+	}
+};
+
+class BitReader {
+public:
+	BitReader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+	bool IsOverrun() const { return isOverrun_; }
+
+	uint32_t Read(int count) {
+		uint32_t value = 0;
+		for (int i = 0; i < count; ++i) {
+			if (position_ >= size_) {
+				isOverrun_ = true;
+				return 0;
+			}
+			value |= static_cast<uint32_t>((data_[position_] >> bit_) & 1) << i;
+			if (++bit_ == 8) {
+				bit_ = 0;
+				++position_;
+			}
+		}
+		return value;
+	}
+
+	// バイトの境目まで読み飛ばす
+	void AlignToByte() {
+		if (bit_ != 0) {
+			bit_ = 0;
+			++position_;
+		}
+	}
+
+	const uint8_t* Bytes(size_t count) {
+		if (position_ + count > size_) {
+			isOverrun_ = true;
+			return nullptr;
+		}
+		const uint8_t* bytes = data_ + position_;
+		position_ += count;
+		return bytes;
+	}
+
+	// 1記号を復号する（符号は上位ビットから1ビットずつ読む）
+	int Decode(const Huffman& huffman) {
+		int code = 0;
+		int first = 0;
+		int index = 0;
+		for (int length = 1; length < 16; ++length) {
+			code |= static_cast<int>(Read(1));
+			int count = huffman.counts[length];
+			if (code - count < first) {
+				return huffman.symbols[index + (code - first)];
+			}
+			index += count;
+			first += count;
+			first <<= 1;
+			code <<= 1;
+			if (isOverrun_) {
+				return -1;
+			}
+		}
+		return -1;
+	}
+
+private:
+	const uint8_t* data_;
+	size_t size_;
+	size_t position_ = 0;
+	int bit_ = 0;
+	bool isOverrun_ = false;
+};
+
+bool InflateBlock(BitReader& reader, const Huffman& literals, const Huffman& distances, std::vector<uint8_t>& out) {
+	for (;;) {
+		int symbol = reader.Decode(literals);
+		if (symbol < 0) {
+			return false;
+		}
+		if (symbol < 256) {
+			out.push_back(static_cast<uint8_t>(symbol));
+			continue;
+		}
+		if (symbol == 256) {
+			return true;
+		}
+		symbol -= 257;
+		if (symbol >= 29) {
+			return false;
+		}
+		size_t length = kLengthBase[symbol] + reader.Read(kLengthExtra[symbol]);
+		int distanceSymbol = reader.Decode(distances);
+		if (distanceSymbol < 0 || distanceSymbol >= 30) {
+			return false;
+		}
+		size_t distance = kDistanceBase[distanceSymbol] + reader.Read(kDistanceExtra[distanceSymbol]);
+		if (distance > out.size() || reader.IsOverrun()) {
+			return false;
+		}
+		size_t from = out.size() - distance;
+		for (size_t i = 0; i < length; ++i) {
+			out.push_back(out[from + i]);
+		}
+	}
+}
+
+bool Inflate(const uint8_t* data, size_t size, std::vector<uint8_t>& out) {
+	BitReader reader(data, size);
+	bool isLast = false;
+	while (!isLast) {
+		isLast = reader.Read(1) != 0;
+		uint32_t type = reader.Read(2);
+		if (type == 0) {
+			// 圧縮なし
+			reader.AlignToByte();
+			const uint8_t* header = reader.Bytes(4);
+			if (!header) {
+				return false;
+			}
+			uint16_t length = static_cast<uint16_t>(header[0] | header[1] << 8);
+			uint16_t inverted = static_cast<uint16_t>(header[2] | header[3] << 8);
+			const uint8_t* bytes = reader.Bytes(length);
+			if (static_cast<uint16_t>(~inverted) != length || !bytes) {
+				return false;
+			}
+			out.insert(out.end(), bytes, bytes + length);
+		} else if (type == 1) {
+			// 固定ハフマン符号
+			uint8_t lengths[288];
+			std::fill(lengths, lengths + 144, uint8_t{8});
+			std::fill(lengths + 144, lengths + 256, uint8_t{9});
+			std::fill(lengths + 256, lengths + 280, uint8_t{7});
+			std::fill(lengths + 280, lengths + 288, uint8_t{8});
+			Huffman literals;
+			literals.Build(lengths, 288);
+			std::fill(lengths, lengths + 30, uint8_t{5});
+			Huffman distances;
+			distances.Build(lengths, 30);
+			if (!InflateBlock(reader, literals, distances, out)) {
+				return false;
+			}
+		} else if (type == 2) {
+			// 動的ハフマン符号
+			uint32_t literalCount = reader.Read(5) + 257;
+			uint32_t distanceCount = reader.Read(5) + 1;
+			uint32_t codeLengthCount = reader.Read(4) + 4;
+			static const uint8_t kOrder[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+			uint8_t codeLengths[19] = {};
+			for (uint32_t i = 0; i < codeLengthCount; ++i) {
+				codeLengths[kOrder[i]] = static_cast<uint8_t>(reader.Read(3));
+			}
+			Huffman codeLengthHuffman;
+			codeLengthHuffman.Build(codeLengths, 19);
+
+			uint8_t lengths[320] = {};
+			uint32_t index = 0;
+			while (index < literalCount + distanceCount) {
+				int symbol = reader.Decode(codeLengthHuffman);
+				if (symbol < 0) {
+					return false;
+				}
+				if (symbol < 16) {
+					lengths[index++] = static_cast<uint8_t>(symbol);
+					continue;
+				}
+				uint8_t repeated = 0;
+				uint32_t repeat = 0;
+				if (symbol == 16) {
+					if (index == 0) {
+						return false;
+					}
+					repeated = lengths[index - 1];
+					repeat = 3 + reader.Read(2);
+				} else if (symbol == 17) {
+					repeat = 3 + reader.Read(3);
+				} else {
+					repeat = 11 + reader.Read(7);
+				}
+				if (index + repeat > literalCount + distanceCount) {
+					return false;
+				}
+				std::fill(lengths + index, lengths + index + repeat, repeated);
+				index += repeat;
+			}
+			Huffman literals;
+			literals.Build(lengths, literalCount);
+			Huffman distances;
+			distances.Build(lengths + literalCount, distanceCount);
+			if (!InflateBlock(reader, literals, distances, out)) {
+				return false;
+			}
+		} else {
+			return false;
+		}
+		if (reader.IsOverrun()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// --- 圧縮（固定ハフマン符号と LZ77） ---
+
+class BitWriter {
+public:
+	explicit BitWriter(std::vector<uint8_t>& out) : out_(out) {}
+
+	// 下位ビットから書く
+	void Write(uint32_t value, int count) {
+		for (int i = 0; i < count; ++i) {
+			current_ |= static_cast<uint8_t>(((value >> i) & 1) << bit_);
+			if (++bit_ == 8) {
+				Flush();
+			}
+		}
+	}
+
+	// ハフマン符号は上位ビットから書く
+	void WriteCode(uint32_t code, int length) {
+		for (int i = length - 1; i >= 0; --i) {
+			Write((code >> i) & 1, 1);
+		}
+	}
+
+	void Finish() {
+		if (bit_ != 0) {
+			Flush();
+		}
+	}
+
+private:
+	void Flush() {
+		out_.push_back(current_);
+		current_ = 0;
+		bit_ = 0;
+	}
+
+	std::vector<uint8_t>& out_;
+	uint8_t current_ = 0;
+	int bit_ = 0;
+};
+
+void WriteLiteral(BitWriter& writer, uint32_t symbol) {
+	if (symbol < 144) {
+		writer.WriteCode(0x30 + symbol, 8);
+	} else if (symbol < 256) {
+		writer.WriteCode(0x190 + symbol - 144, 9);
+	} else if (symbol < 280) {
+		writer.WriteCode(symbol - 256, 7);
+	} else {
+		writer.WriteCode(0xC0 + symbol - 280, 8);
+	}
+}
+
+void WriteMatch(BitWriter& writer, size_t length, size_t distance) {
+	int lengthSymbol = 28;
+	while (kLengthBase[lengthSymbol] > length) {
+		--lengthSymbol;
+	}
+	WriteLiteral(writer, 257 + lengthSymbol);
+	writer.Write(static_cast<uint32_t>(length - kLengthBase[lengthSymbol]), kLengthExtra[lengthSymbol]);
+
+	int distanceSymbol = 29;
+	while (kDistanceBase[distanceSymbol] > distance) {
+		--distanceSymbol;
+	}
+	writer.WriteCode(static_cast<uint32_t>(distanceSymbol), 5);
+	writer.Write(static_cast<uint32_t>(distance - kDistanceBase[distanceSymbol]), kDistanceExtra[distanceSymbol]);
+}
+
+void Deflate(const std::vector<uint8_t>& data, std::vector<uint8_t>& out) {
+	const size_t kWindowSize = 32768;
+	const size_t kMinMatch = 3;
+	const size_t kMaxMatch = 258;
+	const int kMaxChain = 64;
+	const uint32_t kHashBits = 15;
+
+	BitWriter writer(out);
+	// 1ブロックだけ（最後のブロック・固定ハフマン符号）
+	writer.Write(1, 1);
+	writer.Write(1, 2);
+
+	std::vector<int64_t> head(size_t{1} << kHashBits, -1);
+	std::vector<int64_t> previous(data.size(), -1);
+	auto hashAt = [&](size_t i) { return ((static_cast<uint32_t>(data[i]) << 10) ^ (static_cast<uint32_t>(data[i + 1]) << 5) ^ data[i + 2]) & ((1u << kHashBits) - 1); };
+	auto insert = [&](size_t i) {
+		if (i + kMinMatch <= data.size()) {
+			uint32_t hash = hashAt(i);
+			previous[i] = head[hash];
+			head[hash] = static_cast<int64_t>(i);
+		}
+	};
+
+	size_t i = 0;
+	while (i < data.size()) {
+		size_t bestLength = 0;
+		size_t bestDistance = 0;
+		if (i + kMinMatch <= data.size()) {
+			size_t limit = (std::min)(kMaxMatch, data.size() - i);
+			int64_t candidate = head[hashAt(i)];
+			for (int chain = 0; chain < kMaxChain && candidate >= 0 && i - static_cast<size_t>(candidate) <= kWindowSize; ++chain) {
+				size_t from = static_cast<size_t>(candidate);
+				size_t length = 0;
+				while (length < limit && data[from + length] == data[i + length]) {
+					++length;
+				}
+				if (length > bestLength) {
+					bestLength = length;
+					bestDistance = i - from;
+					if (length == limit) {
+						break;
+					}
+				}
+				candidate = previous[from];
+			}
+		}
+
+		if (bestLength >= kMinMatch) {
+			WriteMatch(writer, bestLength, bestDistance);
+			for (size_t k = 0; k < bestLength; ++k) {
+				insert(i + k);
+			}
+			i += bestLength;
+		} else {
+			WriteLiteral(writer, data[i]);
+			insert(i);
+			++i;
+		}
+	}
+	WriteLiteral(writer, 256);
+	writer.Finish();
+}
+
+// --- フィルタ（PNG 仕様 9 章） ---
+
+uint8_t Paeth(int a, int b, int c) {
+	int p = a + b - c;
+	int pa = std::abs(p - a);
+	int pb = std::abs(p - b);
+	int pc = std::abs(p - c);
+	if (pa <= pb && pa <= pc) {
+		return static_cast<uint8_t>(a);
+	}
+	return static_cast<uint8_t>(pb <= pc ? b : c);
+}
+
+// フィルタ type で行 row を元に戻した（復号）または掛けた（符号化）値を返す
+uint8_t Predict(int type, const uint8_t* row, const uint8_t* above, size_t x, size_t bytesPerPixel) {
+	int a = x >= bytesPerPixel ? row[x - bytesPerPixel] : 0;
+	int b = above ? above[x] : 0;
+	int c = (above && x >= bytesPerPixel) ? above[x - bytesPerPixel] : 0;
+	switch (type) {
+	case 1:
+		return static_cast<uint8_t>(a);
+	case 2:
+		return static_cast<uint8_t>(b);
+	case 3:
+		return static_cast<uint8_t>((a + b) / 2);
+	case 4:
+		return Paeth(a, b, c);
+	default:
+		return 0;
+	}
+}
+
+void AppendChunk(std::vector<uint8_t>& out, const char* type, const std::vector<uint8_t>& data) {
+	WriteBigEndian32(out, static_cast<uint32_t>(data.size()));
+	size_t start = out.size();
+	out.insert(out.end(), type, type + 4);
+	out.insert(out.end(), data.begin(), data.end());
+	WriteBigEndian32(out, Crc32(out.data() + start, out.size() - start));
+}
+
+} // namespace
+
+namespace PngCodec {
+
+bool Load(const std::string& path, Image& outImage, std::string& error) {
+	std::ifstream file(path, std::ios::binary);
+	if (!file) {
+		error = "cannot open";
+		return false;
+	}
+	std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	if (bytes.size() < 8 || std::memcmp(bytes.data(), kSignature, 8) != 0) {
+		error = "not a PNG file";
+		return false;
+	}
+
+	uint32_t width = 0;
+	uint32_t height = 0;
+	uint8_t colorType = 0;
+	std::vector<uint8_t> compressed;
+	size_t position = 8;
+	while (position + 12 <= bytes.size()) {
+		uint32_t length = ReadBigEndian32(&bytes[position]);
+		if (position + 12 + length > bytes.size()) {
+			break;
+		}
+		const uint8_t* type = &bytes[position + 4];
+		const uint8_t* data = &bytes[position + 8];
+		if (Crc32(type, length + 4) != ReadBigEndian32(data + length)) {
+			error = "CRC mismatch";
+			return false;
+		}
+		if (std::memcmp(type, "IHDR", 4) == 0 && length >= 13) {
+			width = ReadBigEndian32(data);
+			height = ReadBigEndian32(data + 4);
+			uint8_t bitDepth = data[8];
+			colorType = data[9];
+			uint8_t interlace = data[12];
+			if (bitDepth != 8 || (colorType != 0 && colorType != 2 && colorType != 4 && colorType != 6) || interlace != 0) {
+				error = "unsupported format (8-bit gray/RGB/RGBA without interlace only)";
+				return false;
+			}
+		} else if (std::memcmp(type, "IDAT", 4) == 0) {
+			compressed.insert(compressed.end(), data, data + length);
+		} else if (std::memcmp(type, "IEND", 4) == 0) {
+			break;
+		}
+		position += 12 + length;
+	}
+	if (width == 0 || height == 0 || compressed.size() < 6) {
+		error = "missing IHDR or IDAT";
+		return false;
+	}
+
+	// zlib のヘッダ（2バイト）と Adler-32（4バイト）を除いて展開する
+	std::vector<uint8_t> filtered;
+	if (!Inflate(compressed.data() + 2, compressed.size() - 6, filtered)) {
+		error = "broken deflate stream";
+		return false;
+	}
+	const size_t channelCount = colorType == 6 ? 4 : colorType == 2 ? 3 : colorType == 4 ? 2 : 1;
+	const size_t stride = static_cast<size_t>(width) * channelCount;
+	if (filtered.size() < (stride + 1) * height) {
+		error = "image data too short";
+		return false;
+	}
+
+	std::vector<uint8_t> raw(stride * height);
+	for (uint32_t y = 0; y < height; ++y) {
+		int filterType = filtered[y * (stride + 1)];
+		if (filterType > 4) {
+			error = "unknown filter";
+			return false;
+		}
+		const uint8_t* source = &filtered[y * (stride + 1) + 1];
+		uint8_t* row = &raw[y * stride];
+		const uint8_t* above = y > 0 ? &raw[(y - 1) * stride] : nullptr;
+		for (size_t x = 0; x < stride; ++x) {
+			row[x] = static_cast<uint8_t>(source[x] + Predict(filterType, row, above, x, channelCount));
+		}
+	}
+
+	outImage.width = width;
+	outImage.height = height;
+	outImage.pixels.resize(static_cast<size_t>(width) * height * 4);
+	for (size_t i = 0; i < static_cast<size_t>(width) * height; ++i) {
+		const uint8_t* source = &raw[i * channelCount];
+		uint8_t* destination = &outImage.pixels[i * 4];
+		if (channelCount >= 3) {
+			destination[0] = source[0];
+			destination[1] = source[1];
+			destination[2] = source[2];
+		} else {
+			destination[0] = destination[1] = destination[2] = source[0];
+		}
+		destination[3] = channelCount == 4 ? source[3] : channelCount == 2 ? source[1] : 255;
+	}
+	return true;
+}
+
+std::vector<uint8_t> Encode(const Image& image) {
+	const size_t stride = static_cast<size_t>(image.width) * 4;
+
+	// 行ごとに、差分の絶対値の合計が最も小さいフィルタを選ぶ
+	std::vector<uint8_t> filtered;
+	filtered.reserve((stride + 1) * image.height);
+	std::vector<uint8_t> candidate(stride);
+	std::vector<uint8_t> best(stride);
+	for (uint32_t y = 0; y < image.height; ++y) {
+		const uint8_t* row = &image.pixels[y * stride];
+		const uint8_t* above = y > 0 ? &image.pixels[(y - 1) * stride] : nullptr;
+		uint64_t bestScore = UINT64_MAX;
+		int bestType = 0;
+		for (int type = 0; type <= 4; ++type) {
+			uint64_t score = 0;
+			for (size_t x = 0; x < stride; ++x) {
+				candidate[x] = static_cast<uint8_t>(row[x] - Predict(type, row, above, x, 4));
+				score += static_cast<uint64_t>(std::abs(static_cast<int8_t>(candidate[x])));
+			}
+			if (score < bestScore) {
+				bestScore = score;
+				bestType = type;
+				best.swap(candidate);
+			}
+		}
+		filtered.push_back(static_cast<uint8_t>(bestType));
+		filtered.insert(filtered.end(), best.begin(), best.end());
+	}
+
+	std::vector<uint8_t> zlib = {0x78, 0x01};
+	Deflate(filtered, zlib);
+	WriteBigEndian32(zlib, Adler32(filtered));
+
+	std::vector<uint8_t> out(kSignature, kSignature + 8);
+	std::vector<uint8_t> header;
+	WriteBigEndian32(header, image.width);
+	WriteBigEndian32(header, image.height);
+	// 8ビット・RGBA・圧縮 0・フィルタ 0・インターレース無し
+	header.insert(header.end(), {8, 6, 0, 0, 0});
+	AppendChunk(out, "IHDR", header);
+	AppendChunk(out, "IDAT", zlib);
+	AppendChunk(out, "IEND", {});
+	return out;
+}
+
+} // namespace PngCodec
@@ -0,0 +1,31 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// アトラス作成用の最小限の PNG 読み書き（外部ライブラリを使わない）
+/// 読み込みは 8ビットの RGBA / RGB / グレースケール（インターレース無し）だけを扱い、RGBA に変換する。
+/// 書き出しは 8ビットの RGBA で、行ごとにフィルタを選び、固定ハフマン符号で圧縮する
+/// </summary>
+namespace PngCodec {
+
+struct Image {
+	uint32_t width = 0;
+	uint32_t height = 0;
+	// RGBA 8ビット × width × height（左上から行ごと）
+	std::vector<uint8_t> pixels;
+};
+
+/// <summary>
+/// ファイルを読み込む
+/// </summary>
+/// <returns>扱えない形式・壊れたファイルなら false（error に理由を入れる）</returns>
+bool Load(const std::string& path, Image& outImage, std::string& error);
+
+/// <summary>
+/// メモリ上の PNG に書き出す（同じ画像からは常に同じバイト列になる）
+/// </summary>
+std::vector<uint8_t> Encode(const Image& image);
+
+} // namespace PngCodec
@@ -0,0 +1,343 @@
+#include "PngCodec.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// HUD・UI の小さな画像を1枚のアトラスにまとめ、領域の表（ヘッダ）を生成する
+// ・画像は高さの順に skyline 法（下に詰める）で置き、まわりに kPadding ピクセルずつ端の色を引き伸ばす（縮小・ミップマップでのにじみ防止）
+// ・単色の四角形（フェード・ポーズの背景）用に白い領域も1つ作る
+// ・書き出した PNG を読み直し、全ての領域が元の画像と同じになっているかを確かめる
+// ・--check では書き出さずに、リポジトリにあるアトラスと表が今の元画像から作ったものと同じかを確かめる（元画像を変えたのに作り直し忘れたら失敗する）
+//
+// 使い方: atlas_packer [--root リポジトリのルート=.] [--out 書き出すディレクトリ（省略時はリポジトリへ上書き）] [--check]
+
+namespace {
+
+// 元の画像（Resources からのパス）と、表の名前
+struct Source {
+	const char* path;
+	const char* name;
+};
+const Source kSources[] = {
+    {"number/0.png", "Number0"},      {"number/1.png", "Number1"},   {"number/2.png", "Number2"},    {"number/3.png", "Number3"},
+    {"number/4.png", "Number4"},      {"number/5.png", "Number5"},   {"number/6.png", "Number6"},    {"number/7.png", "Number7"},
+    {"number/8.png", "Number8"},      {"number/9.png", "Number9"},   {"number/STAGE1.png", "StageText"}, {"HUD/HP.png", "Heart"},
+    {"HUD/J.png", "KeyJ"},            {"HUD/SPACE.png", "KeySpace"}, {"HUD/ESC.png", "KeyEsc"},      {"HUD/A.png", "ButtonA"},
+    {"HUD/X.png", "ButtonX"},         {"HUD/select.png", "ButtonSelect"}, {"UI/pause.png", "Pause"},  {"UI/arrow.png", "Arrow"},
+};
+// 白い領域の名前と大きさ
+const char* const kWhiteName = "White";
+const uint32_t kWhiteSize = 4;
+
+// アトラスの幅（高さは使った分を2の累乗に切り上げる）
+const uint32_t kAtlasWidth = 1024;
+// 領域のまわりの余白（端の色を引き伸ばす）
+const uint32_t kPadding = 4;
+
+// 生成するファイル（リポジトリのルートから）
+const char* const kAtlasPath = "Resources/atlas/ui.png";
+const char* const kTablePath = "src/Render/UiAtlasTable.h";
+// TextureManager::Load に渡すパス
+const char* const kTextureLoadPath = "atlas/ui.png";
+
+struct Entry {
+	std::string name;
+	std::string path;
+	PngCodec::Image image;
+	uint32_t x = 0;
+	uint32_t y = 0;
+};
+
+/// <summary>
+/// skyline 法の詰め込み（置いた物の上端の輪郭を、左から順の線分で持つ）
+/// </summary>
+class Skyline {
+public:
+	explicit Skyline(uint32_t width) : width_(width) { nodes_.push_back({0, 0, width}); }
+
+	// 置ける中で上端が最も低く（同じなら左に）なる位置に置く
+	bool Insert(uint32_t width, uint32_t height, uint32_t& outX, uint32_t& outY) {
+		size_t bestIndex = SIZE_MAX;
+		uint32_t bestBottom = UINT32_MAX;
+		uint32_t bestY = 0;
+		for (size_t i = 0; i < nodes_.size(); ++i) {
+			uint32_t y = 0;
+			if (!Fits(i, width, y)) {
+				continue;
+			}
+			if (y + height < bestBottom || (y + height == bestBottom && nodes_[i].x < nodes_[bestIndex].x)) {
+				bestIndex = i;
+				bestBottom = y + height;
+				bestY = y;
+			}
+		}
+		if (bestIndex == SIZE_MAX) {
+			return false;
+		}
+
+		outX = nodes_[bestIndex].x;
+		outY = bestY;
+		nodes_.insert(nodes_.begin() + static_cast<std::ptrdiff_t>(bestIndex), {outX, bestY + height, width});
+		// 新しい線分の下に隠れた線分を縮める・消す
+		for (size_t i = bestIndex + 1; i < nodes_.size();) {
+			Node& previous = nodes_[i - 1];
+			Node& node = nodes_[i];
+			uint32_t previousRight = previous.x + previous.width;
+			if (node.x >= previousRight) {
+				break;
+			}
+			uint32_t shrink = previousRight - node.x;
+			if (node.width <= shrink) {
+				nodes_.erase(nodes_.begin() + static_cast<std::ptrdiff_t>(i));
+				continue;
+			}
+			node.x += shrink;
+			node.width -= shrink;
+			break;
+		}
+		// 同じ高さで隣り合う線分をまとめる
+		for (size_t i = 0; i + 1 < nodes_.size();) {
+			if (nodes_[i].y == nodes_[i + 1].y) {
+				nodes_[i].width += nodes_[i + 1].width;
+				nodes_.erase(nodes_.begin() + static_cast<std::ptrdiff_t>(i + 1));
+			} else {
+				++i;
+			}
+		}
+		usedHeight_ = (std::max)(usedHeight_, bestY + height);
+		return true;
+	}
+
+	uint32_t GetUsedHeight() const { return usedHeight_; }
+
+private:
+	struct Node {
+		uint32_t x;
+		uint32_t y;
+		uint32_t width;
+	};
+
+	// 線分 index の左端から幅 width を置いたときの下端
+	bool Fits(size_t index, uint32_t width, uint32_t& outY) const {
+		if (nodes_[index].x + width > width_) {
+			return false;
+		}
+		uint32_t remaining = width;
+		uint32_t y = 0;
+		for (size_t i = index; remaining > 0; ++i) {
+			if (i >= nodes_.size()) {
+				return false;
+			}
+			y = (std::max)(y, nodes_[i].y);
+			remaining -= (std::min)(remaining, nodes_[i].width);
+		}
+		outY = y;
+		return true;
+	}
+
+	uint32_t width_;
+	uint32_t usedHeight_ = 0;
+	std::vector<Node> nodes_;
+};
+
+uint32_t CeilPowerOfTwo(uint32_t value) {
+	uint32_t result = 1;
+	while (result < value) {
+		result <<= 1;
+	}
+	return result;
+}
+
+// 表のヘッダの中身
+std::string MakeTable(const std::vector<Entry>& entries, uint32_t atlasWidth, uint32_t atlasHeight) {
+	std::string text;
+	text += "#pragma once\n";
+	text += "#include <cstdint>\n\n";
+	text += "// atlas_packer が生成したファイル（手で書き換えないこと。元の画像を変えたら atlas_packer を実行し直す）\n\n";
+	text += "/// <summary>\n";
+	text += "/// HUD・UI の画像をまとめたアトラス（Resources/" + std::string(kTextureLoadPath) + "）の領域の表\n";
+	text += "/// </summary>\n";
+	text += "namespace UiAtlasTable {\n\n";
+	text += "// TextureManager::Load に渡すパス\n";
+	text += "inline constexpr const char* kTexturePath = \"" + std::string(kTextureLoadPath) + "\";\n";
+	text += "inline constexpr uint32_t kWidth = " + std::to_string(atlasWidth) + ";\n";
+	text += "inline constexpr uint32_t kHeight = " + std::to_string(atlasHeight) + ";\n\n";
+	text += "enum class Region : uint32_t {\n";
+	for (const Entry& entry : entries) {
+		text += "\tk" + entry.name + ", // " + entry.path + "\n";
+	}
+	text += "\tkCount,\n";
+	text += "};\n\n";
+	text += "// 領域の位置と大きさ（ピクセル。左上が原点）\n";
+	text += "struct Entry {\n\tuint32_t x;\n\tuint32_t y;\n\tuint32_t width;\n\tuint32_t height;\n};\n\n";
+	text += "// Region の順\n";
+	text += "inline constexpr Entry kEntries[] = {\n";
+	for (const Entry& entry : entries) {
+		text += "    {" + std::to_string(entry.x) + ", " + std::to_string(entry.y) + ", " + std::to_string(entry.image.width) + ", " +
+		        std::to_string(entry.image.height) + "}, // k" + entry.name + "\n";
+	}
+	text += "};\n";
+	text += "static_assert(sizeof(kEntries) / sizeof(kEntries[0]) == static_cast<size_t>(Region::kCount));\n\n";
+	text += "} // namespace UiAtlasTable\n";
+	return text;
+}
+
+bool ReadFile(const std::string& path, std::vector<uint8_t>& out) {
+	std::ifstream file(path, std::ios::binary);
+	if (!file) {
+		return false;
+	}
+	out.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	return true;
+}
+
+bool WriteFile(const std::string& path, const void* data, size_t size) {
+	std::ofstream file(path, std::ios::binary);
+	file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+	return static_cast<bool>(file);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	std::string root = ".";
+	std::string outDirectory;
+	bool isCheck = false;
+
+	for (int i = 1; i < argc; ++i) {
+		if (std::strcmp(argv[i], "--root") == 0 && i + 1 < argc) {
+			root = argv[++i];
+		} else if (std::strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+			outDirectory = argv[++i];
+		} else if (std::strcmp(argv[i], "--check") == 0) {
+			isCheck = true;
+		} else {
+			std::fprintf(stderr, "usage: %s [--root DIR] [--out DIR] [--check]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	// 元の画像を読み込む
+	std::vector<Entry> entries;
+	for (const Source& source : kSources) {
+		Entry& entry = entries.emplace_back();
+		entry.name = source.name;
+		entry.path = source.path;
+		std::string error;
+		if (!PngCodec::Load(root + "/Resources/" + source.path, entry.image, error)) {
+			std::fprintf(stderr, "%s: %s\n", source.path, error.c_str());
+			return 1;
+		}
+	}
+	{
+		Entry& white = entries.emplace_back();
+		white.name = kWhiteName;
+		white.path = "(solid white)";
+		white.image.width = kWhiteSize;
+		white.image.height = kWhiteSize;
+		white.image.pixels.assign(static_cast<size_t>(kWhiteSize) * kWhiteSize * 4, 255);
+	}
+
+	// 高い順（同じなら幅の広い順・表の順）に置く
+	std::vector<size_t> order(entries.size());
+	for (size_t i = 0; i < order.size(); ++i) {
+		order[i] = i;
+	}
+	std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+		if (entries[a].image.height != entries[b].image.height) {
+			return entries[a].image.height > entries[b].image.height;
+		}
+		return entries[a].image.width > entries[b].image.width;
+	});
+	Skyline skyline(kAtlasWidth);
+	uint64_t sourceArea = 0;
+	for (size_t index : order) {
+		Entry& entry = entries[index];
+		uint32_t x = 0;
+		uint32_t y = 0;
+		if (!skyline.Insert(entry.image.width + kPadding * 2, entry.image.height + kPadding * 2, x, y)) {
+			std::fprintf(stderr, "%s does not fit in a %u-wide atlas\n", entry.path.c_str(), kAtlasWidth);
+			return 1;
+		}
+		entry.x = x + kPadding;
+		entry.y = y + kPadding;
+		sourceArea += static_cast<uint64_t>(entry.image.width) * entry.image.height;
+	}
+
+	// 書き込む（余白には一番近い端の色を入れる）
+	PngCodec::Image atlas;
+	atlas.width = kAtlasWidth;
+	atlas.height = CeilPowerOfTwo(skyline.GetUsedHeight());
+	atlas.pixels.assign(static_cast<size_t>(atlas.width) * atlas.height * 4, 0);
+	for (const Entry& entry : entries) {
+		const PngCodec::Image& image = entry.image;
+		for (uint32_t py = 0; py < image.height + kPadding * 2; ++py) {
+			uint32_t sourceY = std::clamp(static_cast<int64_t>(py) - kPadding, int64_t{0}, static_cast<int64_t>(image.height) - 1);
+			for (uint32_t px = 0; px < image.width + kPadding * 2; ++px) {
+				uint32_t sourceX = std::clamp(static_cast<int64_t>(px) - kPadding, int64_t{0}, static_cast<int64_t>(image.width) - 1);
+				const uint8_t* from = &image.pixels[(static_cast<size_t>(sourceY) * image.width + sourceX) * 4];
+				uint8_t* to = &atlas.pixels[(static_cast<size_t>(entry.y - kPadding + py) * atlas.width + (entry.x - kPadding + px)) * 4];
+				std::memcpy(to, from, 4);
+			}
+		}
+	}
+
+	std::vector<uint8_t> png = PngCodec::Encode(atlas);
+	std::string table = MakeTable(entries, atlas.width, atlas.height);
+
+	// 書き出した PNG を読み直して、全ての領域が元の画像と同じか確かめる
+	bool isPassed = true;
+	{
+		std::string tempPath = (outDirectory.empty() ? std::string(".") : outDirectory) + "/atlas_packer_verify.png";
+		PngCodec::Image decoded;
+		std::string error;
+		if (!WriteFile(tempPath, png.data(), png.size()) || !PngCodec::Load(tempPath, decoded, error)) {
+			std::fprintf(stderr, "cannot read back the atlas: %s\n", error.c_str());
+			return 1;
+		}
+		std::remove(tempPath.c_str());
+		uint32_t mismatchCount = 0;
+		for (const Entry& entry : entries) {
+			for (uint32_t y = 0; y < entry.image.height; ++y) {
+				const uint8_t* expected = &entry.image.pixels[static_cast<size_t>(y) * entry.image.width * 4];
+				const uint8_t* actual = &decoded.pixels[(static_cast<size_t>(entry.y + y) * decoded.width + entry.x) * 4];
+				if (std::memcmp(expected, actual, static_cast<size_t>(entry.image.width) * 4) != 0) {
+					++mismatchCount;
+					break;
+				}
+			}
+		}
+		std::printf("atlas %ux%u  %zu regions (%zu files -> 1 texture)  used %.1f%%  %zu bytes  region mismatches %u\n", atlas.width, atlas.height,
+		            entries.size(), std::size(kSources), 100.0 * static_cast<double>(sourceArea) / (static_cast<double>(atlas.width) * atlas.height), png.size(),
+		            mismatchCount);
+		isPassed &= mismatchCount == 0;
+	}
+
+	const std::string atlasPath = root + "/" + kAtlasPath;
+	const std::string tablePath = root + "/" + kTablePath;
+	if (isCheck) {
+		// リポジトリにあるものと比べる
+		std::vector<uint8_t> currentPng;
+		std::vector<uint8_t> currentTable;
+		bool isPngSame = ReadFile(atlasPath, currentPng) && currentPng == png;
+		bool isTableSame = ReadFile(tablePath, currentTable) && std::string(currentTable.begin(), currentTable.end()) == table;
+		std::printf("%s: %s\n%s: %s\n", kAtlasPath, isPngSame ? "up to date" : "OUT OF DATE", kTablePath, isTableSame ? "up to date" : "OUT OF DATE");
+		isPassed &= isPngSame && isTableSame;
+	} else {
+		std::string pngOut = outDirectory.empty() ? atlasPath : outDirectory + "/ui.png";
+		std::string tableOut = outDirectory.empty() ? tablePath : outDirectory + "/UiAtlasTable.h";
+		if (!WriteFile(pngOut, png.data(), png.size()) || !WriteFile(tableOut, table.data(), table.size())) {
+			std::fprintf(stderr, "cannot write %s / %s\n", pngOut.c_str(), tableOut.c_str());
+			return 1;
+		}
+		std::printf("wrote %s and %s\n", pngOut.c_str(), tableOut.c_str());
+	}
+
+	std::printf("%s\n", isPassed ? "PASS" : "FAIL");
+	return isPassed ? 0 : 1;
+}
@@ -0,0 +1,182 @@
+#include "Render/StageDraw.h"
+#include "System/MapChipField.h"
+#include "Utils/SimdMath.h"
+#include "Utils/ViewCulling.h"
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+// ViewCulling（カメラに映る範囲）を GameScene と同じカメラで確かめる
+// ・取りこぼし: 画面に映るブロック（8つの角のどれかが画面内）が、映る範囲の列・行に全て入っているか
+// ・量: 映る範囲に入るブロックの数が、ステージ全体の数と比べてどれだけ減るか（表示するだけ）
+// カメラはプレイヤーの位置を (0, 0, -30) 離れて見る。Z 軸まわりの回転（重力の向きの変更）も乱数で付ける
+//
+// 使い方: culling_bench [--root リソースのルート=.] [--views カメラの数=2000] [ステージ番号...（省略時は 1 ～ 10）]
+
+namespace {
+
+// エンジンの Vector3 / Matrix4x4 と同じ並び
+struct Vector3 {
+	float x, y, z;
+};
+struct Vector4 {
+	float x, y, z, w;
+};
+struct Matrix4x4 {
+	float m[4][4];
+};
+
+// エンジンの Camera の既定値と同じ透視投影
+const float kFovAngleY = 45.0f * 3.14159265f / 180.0f;
+const float kAspectRatio = 16.0f / 9.0f;
+const float kNearClip = 0.1f;
+const float kFarClip = 1000.0f;
+// GameScene と同じカメラの距離・奥行きの範囲
+const float kCameraDistance = StageDraw::kCameraDistance;
+const float kCullingNearZ = StageDraw::kCullingNearZ;
+const float kCullingFarZ = StageDraw::kCullingFarZ;
+
+Matrix4x4 MakePerspective() {
+	Matrix4x4 result = {};
+	float cot = 1.0f / std::tan(kFovAngleY / 2.0f);
+	result.m[0][0] = cot / kAspectRatio;
+	result.m[1][1] = cot;
+	result.m[2][2] = kFarClip / (kFarClip - kNearClip);
+	result.m[2][3] = 1.0f;
+	result.m[3][2] = -kNearClip * kFarClip / (kFarClip - kNearClip);
+	return result;
+}
+
+// 点が画面（NDC の -1 ～ 1）に映るか
+bool IsOnScreen(const Vector3& point, const Matrix4x4& viewProjection) {
+	Vector4 clip = SimdMath::Transform4(Vector4{point.x, point.y, point.z, 1.0f}, viewProjection);
+	if (clip.w <= 0.0f) {
+		return false;
+	}
+	return std::fabs(clip.x / clip.w) <= 1.0f && std::fabs(clip.y / clip.w) <= 1.0f;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	std::string resourceRoot = ".";
+	uint32_t viewCount = 2000;
+	std::vector<int> stageNos;
+
+	for (int i = 1; i < argc; ++i) {
+		if (std::strcmp(argv[i], "--root") == 0 && i + 1 < argc) {
+			resourceRoot = argv[++i];
+		} else if (std::strcmp(argv[i], "--views") == 0 && i + 1 < argc) {
+			viewCount = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else if (argv[i][0] != '-') {
+			stageNos.push_back(std::atoi(argv[i]));
+		} else {
+			std::fprintf(stderr, "usage: %s [--root DIR] [--views N] [stage...]\n", argv[0]);
+			return 2;
+		}
+	}
+	if (stageNos.empty()) {
+		for (int stageNo = 1; stageNo <= 10; ++stageNo) {
+			stageNos.push_back(stageNo);
+		}
+	}
+
+	const Matrix4x4 projection = MakePerspective();
+	bool isPassed = true;
+
+	// 回転していないカメラの映る範囲（Z = 0 の平面での大きさの目安）
+	{
+		Matrix4x4 view = SimdMath::MakeLookAt<Matrix4x4>(Vector3{0.0f, 0.0f, -kCameraDistance}, Vector3{0.0f, 0.0f, 0.0f}, Vector3{0.0f, 1.0f, 0.0f});
+		ViewCulling::Rect rect;
+		isPassed &= ViewCulling::ComputeVisibleRect(view, projection, 0.0f, 0.0f, rect);
+		std::printf("visible area at z=0: %.1f x %.1f\n", rect.right - rect.left, rect.top - rect.bottom);
+	}
+
+	std::mt19937 random(12345);
+	std::uniform_real_distribution<float> roll(-3.14159265f, 3.14159265f);
+
+	for (int stageNo : stageNos) {
+		MapChipField mapChipField;
+		mapChipField.LoadMapChipCsv(resourceRoot + "/Resources/stage/stage" + std::to_string(stageNo) + ".csv");
+		const uint32_t columnCount = mapChipField.GetNumBlockHorizontal();
+		const uint32_t rowCount = mapChipField.GetNumBlockVertical();
+		const float blockWidth = static_cast<float>(mapChipField.GetBlockWidth());
+		const float blockHeight = static_cast<float>(mapChipField.GetBlockHeight());
+
+		struct Block {
+			uint32_t column;
+			uint32_t row;
+			Vector3 center;
+		};
+		std::vector<Block> blocks;
+		for (uint32_t row = 0; row < rowCount; ++row) {
+			for (uint32_t column = 0; column < columnCount; ++column) {
+				if (mapChipField.GetMapChipTypeByIndex(column, row) == MapChipType::kBlock) {
+					SimVector3 center = mapChipField.GetMapChipPositionByIndex(column, row);
+					blocks.push_back({column, row, {static_cast<float>(center.x), static_cast<float>(center.y), 0.0f}});
+				}
+			}
+		}
+
+		// マップの少し外まで含めた範囲をプレイヤーの位置とする
+		std::uniform_real_distribution<float> targetX(-10.0f, blockWidth * static_cast<float>(columnCount) + 10.0f);
+		std::uniform_real_distribution<float> targetY(-10.0f, blockHeight * static_cast<float>(rowCount) + 10.0f);
+
+		uint64_t missedCount = 0;
+		uint64_t onScreenCount = 0;
+		uint64_t submittedCount = 0;
+		double cullingNanoseconds = 0.0;
+		for (uint32_t viewIndex = 0; viewIndex < viewCount; ++viewIndex) {
+			// GameScene::UpdateCamera と同じく、上方向だけを回して LookAt で作る
+			float angle = (viewIndex % 2 == 0) ? 0.0f : roll(random);
+			Vector3 target = {targetX(random), targetY(random), 0.0f};
+			Vector3 eye = {target.x, target.y, -kCameraDistance};
+			Vector3 up = {-std::sin(angle), std::cos(angle), 0.0f};
+			Matrix4x4 view = SimdMath::MakeLookAt<Matrix4x4>(eye, target, up);
+			Matrix4x4 viewProjection = SimdMath::Multiply(view, projection);
+
+			auto startTime = std::chrono::steady_clock::now();
+			ViewCulling::Rect rect;
+			ViewCulling::ComputeVisibleRect(view, projection, kCullingNearZ, kCullingFarZ, rect);
+			ViewCulling::TileRange range = ViewCulling::ToTileRange(rect, blockWidth, blockHeight, columnCount, rowCount);
+			cullingNanoseconds += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime).count();
+
+			for (const Block& block : blocks) {
+				bool isInRange = !range.IsEmpty() && block.column >= range.firstColumn && block.column <= range.lastColumn && block.row >= range.firstRow &&
+				                 block.row <= range.lastRow;
+				// GameScene は列の範囲で描く
+				if (!range.IsEmpty() && block.column >= range.firstColumn && block.column <= range.lastColumn) {
+					++submittedCount;
+				}
+
+				bool isOnScreen = false;
+				for (int corner = 0; corner < 8 && !isOnScreen; ++corner) {
+					Vector3 point = {
+					    block.center.x + ((corner & 1) ? blockWidth : -blockWidth) / 2.0f, block.center.y + ((corner & 2) ? blockHeight : -blockHeight) / 2.0f,
+					    (corner & 4) ? 1.0f : -1.0f};
+					isOnScreen = IsOnScreen(point, viewProjection);
+				}
+				if (isOnScreen) {
+					++onScreenCount;
+					missedCount += isInRange ? 0 : 1;
+				}
+			}
+		}
+
+		double averageSubmitted = static_cast<double>(submittedCount) / viewCount;
+		std::printf(
+		    "stage%-2d blocks %4zu  on screen %6.1f  submitted %6.1f (x%.1f fewer)  missed %llu  %.0f ns/view\n", stageNo, blocks.size(),
+		    static_cast<double>(onScreenCount) / viewCount, averageSubmitted, averageSubmitted > 0.0 ? static_cast<double>(blocks.size()) / averageSubmitted : 0.0,
+		    static_cast<unsigned long long>(missedCount), cullingNanoseconds / viewCount);
+		isPassed &= missedCount == 0;
+	}
+
+	std::printf("%s\n", isPassed ? "PASS" : "FAIL");
+	return isPassed ? 0 : 1;
+}
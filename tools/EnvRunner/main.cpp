@@ -0,0 +1,118 @@
+#include "Sim/SimEnvironmentBatch.h"
+#include "System/JobSystem.h"
+#include "System/MapChipField.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// 複数の環境をまとめて進め、1秒あたりの環境ステップ数を計る（SimEnvironmentBatch の確認用）
+//
+// 使い方: env_runner [--root リソースのルート=.] [--stage ステージ番号=1] [--envs 環境数=1024] [--steps ステップ数=1000]
+//                   [--max-episode エピソードの最大ステップ数=3600] [--threads N]
+//   行動は「右へ進みながら、ときどきジャンプ・攻撃・左」を環境ごとに乱数で選ぶ（乱数の種は固定）
+
+namespace {
+
+/// <summary>
+/// 環境ごとの乱数（xorshift32。同じ種なら常に同じ並びになる）
+/// </summary>
+uint32_t NextRandom(uint32_t& state) {
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	std::string resourceRoot = ".";
+	int stageNo = 1;
+	uint32_t environmentCount = 1024;
+	uint32_t stepCount = 1000;
+	uint32_t maxEpisodeSteps = 3600;
+	uint32_t threadCount = 0;
+
+	for (int i = 1; i < argc; ++i) {
+		if (i + 1 >= argc) {
+			std::fprintf(stderr, "usage: %s [--root resourceRoot] [--stage N] [--envs N] [--steps N] [--max-episode N] [--threads N]\n", argv[0]);
+			return 2;
+		}
+		if (std::strcmp(argv[i], "--root") == 0) {
+			resourceRoot = argv[++i];
+		} else if (std::strcmp(argv[i], "--stage") == 0) {
+			stageNo = std::atoi(argv[++i]);
+		} else if (std::strcmp(argv[i], "--envs") == 0) {
+			environmentCount = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else if (std::strcmp(argv[i], "--steps") == 0) {
+			stepCount = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else if (std::strcmp(argv[i], "--max-episode") == 0) {
+			maxEpisodeSteps = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else if (std::strcmp(argv[i], "--threads") == 0) {
+			threadCount = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else {
+			std::fprintf(stderr, "unknown option %s\n", argv[i]);
+			return 2;
+		}
+	}
+
+	// マップの読み込み
+	MapChipField mapChipField;
+	std::string mapFileName = resourceRoot + "/Resources/stage/stage" + std::to_string(stageNo) + ".csv";
+	mapChipField.LoadMapChipCsv(mapFileName);
+	if (mapChipField.GetNumBlockVertical() == 0 || mapChipField.GetNumBlockHorizontal() == 0) {
+		std::fprintf(stderr, "failed to load %s\n", mapFileName.c_str());
+		return 1;
+	}
+
+	JobSystem* jobSystem = JobSystem::GetInstance();
+	jobSystem->Initialize(threadCount > 0 ? threadCount - 1 : UINT32_MAX);
+	uint32_t coreCount = jobSystem->GetWorkerCount() + 1;
+
+	SimEnvironmentBatch batch;
+	batch.Initialize(&mapChipField, stageNo, environmentCount, maxEpisodeSteps);
+
+	std::vector<uint32_t> randomStates(environmentCount);
+	for (uint32_t i = 0; i < environmentCount; ++i) {
+		randomStates[i] = (0x9E3779B9u ^ (i * 0x85EBCA6Bu)) | 1u;
+	}
+	std::vector<uint8_t> actions(environmentCount, 0);
+
+	uint32_t outcomeCounts[4] = {};
+	double totalReward = 0.0;
+
+	auto startTime = std::chrono::steady_clock::now();
+	for (uint32_t step = 0; step < stepCount; ++step) {
+		for (uint32_t i = 0; i < environmentCount; ++i) {
+			uint32_t random = NextRandom(randomStates[i]);
+			uint8_t action = (random % 8 == 0) ? static_cast<uint8_t>(SimButton::kLeft) : static_cast<uint8_t>(SimButton::kRight);
+			action |= ((random >> 8) % 4 == 0) ? static_cast<uint8_t>(SimButton::kJump) : 0;
+			action |= ((random >> 16) % 16 == 0) ? static_cast<uint8_t>(SimButton::kAttack) : 0;
+			actions[i] = action;
+		}
+
+		batch.Step(actions);
+
+		for (uint32_t i = 0; i < environmentCount; ++i) {
+			totalReward += batch.GetRewards()[i];
+			++outcomeCounts[static_cast<size_t>(batch.GetOutcomes()[i])];
+		}
+	}
+	double elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+	jobSystem->Finalize();
+
+	uint64_t environmentSteps = static_cast<uint64_t>(environmentCount) * stepCount;
+	double stepsPerSecond = elapsedSeconds > 0.0 ? static_cast<double>(environmentSteps) / elapsedSeconds : 0.0;
+	std::printf("stage %d: %u envs x %u steps\n", stageNo, environmentCount, stepCount);
+	std::printf(
+	    "episodes: clear %u, death %u, timeout %u, mean reward per env %.3f\n", outcomeCounts[static_cast<size_t>(SimEpisodeOutcome::kClear)],
+	    outcomeCounts[static_cast<size_t>(SimEpisodeOutcome::kDeath)], outcomeCounts[static_cast<size_t>(SimEpisodeOutcome::kTimeout)], totalReward / environmentCount);
+	std::printf(
+	    "throughput: %llu env steps in %.3f ms on %u cores, %.0f steps/s (%.0f steps/s per core)\n", static_cast<unsigned long long>(environmentSteps), elapsedSeconds * 1000.0,
+	    coreCount, stepsPerSecond, stepsPerSecond / coreCount);
+	return 0;
+}
@@ -0,0 +1,213 @@
+#include "Utils/Easing.h"
+#include "Utils/FastMath.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+// FastMath（sin/cos の近似・向きの表）と Easing の焼き込んだ表を確かめる
+// ・精度: double で計算した std::sin / std::cos、式で計算したイージングとの差の最大が、ヘッダーに書いた上限以下か
+// ・一致: 配列版（SSE）とスカラー版の sin/cos が全て同じ値になるか
+// ・速さ: 標準ライブラリ・式と比べた1回あたりの時間（表示するだけ）
+//
+// 使い方: fast_math_bench [--count 要素数=4096] [--steps 繰り返し数=200]
+
+namespace {
+
+// ヘッダーに書いた誤差の上限
+const double kSinCosTolerance = 1.0e-7;
+const double kEasingTolerance = 4.0e-5;
+
+const float kTwoPi = 6.28318530718f;
+
+// コンパイル時に計算できることの確認
+static_assert(FastMath::Sin(0.0f) == 0.0f);
+static_assert(FastMath::Cos(0.0f) == 1.0f);
+constexpr std::array<FastMath::Direction2, 8> kDirections = FastMath::MakeDirectionTable<8>();
+static_assert(kDirections[0].x == 1.0f && kDirections[0].y == 0.0f);
+
+// 1要素あたりのナノ秒を返す
+template<typename Function>
+double Measure(uint32_t count, uint32_t steps, Function function) {
+	auto startTime = std::chrono::steady_clock::now();
+	for (uint32_t step = 0; step < steps; ++step) {
+		function();
+	}
+	double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime).count();
+	return elapsed / (static_cast<double>(count) * steps);
+}
+
+// 角度の範囲ごとの sin/cos の誤差の最大
+double SinCosError(const std::vector<float>& radians) {
+	double maxError = 0.0;
+	for (float radian : radians) {
+		float sinValue = 0.0f;
+		float cosValue = 0.0f;
+		FastMath::SinCos(radian, sinValue, cosValue);
+		maxError = (std::max)(maxError, std::fabs(static_cast<double>(sinValue) - std::sin(static_cast<double>(radian))));
+		maxError = (std::max)(maxError, std::fabs(static_cast<double>(cosValue) - std::cos(static_cast<double>(radian))));
+	}
+	return maxError;
+}
+
+bool Check(const char* name, double error, double tolerance) {
+	bool isPassed = error <= tolerance;
+	std::printf("%-20s max error %.3g (tolerance %.1g) %s\n", name, error, tolerance, isPassed ? "ok" : "NG");
+	return isPassed;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	uint32_t count = 4096;
+	uint32_t steps = 200;
+
+	for (int i = 1; i < argc; ++i) {
+		if (i + 1 >= argc) {
+			std::fprintf(stderr, "usage: %s [--count N] [--steps N]\n", argv[0]);
+			return 2;
+		}
+		if (std::strcmp(argv[i], "--count") == 0) {
+			count = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else if (std::strcmp(argv[i], "--steps") == 0) {
+			steps = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else {
+			std::fprintf(stderr, "unknown option %s\n", argv[i]);
+			return 2;
+		}
+	}
+
+	std::printf("instruction set: %s\n", SimdMath::kInstructionSet);
+	bool isPassed = true;
+	double checksum = 0.0;
+
+	// --- sin/cos の精度（-2π ～ 2π は細かく全部、それより広い範囲は乱数で） ---
+	{
+		const uint32_t kSampleCount = 1u << 20;
+		std::vector<float> small(kSampleCount);
+		for (uint32_t i = 0; i < kSampleCount; ++i) {
+			small[i] = -kTwoPi + 2.0f * kTwoPi * static_cast<float>(i) / static_cast<float>(kSampleCount - 1);
+		}
+		std::mt19937 random(12345);
+		std::uniform_real_distribution<float> wide(-FastMath::kMaxRadian, FastMath::kMaxRadian);
+		std::vector<float> large(kSampleCount);
+		for (float& radian : large) {
+			radian = wide(random);
+		}
+		isPassed &= Check("SinCos |x|<=2pi", SinCosError(small), kSinCosTolerance);
+		isPassed &= Check("SinCos |x|<=8192", SinCosError(large), kSinCosTolerance);
+
+		// 配列版とスカラー版が1ビットも違わないか（0 の符号も含めて比べる）
+		small.push_back(0.0f);
+		small.push_back(-0.0f);
+		std::vector<float> sinValues(small.size()), cosValues(small.size());
+		FastMath::SinCos(small.data(), sinValues.data(), cosValues.data(), small.size());
+		uint64_t mismatchCount = 0;
+		for (size_t i = 0; i < small.size(); ++i) {
+			float sinValue = 0.0f;
+			float cosValue = 0.0f;
+			FastMath::SinCos(small[i], sinValue, cosValue);
+			mismatchCount += std::memcmp(&sinValue, &sinValues[i], sizeof(float)) != 0 ? 1 : 0;
+			mismatchCount += std::memcmp(&cosValue, &cosValues[i], sizeof(float)) != 0 ? 1 : 0;
+		}
+		std::printf("%-20s mismatches %llu\n", "SinCos array/scalar", static_cast<unsigned long long>(mismatchCount));
+		isPassed &= mismatchCount == 0;
+
+		// 向きの表（実行時に標準ライブラリで計算した値と比べる）
+		double directionError = 0.0;
+		for (size_t i = 0; i < kDirections.size(); ++i) {
+			double angle = static_cast<double>((kTwoPi / 8.0f) * static_cast<float>(i));
+			directionError = (std::max)(directionError, std::fabs(kDirections[i].x - std::cos(angle)));
+			directionError = (std::max)(directionError, std::fabs(kDirections[i].y - std::sin(angle)));
+		}
+		isPassed &= Check("DirectionTable<8>", directionError, kSinCosTolerance);
+	}
+
+	// --- sin/cos の速さ ---
+	{
+		std::mt19937 random(54321);
+		std::uniform_real_distribution<float> angle(-kTwoPi, kTwoPi);
+		std::vector<float> radians(count), sinValues(count), cosValues(count);
+		for (float& radian : radians) {
+			radian = angle(random);
+		}
+		double libraryTime = Measure(count, steps, [&]() {
+			for (uint32_t i = 0; i < count; ++i) {
+				sinValues[i] = std::sin(radians[i]);
+				cosValues[i] = std::cos(radians[i]);
+			}
+		});
+		checksum += sinValues[count - 1] + cosValues[count - 1];
+		double scalarTime = Measure(count, steps, [&]() {
+			for (uint32_t i = 0; i < count; ++i) {
+				FastMath::SinCos(radians[i], sinValues[i], cosValues[i]);
+			}
+		});
+		checksum += sinValues[count - 1] + cosValues[count - 1];
+		double arrayTime = Measure(count, steps, [&]() { FastMath::SinCos(radians.data(), sinValues.data(), cosValues.data(), count); });
+		checksum += sinValues[count - 1] + cosValues[count - 1];
+		std::printf(
+		    "%-20s std %7.2f ns/op  scalar %7.2f ns/op  x%.2f  array %7.2f ns/op  x%.2f\n", "SinCos speed", libraryTime, scalarTime, libraryTime / scalarTime,
+		    arrayTime, libraryTime / arrayTime);
+	}
+
+	// --- イージングの表（精度と速さ） ---
+	{
+		struct Curve {
+			const char* name;
+			float (*function)(float);
+			float (*baked)(float);
+		};
+		const Curve curves[] = {
+		    {"EaseOutQuint", [](float t) { return EaseOutQuint(t); }, EaseOutQuintBaked},
+		    {"EaseOutQuad", [](float t) { return EaseOutQuad(t); }, EaseOutQuadBaked},
+		    {"EaseOutQuart", [](float t) { return EaseOutQuart(t); }, EaseOutQuartBaked},
+		    {"EaseInOutQuad", [](float t) { return EaseInOutQuad(t); }, EaseInOutQuadBaked},
+		    {"EaseOutBack", [](float t) { return EaseOutBack(t); }, EaseOutBackBaked},
+		};
+
+		std::mt19937 random(98765);
+		std::uniform_real_distribution<float> ratio(0.0f, 1.0f);
+		std::vector<float> ts(count), results(count);
+		for (float& t : ts) {
+			t = ratio(random);
+		}
+
+		const uint32_t kSampleCount = 1u << 16;
+		for (const Curve& curve : curves) {
+			double maxError = 0.0;
+			for (uint32_t i = 0; i <= kSampleCount; ++i) {
+				float t = static_cast<float>(i) / static_cast<float>(kSampleCount);
+				maxError = (std::max)(maxError, std::fabs(static_cast<double>(curve.baked(t)) - curve.function(t)));
+			}
+
+			// どちらも関数ポインタを通して呼ぶ（呼び出しの手間をそろえて、計算そのものの差を見る）
+			double functionTime = Measure(count, steps, [&]() {
+				for (uint32_t i = 0; i < count; ++i) {
+					results[i] = curve.function(ts[i]);
+				}
+			});
+			checksum += results[count - 1];
+			double bakedTime = Measure(count, steps, [&]() {
+				for (uint32_t i = 0; i < count; ++i) {
+					results[i] = curve.baked(ts[i]);
+				}
+			});
+			checksum += results[count - 1];
+
+			bool isCurvePassed = maxError <= kEasingTolerance;
+			std::printf(
+			    "%-20s formula %6.2f ns/op  baked %6.2f ns/op  x%.2f  max error %.3g (tolerance %.1g) %s\n", curve.name, functionTime, bakedTime,
+			    functionTime / bakedTime, maxError, kEasingTolerance, isCurvePassed ? "ok" : "NG");
+			isPassed &= isCurvePassed;
+		}
+	}
+
+	std::printf("%u elements x %u steps %s, checksum %.6g\n", count, steps, isPassed ? "PASS" : "FAIL", checksum);
+	return isPassed ? 0 : 1;
+}
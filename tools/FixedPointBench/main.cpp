@@ -0,0 +1,162 @@
+#include "Sim/SimFixed.h"
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+// float と Q16.16 固定小数点（SimFixed）の演算の速さを比べる
+// シミュレーションで多い「重力・落下速度の制限・位置の更新」「座標からマス番号」「減衰（掛け算）」を
+// 大量の要素に対してまとめて行い、1要素あたりの時間を計る（ループはコンパイラの自動ベクトル化に任せる）
+//
+// 使い方: fixed_point_bench [--count 要素数=65536] [--steps 繰り返し数=2000]
+
+namespace {
+
+// 1要素あたりのナノ秒を返す
+template<typename Function>
+double Measure(uint32_t count, uint32_t steps, Function function) {
+	auto startTime = std::chrono::steady_clock::now();
+	for (uint32_t step = 0; step < steps; ++step) {
+		function();
+	}
+	double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime).count();
+	return elapsed / (static_cast<double>(count) * steps);
+}
+
+void Report(const char* name, double floatNanoseconds, double fixedNanoseconds) {
+	std::printf(
+	    "%-10s float %.3f ns/elem (%.2f G/s)  fixed %.3f ns/elem (%.2f G/s)  fixed/float x%.2f\n", name, floatNanoseconds, 1.0 / floatNanoseconds, fixedNanoseconds,
+	    1.0 / fixedNanoseconds, floatNanoseconds / fixedNanoseconds);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	uint32_t count = 65536;
+	uint32_t steps = 2000;
+
+	for (int i = 1; i < argc; ++i) {
+		if (i + 1 >= argc) {
+			std::fprintf(stderr, "usage: %s [--count N] [--steps N]\n", argv[0]);
+			return 2;
+		}
+		if (std::strcmp(argv[i], "--count") == 0) {
+			count = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else if (std::strcmp(argv[i], "--steps") == 0) {
+			steps = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else {
+			std::fprintf(stderr, "unknown option %s\n", argv[i]);
+			return 2;
+		}
+	}
+
+	// SimPlayer と同じ値（重力・最大落下速度）と、マップの1ブロック = 2.0
+	const float kGravity = 0.02f;
+	const float kLimitFall = 0.6f;
+	const float kDamping = 0.95f;
+	const int32_t kGravityRaw = SimFixed(kGravity).GetRaw();
+	const int32_t kLimitFallRaw = SimFixed(kLimitFall).GetRaw();
+	const int32_t kDampingRaw = SimFixed(kDamping).GetRaw();
+	const int kBlockShift = SimFixed::kFractionBits + 1;
+
+	// 同じ初期値から始める（位置はマップ内、速度は小さめ）
+	std::vector<float> positionX(count), positionY(count), velocityX(count), velocityY(count);
+	std::vector<int32_t> positionXRaw(count), positionYRaw(count), velocityXRaw(count), velocityYRaw(count);
+	std::vector<int32_t> tileFloat(count), tileFixed(count);
+	std::vector<float> dampedFloat(count);
+	std::vector<int32_t> dampedFixed(count);
+	for (uint32_t i = 0; i < count; ++i) {
+		positionX[i] = static_cast<float>(i % 200);
+		positionY[i] = 30.0f + static_cast<float>(i % 7);
+		velocityX[i] = static_cast<float>(i % 11) * 0.01f - 0.05f;
+		velocityY[i] = 0.0f;
+		positionXRaw[i] = SimFixed(positionX[i]).GetRaw();
+		positionYRaw[i] = SimFixed(positionY[i]).GetRaw();
+		velocityXRaw[i] = SimFixed(velocityX[i]).GetRaw();
+		velocityYRaw[i] = SimFixed(velocityY[i]).GetRaw();
+	}
+
+	// 連続して落ち続けないよう、一定の高さを下回ったら戻す（分岐はせず、比較の結果で選ぶ）
+	const float kFloor = -1000.0f;
+	const int32_t kFloorRaw = SimFixed(kFloor).GetRaw();
+
+	// --- 座標からマス番号（float は割り算と floor、固定小数点は足し算とシフト） ---
+	double tileFloatTime = Measure(count, steps, [&]() {
+		const float* x = positionX.data();
+		int32_t* tile = tileFloat.data();
+		for (uint32_t i = 0; i < count; ++i) {
+			tile[i] = static_cast<int32_t>(std::floor((x[i] + 1.0f) / 2.0f));
+		}
+	});
+	double tileFixedTime = Measure(count, steps, [&]() {
+		const int32_t* x = positionXRaw.data();
+		int32_t* tile = tileFixed.data();
+		for (uint32_t i = 0; i < count; ++i) {
+			tile[i] = (x[i] + SimFixed::kOne) >> kBlockShift;
+		}
+	});
+	Report("tile", tileFloatTime, tileFixedTime);
+
+	// --- 重力・落下速度の制限・位置の更新（加減算と比較だけ） ---
+	double integrateFloat = Measure(count, steps, [&]() {
+		float* x = positionX.data();
+		float* y = positionY.data();
+		const float* vx = velocityX.data();
+		float* vy = velocityY.data();
+		for (uint32_t i = 0; i < count; ++i) {
+			float v = vy[i] - kGravity;
+			v = v < -kLimitFall ? -kLimitFall : v;
+			vy[i] = v;
+			x[i] += vx[i];
+			float newY = y[i] + v;
+			y[i] = newY < kFloor ? 30.0f : newY;
+		}
+	});
+	double integrateFixed = Measure(count, steps, [&]() {
+		int32_t* x = positionXRaw.data();
+		int32_t* y = positionYRaw.data();
+		const int32_t* vx = velocityXRaw.data();
+		int32_t* vy = velocityYRaw.data();
+		const int32_t kResetRaw = 30 * SimFixed::kOne;
+		for (uint32_t i = 0; i < count; ++i) {
+			int32_t v = vy[i] - kGravityRaw;
+			v = v < -kLimitFallRaw ? -kLimitFallRaw : v;
+			vy[i] = v;
+			x[i] += vx[i];
+			int32_t newY = y[i] + v;
+			y[i] = newY < kFloorRaw ? kResetRaw : newY;
+		}
+	});
+	Report("integrate", integrateFloat, integrateFixed);
+
+	// --- 減衰（掛け算。固定小数点は 64 ビットの中間値が要るぶん不利）
+	//     同じ配列に掛け続けると float は非正規化数になって極端に遅くなるので、別の配列に書き出す ---
+	double dampFloat = Measure(count, steps, [&]() {
+		const float* vx = velocityX.data();
+		float* damped = dampedFloat.data();
+		for (uint32_t i = 0; i < count; ++i) {
+			damped[i] = vx[i] * kDamping;
+		}
+	});
+	double dampFixed = Measure(count, steps, [&]() {
+		const int32_t* vx = velocityXRaw.data();
+		int32_t* damped = dampedFixed.data();
+		for (uint32_t i = 0; i < count; ++i) {
+			damped[i] = static_cast<int32_t>((static_cast<int64_t>(vx[i]) * kDampingRaw) >> SimFixed::kFractionBits);
+		}
+	});
+	Report("damping", dampFloat, dampFixed);
+
+	// 初期位置でのマス番号が一致するか（最適化で計算が消えないよう、ほかの結果も使う）
+	uint32_t tileMismatches = 0;
+	int64_t checksum = 0;
+	for (uint32_t i = 0; i < count; ++i) {
+		tileMismatches += tileFloat[i] != tileFixed[i] ? 1 : 0;
+		checksum += positionYRaw[i] + dampedFixed[i] + static_cast<int64_t>(positionY[i] + dampedFloat[i]);
+	}
+	std::printf("%u elements x %u steps, tile index mismatches %u, checksum %lld\n", count, steps, tileMismatches, static_cast<long long>(checksum));
+	return 0;
+}
@@ -0,0 +1,374 @@
+#include "Sim/SimMath.h"
+#include "System/Collision.h"
+#include "System/MapChipField.h"
+#include "Utils/AffineMatrix.h"
+#include "Utils/Easing.h"
+#include "Utils/SimdMath.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// よく呼ばれる小さな処理（行列・イージング・マップチップの検索・当たり判定）の1回あたりの時間を計る
+// TransformUpdater はエンジンの WorldTransform を使うので、中で呼んでいるエンジンに依存しない部分
+// （AffineMatrix::Make・SimdMath::MakeLookAt / Transform）を計る
+// 結果は JSON で保存でき、保存した結果（基準）と比べて遅くなったものを報告できる
+//
+// 使い方: micro_bench [--root リソースのルート=.] [--stage 番号=1] [--filter 名前の一部] [--min-time 1回の計測のミリ秒=20] [--samples 計測回数=5]
+//                     [--json-out ファイル] [--baseline ファイル] [--threshold 許す遅れの割合=0.25]
+//   各処理は --samples 回計り、一番速かった回の値を使う（他の処理に割り込まれた回を除くため）
+//   --baseline を付けると、基準より threshold を超えて遅くなった処理を報告する（あれば終了コード 3）
+
+namespace {
+
+// エンジンの Vector3 / Matrix4x4 と同じ並び
+struct Vector3 {
+	float x, y, z;
+};
+struct Matrix4x4 {
+	float m[4][4];
+};
+
+// 1つの計測。run は ops 回処理して、結果を捨てられないよう足し込んだ値を返す
+struct Benchmark {
+	std::string name;
+	uint32_t ops;
+	std::function<double()> run;
+};
+
+struct Result {
+	std::string name;
+	double nanosecondsPerOp;
+};
+
+struct Options {
+	std::string resourceRoot = ".";
+	int stageNo = 1;
+	std::string filter;
+	double minTimeMilliseconds = 20.0;
+	uint32_t samples = 5;
+	std::string jsonOutPath;
+	std::string baselinePath;
+	double threshold = 0.25;
+};
+
+double g_checksum = 0.0;
+
+// 1回の計測が minTime を超えるまで繰り返し数を増やしてから、samples 回計って一番速い値を返す
+double Measure(const Benchmark& benchmark, const Options& options) {
+	using Clock = std::chrono::steady_clock;
+	uint64_t repeat = 1;
+	for (;;) {
+		auto startTime = Clock::now();
+		for (uint64_t i = 0; i < repeat; ++i) {
+			g_checksum += benchmark.run();
+		}
+		double elapsed = std::chrono::duration<double, std::milli>(Clock::now() - startTime).count();
+		if (elapsed >= options.minTimeMilliseconds || repeat >= (1ull << 30)) {
+			break;
+		}
+		// 少し多めに見積もって、次で足りるようにする
+		double scale = elapsed > 0.0 ? options.minTimeMilliseconds / elapsed * 1.2 : 10.0;
+		repeat = static_cast<uint64_t>(static_cast<double>(repeat) * (std::min)((std::max)(scale, 1.5), 10.0));
+	}
+
+	double best = 0.0;
+	for (uint32_t sample = 0; sample < options.samples; ++sample) {
+		auto startTime = Clock::now();
+		for (uint64_t i = 0; i < repeat; ++i) {
+			g_checksum += benchmark.run();
+		}
+		double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - startTime).count();
+		double perOp = elapsed / (static_cast<double>(repeat) * benchmark.ops);
+		best = sample == 0 ? perOp : (std::min)(best, perOp);
+	}
+	return best;
+}
+
+// --- JSON（自分で書き出した形だけ読めればよい） ---
+
+void WriteJson(const std::string& path, const std::vector<Result>& results) {
+	std::ofstream file(path);
+	file << "{\n  \"benchmarks\": [\n";
+	for (size_t i = 0; i < results.size(); ++i) {
+		char number[64];
+		std::snprintf(number, sizeof(number), "%.4f", results[i].nanosecondsPerOp);
+		file << "    {\"name\": \"" << results[i].name << "\", \"ns_per_op\": " << number << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+	}
+	file << "  ]\n}\n";
+}
+
+// "name": "...", "ns_per_op": 数値 の組を順に拾う
+bool ReadJson(const std::string& path, std::vector<Result>& outResults) {
+	std::ifstream file(path);
+	if (!file.is_open()) {
+		return false;
+	}
+	std::stringstream stream;
+	stream << file.rdbuf();
+	std::string text = stream.str();
+
+	const std::string kNameKey = "\"name\"";
+	const std::string kValueKey = "\"ns_per_op\"";
+	size_t position = 0;
+	while ((position = text.find(kNameKey, position)) != std::string::npos) {
+		size_t nameBegin = text.find('"', text.find(':', position + kNameKey.size()));
+		size_t nameEnd = text.find('"', nameBegin + 1);
+		size_t valueKey = text.find(kValueKey, nameEnd);
+		if (nameBegin == std::string::npos || nameEnd == std::string::npos || valueKey == std::string::npos) {
+			return false;
+		}
+		size_t valueBegin = text.find(':', valueKey + kValueKey.size()) + 1;
+		outResults.push_back({text.substr(nameBegin + 1, nameEnd - nameBegin - 1), std::strtod(text.c_str() + valueBegin, nullptr)});
+		position = valueBegin;
+	}
+	return true;
+}
+
+// --- 計測する処理 ---
+
+// 1回の run で処理する要素の数（入力がキャッシュに収まる大きさ）
+const uint32_t kCount = 1024;
+
+std::vector<Benchmark> MakeBenchmarks(const Options& options) {
+	std::mt19937 random(12345);
+	std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+	std::uniform_real_distribution<float> angle(-6.3f, 6.3f);
+	std::uniform_real_distribution<float> scale(0.1f, 4.0f);
+	std::uniform_real_distribution<float> position(-400.0f, 400.0f);
+
+	std::vector<Benchmark> benchmarks;
+
+	// --- TransformUpdater（ワールド行列・LookAt・点の変換） ---
+	{
+		struct Transform {
+			Vector3 scale;
+			Vector3 rotate;
+			Vector3 translate;
+		};
+		auto general = std::make_shared<std::vector<Transform>>(kCount);
+		auto translateOnly = std::make_shared<std::vector<Transform>>(kCount);
+		auto points = std::make_shared<std::vector<Vector3>>(kCount);
+		for (uint32_t i = 0; i < kCount; ++i) {
+			(*general)[i] = {{scale(random), scale(random), scale(random)}, {angle(random), angle(random), angle(random)}, {position(random), position(random), position(random)}};
+			(*translateOnly)[i] = {{1.0f, 1.0f, 1.0f}, {0.0f, 0.0f, 0.0f}, {position(random), position(random), position(random)}};
+			(*points)[i] = {position(random), position(random), position(random)};
+		}
+		auto makeAffine = [](std::shared_ptr<std::vector<Transform>> inputs) {
+			return [inputs]() {
+				double sum = 0.0;
+				Matrix4x4 result;
+				for (uint32_t i = 0; i < kCount; ++i) {
+					const Transform& input = (*inputs)[i];
+					AffineMatrix::Make(result, input.scale, input.rotate, input.translate);
+					sum += result.m[0][0] + result.m[3][0];
+				}
+				return sum;
+			};
+		};
+		benchmarks.push_back({"TransformUpdater/MakeAffineMatrix/general", kCount, makeAffine(general)});
+		benchmarks.push_back({"TransformUpdater/MakeAffineMatrix/translate", kCount, makeAffine(translateOnly)});
+		benchmarks.push_back({"TransformUpdater/MakeLookAtMatrix", kCount - 1, [points]() {
+			                      double sum = 0.0;
+			                      for (uint32_t i = 0; i + 1 < kCount; ++i) {
+				                      Matrix4x4 result = SimdMath::MakeLookAt<Matrix4x4>((*points)[i], (*points)[i + 1], Vector3{0.0f, 1.0f, 0.0f});
+				                      sum += result.m[0][0] + result.m[3][2];
+			                      }
+			                      return sum;
+		                      }});
+		Matrix4x4 matrix;
+		AffineMatrix::Make(matrix, (*general)[0].scale, (*general)[0].rotate, (*general)[0].translate);
+		benchmarks.push_back({"TransformUpdater/Transform", kCount, [points, matrix]() {
+			                      double sum = 0.0;
+			                      for (uint32_t i = 0; i < kCount; ++i) {
+				                      Vector3 result = SimdMath::Transform((*points)[i], matrix);
+				                      sum += result.x + result.y + result.z;
+			                      }
+			                      return sum;
+		                      }});
+	}
+
+	// --- Easing（Easing.h / Easing.cpp の全ての関数） ---
+	{
+		auto ts = std::make_shared<std::vector<float>>(kCount);
+		for (float& t : *ts) {
+			t = unit(random);
+		}
+		// 式の版は呼び出し側と同じくインライン展開される形で、表の版は Easing.cpp の関数を呼ぶ形で計る
+		auto addEasing = [&benchmarks, ts](const char* name, auto function) {
+			benchmarks.push_back({name, kCount, [ts, function]() {
+				                      double sum = 0.0;
+				                      for (uint32_t i = 0; i < kCount; ++i) {
+					                      sum += function((*ts)[i]);
+				                      }
+				                      return sum;
+			                      }});
+		};
+		addEasing("Easing/EaseOutQuint", [](float t) { return EaseOutQuint(t); });
+		addEasing("Easing/EaseOutQuad", [](float t) { return EaseOutQuad(t); });
+		addEasing("Easing/EaseOutQuart", [](float t) { return EaseOutQuart(t); });
+		addEasing("Easing/EaseInOutQuad", [](float t) { return EaseInOutQuad(t); });
+		addEasing("Easing/EaseOutBack", [](float t) { return EaseOutBack(t); });
+		addEasing("Easing/Lerp", [](float t) { return Lerp(-3.0f, 5.0f, t); });
+		addEasing("Easing/EaseOutQuintBaked", EaseOutQuintBaked);
+		addEasing("Easing/EaseOutQuadBaked", EaseOutQuadBaked);
+		addEasing("Easing/EaseOutQuartBaked", EaseOutQuartBaked);
+		addEasing("Easing/EaseInOutQuadBaked", EaseInOutQuadBaked);
+		addEasing("Easing/EaseOutBackBaked", EaseOutBackBaked);
+	}
+
+	// --- MapChipField ---
+	{
+		std::string mapFilePath = options.resourceRoot + "/Resources/stage/stage" + std::to_string(options.stageNo) + ".csv";
+		auto field = std::make_shared<MapChipField>();
+		field->LoadMapChipCsv(mapFilePath);
+
+		// マップの範囲（少しはみ出すところも含める）の座標とマス番号
+		float width = static_cast<float>(field->GetNumBlockHorizontal()) * static_cast<float>(field->GetBlockWidth());
+		float height = static_cast<float>(field->GetNumBlockVertical()) * static_cast<float>(field->GetBlockHeight());
+		std::uniform_real_distribution<float> mapX(-1.0f, width);
+		std::uniform_real_distribution<float> mapY(-1.0f, height);
+		std::uniform_int_distribution<uint32_t> indexX(0, field->GetNumBlockHorizontal());
+		std::uniform_int_distribution<uint32_t> indexY(0, field->GetNumBlockVertical());
+		auto positions = std::make_shared<std::vector<SimVector3>>(kCount);
+		auto indices = std::make_shared<std::vector<MapChipField::IndexSet>>(kCount);
+		for (uint32_t i = 0; i < kCount; ++i) {
+			(*positions)[i] = SimVector3{mapX(random), mapY(random), 0.0f};
+			(*indices)[i] = {indexX(random), indexY(random)};
+		}
+
+		benchmarks.push_back({"MapChipField/GetMapChipIndexSetByPosition", kCount, [field, positions]() {
+			                      double sum = 0.0;
+			                      for (uint32_t i = 0; i < kCount; ++i) {
+				                      MapChipField::IndexSet indexSet = field->GetMapChipIndexSetByPosition((*positions)[i]);
+				                      sum += indexSet.xIndex + indexSet.yIndex;
+			                      }
+			                      return sum;
+		                      }});
+		benchmarks.push_back({"MapChipField/GetMapChipTypeByIndex", kCount, [field, indices]() {
+			                      double sum = 0.0;
+			                      for (uint32_t i = 0; i < kCount; ++i) {
+				                      sum += static_cast<int>(field->GetMapChipTypeByIndex((*indices)[i].xIndex, (*indices)[i].yIndex));
+			                      }
+			                      return sum;
+		                      }});
+		benchmarks.push_back({"MapChipField/GetRectByIndex", kCount, [field, indices]() {
+			                      double sum = 0.0;
+			                      for (uint32_t i = 0; i < kCount; ++i) {
+				                      MapChipField::Rect rect = field->GetRectByIndex((*indices)[i].xIndex, (*indices)[i].yIndex);
+				                      sum += static_cast<float>(rect.left) + static_cast<float>(rect.top);
+			                      }
+			                      return sum;
+		                      }});
+		benchmarks.push_back({"MapChipField/LoadMapChipCsv", 1, [field, mapFilePath]() {
+			                      field->LoadMapChipCsv(mapFilePath);
+			                      return static_cast<double>(static_cast<int>(field->GetMapChipTypeByIndex(0, 0)));
+		                      }});
+	}
+
+	// --- 当たり判定（半分くらいが当たる大きさにする） ---
+	{
+		std::uniform_real_distribution<float> center(-8.0f, 8.0f);
+		std::uniform_real_distribution<float> halfSize(0.5f, 3.0f);
+		auto boxes = std::make_shared<std::vector<AABB>>(kCount);
+		for (AABB& box : *boxes) {
+			float x = center(random);
+			float y = center(random);
+			float z = center(random) * 0.1f;
+			float half = halfSize(random);
+			box.min = SimVector3{x - half, y - half, z - half};
+			box.max = SimVector3{x + half, y + half, z + half};
+		}
+		benchmarks.push_back({"Collision/IsColliding", kCount - 1, [boxes]() {
+			                      double sum = 0.0;
+			                      for (uint32_t i = 0; i + 1 < kCount; ++i) {
+				                      sum += IsColliding((*boxes)[i], (*boxes)[i + 1]) ? 1.0 : 0.0;
+			                      }
+			                      return sum;
+		                      }});
+	}
+
+	return benchmarks;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	Options options;
+
+	for (int i = 1; i < argc; ++i) {
+		if (i + 1 >= argc) {
+			std::fprintf(stderr, "usage: %s [--root DIR] [--stage N] [--filter TEXT] [--min-time MS] [--samples N] [--json-out FILE] [--baseline FILE] [--threshold R]\n", argv[0]);
+			return 2;
+		}
+		if (std::strcmp(argv[i], "--root") == 0) {
+			options.resourceRoot = argv[++i];
+		} else if (std::strcmp(argv[i], "--stage") == 0) {
+			options.stageNo = std::atoi(argv[++i]);
+		} else if (std::strcmp(argv[i], "--filter") == 0) {
+			options.filter = argv[++i];
+		} else if (std::strcmp(argv[i], "--min-time") == 0) {
+			options.minTimeMilliseconds = std::strtod(argv[++i], nullptr);
+		} else if (std::strcmp(argv[i], "--samples") == 0) {
+			options.samples = (std::max)(1u, static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10)));
+		} else if (std::strcmp(argv[i], "--json-out") == 0) {
+			options.jsonOutPath = argv[++i];
+		} else if (std::strcmp(argv[i], "--baseline") == 0) {
+			options.baselinePath = argv[++i];
+		} else if (std::strcmp(argv[i], "--threshold") == 0) {
+			options.threshold = std::strtod(argv[++i], nullptr);
+		} else {
+			std::fprintf(stderr, "unknown option %s\n", argv[i]);
+			return 2;
+		}
+	}
+
+	std::vector<Result> baseline;
+	if (!options.baselinePath.empty() && !ReadJson(options.baselinePath, baseline)) {
+		std::fprintf(stderr, "cannot read baseline %s\n", options.baselinePath.c_str());
+		return 2;
+	}
+
+	std::printf("instruction set: %s\n", SimdMath::kInstructionSet);
+	std::vector<Result> results;
+	uint32_t regressionCount = 0;
+	for (const Benchmark& benchmark : MakeBenchmarks(options)) {
+		if (!options.filter.empty() && benchmark.name.find(options.filter) == std::string::npos) {
+			continue;
+		}
+		double nanosecondsPerOp = Measure(benchmark, options);
+		results.push_back({benchmark.name, nanosecondsPerOp});
+
+		auto found = std::find_if(baseline.begin(), baseline.end(), [&](const Result& result) { return result.name == benchmark.name; });
+		if (found == baseline.end() || found->nanosecondsPerOp <= 0.0) {
+			std::printf("%-48s %10.2f ns/op%s\n", benchmark.name.c_str(), nanosecondsPerOp, baseline.empty() ? "" : "  (not in baseline)");
+			continue;
+		}
+		double change = nanosecondsPerOp / found->nanosecondsPerOp - 1.0;
+		bool isRegressed = change > options.threshold;
+		regressionCount += isRegressed ? 1 : 0;
+		std::printf(
+		    "%-48s %10.2f ns/op  baseline %10.2f  %+6.1f%%%s\n", benchmark.name.c_str(), nanosecondsPerOp, found->nanosecondsPerOp, change * 100.0,
+		    isRegressed ? "  REGRESSED" : "");
+	}
+
+	if (!options.jsonOutPath.empty()) {
+		WriteJson(options.jsonOutPath, results);
+	}
+
+	std::printf("%zu benchmarks, checksum %.6g\n", results.size(), g_checksum);
+	if (!baseline.empty()) {
+		std::printf("regressions over %.0f%%: %u\n", options.threshold * 100.0, regressionCount);
+		return regressionCount == 0 ? 0 : 3;
+	}
+	return 0;
+}
@@ -0,0 +1,392 @@
+#include "Render/RecordingRenderBackend.h"
+#include "Render/RenderCommandList.h"
+#include "Render/StageDraw.h"
+#include "Sim/SimWorld.h"
+#include "System/GameTime.h"
+#include "System/JobSystem.h"
+#include "System/MapChipField.h"
+#include "Utils/AffineMatrix.h"
+#include "Utils/ViewCulling.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+// ステージを実際に動かしながら、GameScene::BuildSnapshot と同じ順で1フレームずつ RenderCommandList に記録し、
+// RecordingRenderBackend へ再生して描画の流れを確かめる（エンジンも GPU も使わない）
+// カメラの動き・映る範囲・何を描くかの判定・ブロックの範囲・HUD の並べ方は、GameScene と同じ StageDraw の関数を呼ぶ
+// （ここで用意するのは、エンジンが作るもの（モデル・テクスチャ・透視投影・敵の行列）の代わりだけ）
+// ・数: 再生したモデルの描画が、記録したブロックの範囲 + プレイヤー（+ 剣）+ ゴール + 描く敵 + 描く弾 + 天球 と一致するか。
+//       スプライトは HUD（ステージ番号・キー表示・ハート）の数と一致し、アトラス1枚なので1回の描画にまとまるか
+// ・中身: ブロックの行列がマップの位置と一致するか、並べ替え後の状態の変化が使ったモデル・テクスチャの組み合わせの数と一致するか
+// ・速さ: 記録 + 並べ替えと、再生（記録用）にかかる CPU 時間（表示するだけ）
+// --scale でマップを横に何倍にも並べた大きなステージを作り、--no-culling で映る範囲に関係なく全てのブロックを記録する（描画の数の上限を計る）
+//
+// 使い方: render_stream_bench [--root リソースのルート=.] [--frames フレーム数=600] [--scale 横に並べる数=1] [--no-culling] [ステージ番号...（省略時は 1 ～ 10）]
+
+namespace {
+
+struct Vector3 {
+	float x, y, z;
+};
+
+// エンジンの Camera の既定値と同じ透視投影
+const float kFovAngleY = 45.0f * 3.14159265f / 180.0f;
+const float kAspectRatio = 16.0f / 9.0f;
+const float kNearClip = 0.1f;
+const float kFarClip = 1000.0f;
+
+// 描画の流れで見分けるためのモデル（中身は使わないので、アドレスだけの目印にする）
+struct ModelTags {
+	int block, player, sword, goal, enemy, chasingEnemy, shooterEnemy, projectile, skydome;
+};
+ModelTags gModels;
+
+// テクスチャの番号（値に意味は無く、見分けられればよい）
+const uint32_t kPlayerTexture = 1;
+const uint32_t kSwordTexture = 2;
+const uint32_t kEnemyTexture = 3;
+const uint32_t kChasingEnemyTexture = 4;
+const uint32_t kShooterEnemyTexture = 5;
+const uint32_t kProjectileTexture = 6;
+const uint32_t kAtlasTexture = 7;
+
+RenderMatrix MakePerspective() {
+	RenderMatrix result = {};
+	float cot = 1.0f / std::tan(kFovAngleY / 2.0f);
+	result.m[0][0] = cot / kAspectRatio;
+	result.m[1][1] = cot;
+	result.m[2][2] = kFarClip / (kFarClip - kNearClip);
+	result.m[2][3] = 1.0f;
+	result.m[3][2] = -kNearClip * kFarClip / (kFarClip - kNearClip);
+	return result;
+}
+
+RenderMatrix MakeTranslate(float x, float y, float z) {
+	RenderMatrix result;
+	AffineMatrix::MakeTranslate(result, Vector3{x, y, z});
+	return result;
+}
+
+// SimRunner と同じ決まった入力（右へ進み、ときどきジャンプと攻撃）
+SimInput MakeScriptedInput(uint32_t frame) {
+	SimInput input;
+	input.SetHeld(SimButton::kRight, true);
+	input.SetTriggered(SimButton::kJump, frame % 40 == 0);
+	input.SetTriggered(SimButton::kAttack, frame % 90 == 45);
+	return input;
+}
+
+RenderMatrix MakeEnemyMatrix(const EnemyHotState& hot) {
+	RenderMatrix result;
+	AffineMatrix::Make(
+	    result, Vector3{hot.scale, hot.scale, hot.scale}, Vector3{hot.rotationX, hot.rotationY, 0.0f},
+	    Vector3{ToFloat(hot.translation.x), ToFloat(hot.translation.y), ToFloat(hot.translation.z)});
+	return result;
+}
+
+// 直前のステップのホットデータを保存する（GameScene::SavePreviousViewStates と同じ）
+template<typename Enemy>
+void SavePreviousStates(const std::vector<Enemy>& enemies, std::vector<EnemyHotState>& outPrevious) {
+	outPrevious.resize(enemies.size());
+	for (size_t i = 0; i < enemies.size(); ++i) {
+		outPrevious[i] = enemies[i].GetHotState();
+	}
+}
+
+struct StageResult {
+	uint64_t frameCount = 0;
+	uint64_t modelDrawCount = 0;
+	uint64_t spriteQuadCount = 0;
+	uint64_t spriteBatchCount = 0;
+	uint64_t stateChangeCount = 0;
+	double buildNanoseconds = 0.0;
+	double replayNanoseconds = 0.0;
+	uint64_t errorCount = 0;
+};
+
+StageResult RunStage(const std::string& resourceRoot, int stageNo, uint32_t frameCount, uint32_t scale, bool isCulling) {
+	StageResult result;
+
+	MapChipField mapChipField;
+	mapChipField.LoadMapChipCsv(resourceRoot + "/Resources/stage/stage" + std::to_string(stageNo) + ".csv");
+	const uint32_t columnCount = mapChipField.GetNumBlockHorizontal();
+	const uint32_t rowCount = mapChipField.GetNumBlockVertical();
+	if (columnCount == 0 || rowCount == 0) {
+		std::fprintf(stderr, "failed to load stage%d\n", stageNo);
+		result.errorCount = 1;
+		return result;
+	}
+	const float blockWidth = ToFloat(mapChipField.GetBlockWidth());
+	const float blockHeight = ToFloat(mapChipField.GetBlockHeight());
+
+	// GameScene::GenerateBlocks と同じく、ブロックの行列を列ごとに並べて各列の始まりを覚えておく（scale 倍に横へ並べる）
+	const uint32_t totalColumnCount = columnCount * scale;
+	std::vector<RenderMatrix> blockMatrices;
+	std::vector<uint32_t> blockColumnOffsets;
+	for (uint32_t j = 0; j < totalColumnCount; ++j) {
+		blockColumnOffsets.push_back(static_cast<uint32_t>(blockMatrices.size()));
+		uint32_t column = j % columnCount;
+		float offsetX = blockWidth * static_cast<float>(columnCount * (j / columnCount));
+		for (uint32_t i = 0; i < rowCount; ++i) {
+			if (mapChipField.GetMapChipTypeByIndex(column, i) == MapChipType::kBlock) {
+				SimVector3 position = mapChipField.GetMapChipPositionByIndex(column, i);
+				blockMatrices.push_back(MakeTranslate(ToFloat(position.x) + offsetX, ToFloat(position.y), ToFloat(position.z)));
+			}
+		}
+	}
+	blockColumnOffsets.push_back(static_cast<uint32_t>(blockMatrices.size()));
+
+	SimWorld world;
+	world.Initialize(&mapChipField, stageNo);
+
+	const RenderMatrix projection = MakePerspective();
+
+	// 表示側の状態（GameScene が持つものと同じ。最初は ResetViews・HUD::Initialize の直後と同じにする）
+	std::vector<EnemyHotState> previousEnemies;
+	std::vector<EnemyHotState> previousChasingEnemies;
+	std::vector<EnemyHotState> previousShooterEnemies;
+	float cameraRoll = 0.0f;
+	Vector3 cameraOffset = {0.0f, 0.0f, -StageDraw::kCameraDistance};
+	float goalCameraTimer = 0.0f;
+	float heartScales[StageDraw::kHeartCount];
+	std::fill(std::begin(heartScales), std::end(heartScales), 1.0f);
+
+	RenderCommandList list;
+	RecordingRenderBackend recorder;
+	std::vector<SimEvent> events;
+	// このフレームで使ったモデルとテクスチャの組み合わせ
+	std::vector<std::pair<const void*, uint32_t>> usedStates;
+
+	for (uint32_t frame = 0; frame < frameCount && world.GetPhase() != SimPhase::kCleared; ++frame) {
+		// --- GameScene::Update と同じく1ステップ進め、演出の状態を更新する（1フレーム1ステップ・補間なし） ---
+		SavePreviousStates(world.GetEnemies(), previousEnemies);
+		SavePreviousStates(world.GetChasingEnemies(), previousChasingEnemies);
+		SavePreviousStates(world.GetShooterEnemies(), previousShooterEnemies);
+
+		const SimPhase prePhase = world.GetPhase();
+		const SimInput input = MakeScriptedInput(frame);
+		events.clear();
+		world.Step(input, events);
+
+		bool isReset = std::any_of(events.begin(), events.end(), [](const SimEvent& event) { return event.type == SimEventType::kReset; });
+		if (isReset) {
+			// ResetViews と同じくカメラを戻し、補間の始点も作り直す
+			cameraRoll = 0.0f;
+			cameraOffset.z = -StageDraw::kCameraDistance;
+			SavePreviousStates(world.GetEnemies(), previousEnemies);
+			SavePreviousStates(world.GetChasingEnemies(), previousChasingEnemies);
+			SavePreviousStates(world.GetShooterEnemies(), previousShooterEnemies);
+		} else if (prePhase == SimPhase::kGoalAnimation) {
+			// UpdatePhaseEffects と同じく、ゴール演出中はカメラを近づける
+			goalCameraTimer += GameTime::GetDeltaTime();
+			cameraOffset.z = StageDraw::GetGoalCameraOffsetZ(goalCameraTimer);
+		}
+		for (const SimEvent& event : events) {
+			if (event.type == SimEventType::kPhaseChanged && event.phase == SimPhase::kGoalAnimation) {
+				goalCameraTimer = 0.0f;
+			}
+		}
+
+		const SimPlayer& player = world.GetPlayer();
+		for (int i = 0; i < StageDraw::kHeartCount; ++i) {
+			heartScales[i] = StageDraw::StepHeartScale(heartScales[i], i < player.GetHp());
+		}
+
+		// GameScene::UpdateCamera と同じカメラ（目標のロールは GameScene と同じく 0 のまま）
+		Vector3 target = {ToFloat(player.GetTranslation().x), ToFloat(player.GetTranslation().y), ToFloat(player.GetTranslation().z)};
+		cameraRoll = StageDraw::StepCameraRoll(cameraRoll, 0.0f);
+		RenderMatrix view = StageDraw::MakeCameraView(target, cameraOffset, cameraRoll);
+
+		ViewCulling::Rect visibleRect = ViewCulling::Rect::Infinite();
+		ViewCulling::TileRange tiles = {0, totalColumnCount - 1, 0, rowCount - 1};
+		if (isCulling) {
+			StageDraw::ComputeVisibleArea(view, projection, blockWidth, blockHeight, totalColumnCount, rowCount, visibleRect, tiles);
+		}
+
+		// --- 記録（GameScene::BuildSnapshot と同じ順） ---
+		auto buildStart = std::chrono::steady_clock::now();
+		uint32_t expectedModels = 0;
+		uint32_t expectedSprites = 0;
+		usedStates.clear();
+		auto addModel = [&](void* model, const RenderMatrix& matWorld, bool hasTexture, uint32_t textureHandle) {
+			if (hasTexture) {
+				list.AddModel(model, matWorld, textureHandle);
+			} else {
+				list.AddModel(model, matWorld);
+			}
+			++expectedModels;
+			if (std::find(usedStates.begin(), usedStates.end(), std::make_pair(static_cast<const void*>(model), textureHandle)) == usedStates.end()) {
+				usedStates.push_back({model, textureHandle});
+			}
+		};
+
+		list.Clear();
+		list.SetCamera(view, projection);
+
+		StageDraw::BlockRange blocks =
+		    StageDraw::AddVisibleBlocks(list, &gModels.block, false, 0, blockMatrices, blockColumnOffsets, tiles, nullptr);
+		if (blocks.count > 0) {
+			expectedModels += blocks.count;
+			usedStates.push_back({&gModels.block, 0});
+		}
+
+		// プレイヤーと、攻撃中の剣
+		if (StageDraw::IsPlayerDrawn(player)) {
+			addModel(&gModels.player, MakeTranslate(target.x, target.y, target.z), true, kPlayerTexture);
+		}
+		if (StageDraw::IsSwordDrawn(player)) {
+			addModel(&gModels.sword, MakeTranslate(target.x + 1.0f, target.y, target.z), true, kSwordTexture);
+		}
+
+		const SimVector3& goal = world.GetGoalPosition();
+		addModel(&gModels.goal, MakeTranslate(ToFloat(goal.x), ToFloat(goal.y), ToFloat(goal.z)), false, 0);
+
+		// 敵（EnemyView と同じく、直前か現在の位置が映っていて、死んでいないものを描く）
+		auto addEnemies = [&](const auto& enemies, const std::vector<EnemyHotState>& previous, int* model, uint32_t textureHandle) {
+			for (size_t i = 0; i < enemies.size(); ++i) {
+				const EnemyHotState& hot = enemies[i].GetHotState();
+				if (StageDraw::IsEnemyDrawn(hot, StageDraw::IsEnemyVisible(hot, previous[i], visibleRect))) {
+					addModel(model, MakeEnemyMatrix(hot), true, textureHandle);
+				}
+			}
+		};
+		addEnemies(world.GetEnemies(), previousEnemies, &gModels.enemy, kEnemyTexture);
+		addEnemies(world.GetChasingEnemies(), previousChasingEnemies, &gModels.chasingEnemy, kChasingEnemyTexture);
+		addEnemies(world.GetShooterEnemies(), previousShooterEnemies, &gModels.shooterEnemy, kShooterEnemyTexture);
+
+		// 弾は本体が死んでいても描画する
+		for (const SimShooterEnemy& enemy : world.GetShooterEnemies()) {
+			for (const SimProjectile& projectile : enemy.GetProjectiles()) {
+				SimVector3 position;
+				if (StageDraw::ComputeProjectilePosition(projectile, 1.0f, visibleRect, position)) {
+					addModel(&gModels.projectile, MakeTranslate(ToFloat(position.x), ToFloat(position.y), ToFloat(position.z)), true, kProjectileTexture);
+				}
+			}
+		}
+
+		addModel(&gModels.skydome, MakeTranslate(0.0f, 0.0f, 0.0f), false, 0);
+
+		// HUD（ステージ開始時の番号・キー表示・ハート）。キーはこのフレームで押したものを暗くする
+		if (world.GetPhase() == SimPhase::kStageStart) {
+			expectedSprites += StageDraw::AddStageNumber(list, kAtlasTexture, stageNo);
+		}
+		const bool isPressed[StageDraw::kInputGuideCount] = {input.IsTriggered(SimButton::kAttack), input.IsTriggered(SimButton::kJump), false};
+		expectedSprites += StageDraw::AddInputGuide(list, kAtlasTexture, false, isPressed);
+		expectedSprites += StageDraw::AddHearts(list, kAtlasTexture, heartScales);
+
+		list.Sort();
+		auto replayStart = std::chrono::steady_clock::now();
+
+		// --- 再生 ---
+		recorder.Clear();
+		RenderCommandList::ReplayStatistics statistics = list.Replay(recorder);
+		auto replayEnd = std::chrono::steady_clock::now();
+		result.buildNanoseconds += std::chrono::duration<double, std::nano>(replayStart - buildStart).count();
+		result.replayNanoseconds += std::chrono::duration<double, std::nano>(replayEnd - replayStart).count();
+
+		// --- 確かめる ---
+		const uint32_t firstBlock = blocks.first;
+		const uint32_t endBlock = blocks.first + blocks.count;
+		const RecordingRenderBackend::FrameSummary& summary = recorder.GetFrames().back();
+		bool isPassed = summary.modelDrawCount == expectedModels && statistics.drawCallCount == expectedModels + expectedSprites &&
+		                summary.spriteQuadCount == expectedSprites && summary.spriteBatchCount == (expectedSprites > 0 ? 1u : 0u) &&
+		                summary.instanceDrawCount == blocks.count && summary.stateChangeCount == usedStates.size() + summary.spriteBatchCount &&
+		                statistics.stateGroupCount == summary.stateChangeCount;
+
+		// ブロックは映る列の範囲が順に並び、行列は作ったものと同じ
+		uint32_t blockIndex = firstBlock;
+		bool isSpriteSeen = false;
+		for (const RecordingRenderBackend::DrawRecord& record : recorder.GetRecords()) {
+			if (record.type == RecordingRenderBackend::DrawRecord::Type::kSprite) {
+				isSpriteSeen = true;
+				isPassed &= record.textureHandle == kAtlasTexture;
+				continue;
+			}
+			// モデルはスプライトより先
+			isPassed &= !isSpriteSeen;
+			if (record.model == &gModels.block) {
+				isPassed &= record.isInstance && blockIndex < endBlock &&
+				            std::memcmp(&record.matWorld, &blockMatrices[blockIndex], sizeof(RenderMatrix)) == 0;
+				++blockIndex;
+			}
+		}
+		isPassed &= blockIndex == endBlock;
+
+		if (!isPassed) {
+			if (result.errorCount == 0) {
+				std::fprintf(
+				    stderr, "stage%d frame %u: models %u (expected %u), sprites %u/%u (expected %u), state changes %u (expected %zu)\n", stageNo, frame,
+				    summary.modelDrawCount, expectedModels, summary.spriteQuadCount, summary.spriteBatchCount, expectedSprites, summary.stateChangeCount,
+				    usedStates.size() + summary.spriteBatchCount);
+			}
+			++result.errorCount;
+		}
+
+		++result.frameCount;
+		result.modelDrawCount += summary.modelDrawCount;
+		result.spriteQuadCount += summary.spriteQuadCount;
+		result.spriteBatchCount += summary.spriteBatchCount;
+		result.stateChangeCount += summary.stateChangeCount;
+	}
+	return result;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	std::string resourceRoot = ".";
+	uint32_t frameCount = 600;
+	uint32_t scale = 1;
+	bool isCulling = true;
+	std::vector<int> stageNos;
+
+	for (int i = 1; i < argc; ++i) {
+		if (std::strcmp(argv[i], "--root") == 0 && i + 1 < argc) {
+			resourceRoot = argv[++i];
+		} else if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+			frameCount = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else if (std::strcmp(argv[i], "--scale") == 0 && i + 1 < argc) {
+			scale = (std::max)(1u, static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10)));
+		} else if (std::strcmp(argv[i], "--no-culling") == 0) {
+			isCulling = false;
+		} else if (argv[i][0] != '-') {
+			stageNos.push_back(std::atoi(argv[i]));
+		} else {
+			std::fprintf(stderr, "usage: %s [--root DIR] [--frames N] [--scale N] [--no-culling] [stage...]\n", argv[0]);
+			return 2;
+		}
+	}
+	if (stageNos.empty()) {
+		for (int stageNo = 1; stageNo <= 10; ++stageNo) {
+			stageNos.push_back(stageNo);
+		}
+	}
+
+	// SimWorld の更新は JobSystem を使うので、ヘッドレスでも最初に用意する
+	JobSystem::GetInstance()->Initialize();
+
+	bool isPassed = true;
+	for (int stageNo : stageNos) {
+		StageResult result = RunStage(resourceRoot, stageNo, frameCount, scale, isCulling);
+		double frames = result.frameCount > 0 ? static_cast<double>(result.frameCount) : 1.0;
+		std::printf(
+		    "stage%-2d x%u %s frames %4llu  models %7.1f  sprites %4.1f in %3.1f draws  state changes %4.1f  record+sort %8.0f ns  replay %8.0f ns  errors %llu\n",
+		    stageNo, scale, isCulling ? "culled" : "all   ", static_cast<unsigned long long>(result.frameCount), result.modelDrawCount / frames,
+		    result.spriteQuadCount / frames, result.spriteBatchCount / frames, result.stateChangeCount / frames, result.buildNanoseconds / frames,
+		    result.replayNanoseconds / frames, static_cast<unsigned long long>(result.errorCount));
+		isPassed &= result.errorCount == 0 && result.frameCount > 0;
+	}
+
+	JobSystem::GetInstance()->Finalize();
+
+	std::printf("%s\n", isPassed ? "PASS" : "FAIL");
+	return isPassed ? 0 : 1;
+}
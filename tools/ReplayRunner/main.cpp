@@ -0,0 +1,243 @@
+#include "Sim/InputRecording.h"
+#include "Sim/SimStateHash.h"
+#include "Sim/SimWorld.h"
+#include "System/JobSystem.h"
+#include "System/MapChipField.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+// 記録済みのリプレイをまとめてヘッドレスで再生する（1リプレイを1ジョブとして全コアに分配する）
+//
+// 使い方: replay_runner [--root リソースのルート=.] [--threads N] [--timeout フレーム数] [--verify] パス...
+//   パスには .rep ファイルか、.rep を探すフォルダ（サブフォルダも含む）を指定する
+//   --threads を付けなければ論理コア数で実行する
+//   --timeout を付けると、記録が長くてもそのフレーム数で打ち切る
+//   --verify を付けると各リプレイを2回再生し、状態ハッシュが全ステップ一致するかを確かめる
+//   同じ名前の .hash ファイルがあれば、その状態ハッシュとも比べる
+//   状態ハッシュがずれたリプレイがあれば終了コード 3 を返す
+
+namespace {
+
+// 再生結果
+enum class ReplayOutcome {
+	kClear,   // ゴールした
+	kDeath,   // ゴールせず、1回以上死亡した
+	kTimeout, // ゴールも死亡もせずに記録（または --timeout）が終わった
+};
+
+const char* ToString(ReplayOutcome outcome) {
+	switch (outcome) {
+	case ReplayOutcome::kClear:
+		return "clear";
+	case ReplayOutcome::kDeath:
+		return "death";
+	case ReplayOutcome::kTimeout:
+		return "timeout";
+	}
+	return "unknown";
+}
+
+// 1リプレイ分の入力と結果
+struct ReplayJob {
+	std::filesystem::path path;
+	InputRecording recording;
+	// 同じ名前の .hash（無ければ空）
+	SimHashLog expectedHashes;
+	bool hasExpectedHashes = false;
+
+	ReplayOutcome outcome = ReplayOutcome::kTimeout;
+	uint32_t frames = 0;
+	uint32_t deaths = 0;
+	// 状態ハッシュのずれ（isMismatched のときだけ有効）
+	bool isMismatched = false;
+	SimHashMismatch mismatch;
+	const char* mismatchSource = "";
+};
+
+/// <summary>
+/// 1回再生する
+/// </summary>
+/// <param name="job">再生するリプレイ（結果を書き込む）</param>
+/// <param name="mapChipField">共有の読み取り専用マップ</param>
+/// <param name="maxFrames">打ち切るフレーム数</param>
+/// <param name="outHashes">各ステップの状態ハッシュの追加先</param>
+void RunReplay(ReplayJob& job, const MapChipField* mapChipField, uint32_t maxFrames, SimHashLog& outHashes) {
+	SimWorld world;
+	world.Initialize(mapChipField, job.recording.GetStageNo());
+	outHashes.Start(job.recording.GetStageNo());
+
+	job.outcome = ReplayOutcome::kTimeout;
+	job.deaths = 0;
+
+	std::vector<SimEvent> events;
+	const std::vector<SimInput>& inputs = job.recording.GetInputs();
+	uint32_t frameCount = std::min(maxFrames, static_cast<uint32_t>(inputs.size()));
+	for (uint32_t frame = 0; frame < frameCount && world.GetPhase() != SimPhase::kCleared; ++frame) {
+		events.clear();
+		world.Step(inputs[frame], events);
+		outHashes.Push(world.ComputeStateHash());
+
+		for (const SimEvent& event : events) {
+			if (event.type == SimEventType::kPhaseChanged && event.phase == SimPhase::kDeath) {
+				++job.deaths;
+			}
+		}
+	}
+
+	job.frames = world.GetFrameCount();
+	if (world.GetPhase() == SimPhase::kCleared) {
+		job.outcome = ReplayOutcome::kClear;
+	} else if (job.deaths > 0) {
+		job.outcome = ReplayOutcome::kDeath;
+	}
+}
+
+/// <summary>
+/// パスから .rep ファイルを集める（フォルダならサブフォルダも探す）
+/// </summary>
+void CollectReplayFiles(const std::filesystem::path& path, std::vector<std::filesystem::path>& outFiles) {
+	std::error_code error;
+	if (std::filesystem::is_directory(path, error)) {
+		for (const auto& entry : std::filesystem::recursive_directory_iterator(path, error)) {
+			if (entry.is_regular_file() && entry.path().extension() == ".rep") {
+				outFiles.push_back(entry.path());
+			}
+		}
+	} else {
+		outFiles.push_back(path);
+	}
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	std::string resourceRoot = ".";
+	uint32_t threadCount = 0;
+	uint32_t timeoutFrames = UINT32_MAX;
+	bool verify = false;
+	std::vector<std::filesystem::path> replayFiles;
+
+	for (int i = 1; i < argc; ++i) {
+		if (std::strcmp(argv[i], "--root") == 0 && i + 1 < argc) {
+			resourceRoot = argv[++i];
+		} else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+			threadCount = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else if (std::strcmp(argv[i], "--timeout") == 0 && i + 1 < argc) {
+			timeoutFrames = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else if (std::strcmp(argv[i], "--verify") == 0) {
+			verify = true;
+		} else if (argv[i][0] == '-') {
+			std::fprintf(stderr, "usage: %s [--root resourceRoot] [--threads N] [--timeout frames] [--verify] paths...\n", argv[0]);
+			return 2;
+		} else {
+			CollectReplayFiles(argv[i], replayFiles);
+		}
+	}
+	if (replayFiles.empty()) {
+		std::fprintf(stderr, "no replay files\n");
+		return 2;
+	}
+	// 出力の順番を実行ごとに揃える
+	std::sort(replayFiles.begin(), replayFiles.end());
+
+	// --- リプレイの読み込み ---
+	std::vector<ReplayJob> jobs(replayFiles.size());
+	for (size_t i = 0; i < replayFiles.size(); ++i) {
+		ReplayJob& job = jobs[i];
+		job.path = replayFiles[i];
+		if (!job.recording.LoadFromFile(job.path.string())) {
+			std::fprintf(stderr, "failed to load replay %s\n", job.path.string().c_str());
+			return 1;
+		}
+		std::filesystem::path hashPath = job.path;
+		hashPath.replace_extension(".hash");
+		job.hasExpectedHashes = job.expectedHashes.LoadFromFile(hashPath.string());
+	}
+
+	// --- 使うステージのマップを1回ずつ読み込む（再生中は全スレッドで読み取り専用で共有する） ---
+	std::map<int, std::unique_ptr<MapChipField>> mapChipFields;
+	for (const ReplayJob& job : jobs) {
+		int stageNo = job.recording.GetStageNo();
+		if (mapChipFields.contains(stageNo)) {
+			continue;
+		}
+		auto mapChipField = std::make_unique<MapChipField>();
+		std::string mapFileName = resourceRoot + "/Resources/stage/stage" + std::to_string(stageNo) + ".csv";
+		mapChipField->LoadMapChipCsv(mapFileName);
+		if (mapChipField->GetNumBlockVertical() == 0 || mapChipField->GetNumBlockHorizontal() == 0) {
+			std::fprintf(stderr, "failed to load %s\n", mapFileName.c_str());
+			return 1;
+		}
+		mapChipFields.emplace(stageNo, std::move(mapChipField));
+	}
+
+	// --- 再生（1リプレイ1ジョブ。SimWorld 内の並列化はジョブの中なのでその場で実行される） ---
+	JobSystem* jobSystem = JobSystem::GetInstance();
+	jobSystem->Initialize(threadCount > 0 ? threadCount - 1 : UINT32_MAX);
+	uint32_t coreCount = jobSystem->GetWorkerCount() + 1;
+
+	auto startTime = std::chrono::steady_clock::now();
+	jobSystem->ParallelFor(static_cast<uint32_t>(jobs.size()), 1, [&](uint32_t begin, uint32_t end) {
+		for (uint32_t i = begin; i < end; ++i) {
+			ReplayJob& job = jobs[i];
+			const MapChipField* mapChipField = mapChipFields.at(job.recording.GetStageNo()).get();
+
+			SimHashLog hashes;
+			RunReplay(job, mapChipField, timeoutFrames, hashes);
+
+			// --timeout で打ち切った場合、長さが違うのはずれではない
+			bool isTruncated = timeoutFrames < job.recording.GetStepCount();
+			if (job.hasExpectedHashes && job.expectedHashes.FindFirstMismatch(hashes, job.mismatch) && !(isTruncated && job.mismatch.field == SimHashField::kCount)) {
+				job.isMismatched = true;
+				job.mismatchSource = "hash file";
+			}
+			if (verify) {
+				SimHashLog secondHashes;
+				ReplayJob second = job;
+				RunReplay(second, mapChipField, timeoutFrames, secondHashes);
+				if (!job.isMismatched && hashes.FindFirstMismatch(secondHashes, job.mismatch)) {
+					job.isMismatched = true;
+					job.mismatchSource = "second run";
+				}
+			}
+		}
+	});
+	double elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+	jobSystem->Finalize();
+
+	// --- 結果 ---
+	uint32_t outcomeCounts[3] = {};
+	uint32_t mismatchCount = 0;
+	uint64_t totalFrames = 0;
+	for (const ReplayJob& job : jobs) {
+		++outcomeCounts[static_cast<size_t>(job.outcome)];
+		// --verify のときは2回分進めている
+		totalFrames += static_cast<uint64_t>(job.frames) * (verify ? 2 : 1);
+
+		std::printf("%s: stage %d, %s, %u frames, %u deaths", job.path.string().c_str(), job.recording.GetStageNo(), ToString(job.outcome), job.frames, job.deaths);
+		if (job.isMismatched) {
+			++mismatchCount;
+			std::printf(", MISMATCH vs %s at step %u (%s)\n", job.mismatchSource, job.mismatch.step, ToString(job.mismatch.field));
+		} else {
+			std::printf("\n");
+		}
+	}
+
+	double framesPerSecond = elapsedSeconds > 0.0 ? static_cast<double>(totalFrames) / elapsedSeconds : 0.0;
+	std::printf(
+	    "replays: %zu (clear %u, death %u, timeout %u), mismatches %u\n", jobs.size(), outcomeCounts[static_cast<size_t>(ReplayOutcome::kClear)],
+	    outcomeCounts[static_cast<size_t>(ReplayOutcome::kDeath)], outcomeCounts[static_cast<size_t>(ReplayOutcome::kTimeout)], mismatchCount);
+	std::printf(
+	    "throughput: %llu frames in %.3f ms on %u cores, %.0f frames/s (%.0f frames/s per core)\n", static_cast<unsigned long long>(totalFrames), elapsedSeconds * 1000.0, coreCount,
+	    framesPerSecond, framesPerSecond / coreCount);
+
+	return mismatchCount > 0 ? 3 : 0;
+}
@@ -0,0 +1,429 @@
+#include "Sim/SimRollback.h"
+#include "Sim/SimWorld.h"
+#include "System/MapChipField.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+// ロールバック方式の2人レースを、1つのプロセス内の2つのインスタンスで確かめる
+// 各インスタンスは自分の入力をループバックの UDP で相手へ送り、送信側で遅延とパケットロスを加える。
+// 最後に両方のインスタンスの状態が、ネットワークを通さずに同じ入力で進めた結果と一致するかを確かめ、
+// 巻き戻しにかかった時間と、1フレームの予算内に収まる巻き戻しの深さを表示する
+//
+// 使い方: rollback_harness [--root リソースのルート=.] [--stage ステージ番号=2] [--frames フレーム数=1800]
+//                         [--delay 片道の遅延フレーム数=4] [--jitter 遅延の揺らぎフレーム数=2] [--loss ロス率%=10]
+//                         [--budget-ms 1フレームの予算=16]
+//   状態が一致しなければ終了コード 3 を返す
+
+namespace {
+
+#ifdef _WIN32
+using SocketHandle = SOCKET;
+const SocketHandle kInvalidSocket = INVALID_SOCKET;
+void CloseSocket(SocketHandle socketHandle) { closesocket(socketHandle); }
+#else
+using SocketHandle = int;
+const SocketHandle kInvalidSocket = -1;
+void CloseSocket(SocketHandle socketHandle) { close(socketHandle); }
+#endif
+
+// パケットの識別子 "AL4N"
+const uint32_t kPacketMagic = 0x4E344C41;
+// 1パケットに載せる入力の数（ロスに備えて直近の入力をまとめて送り直す。巻き戻せる数の2倍あれば、
+// 相手が待っているフレームの入力は必ず含まれる）
+const uint32_t kInputsPerPacket = SimRollbackBuffer::kMaxRollbackFrames * 2;
+// パケットの大きさ（識別子・プレイヤー番号・個数・先頭フレーム + 入力）
+const size_t kPacketHeaderSize = 4 + 1 + 1 + 4;
+const size_t kMaxPacketSize = kPacketHeaderSize + kInputsPerPacket * 2;
+
+// 2人分のプレイヤー
+const uint32_t kPlayerCount = 2;
+// 各プレイヤーの入力を変える間隔（フレーム）
+const uint32_t kInputSegmentFrames = 12;
+
+/// <summary>
+/// 整数を混ぜて擬似乱数にする（同じ値からは常に同じ結果になる）
+/// </summary>
+uint32_t Mix(uint32_t value) {
+	value ^= value >> 16;
+	value *= 0x7FEB352Du;
+	value ^= value >> 15;
+	value *= 0x846CA68Bu;
+	value ^= value >> 16;
+	return value;
+}
+
+/// <summary>
+/// プレイヤーが押しているボタン（一定フレームごとに、右へ進むのを基本に左・ジャンプ・攻撃を混ぜる）
+/// </summary>
+uint8_t ScriptedHeld(uint32_t player, uint32_t frame) {
+	uint32_t random = Mix((frame / kInputSegmentFrames) * kPlayerCount + player + 1);
+	uint8_t held = (random % 6 == 0) ? static_cast<uint8_t>(SimButton::kLeft) : static_cast<uint8_t>(SimButton::kRight);
+	held |= ((random >> 8) % 3 == 0) ? static_cast<uint8_t>(SimButton::kJump) : 0;
+	held |= ((random >> 16) % 10 == 0) ? static_cast<uint8_t>(SimButton::kAttack) : 0;
+	return held;
+}
+
+SimInput ScriptedInput(uint32_t player, uint32_t frame) {
+	SimInput input;
+	input.held = ScriptedHeld(player, frame);
+	input.triggered = input.held & ~(frame > 0 ? ScriptedHeld(player, frame - 1) : 0);
+	return input;
+}
+
+/// <summary>
+/// 送信待ちのパケット（遅延させるため、送る時刻になるまで溜めておく）
+/// </summary>
+struct DelayedPacket {
+	uint32_t releaseTick = 0;
+	std::vector<uint8_t> bytes;
+};
+
+/// <summary>
+/// 1人分のインスタンス（ロールバックのセッションと UDP のソケット）
+/// </summary>
+struct Peer {
+	uint32_t localPlayer = 0;
+	SimRollbackSession session;
+	SocketHandle socketHandle = kInvalidSocket;
+	sockaddr_in remoteAddress = {};
+	std::vector<DelayedPacket> outgoing;
+	uint32_t randomState = 0;
+
+	// 統計
+	uint32_t stallTicks = 0;
+	uint64_t sentPackets = 0;
+	uint64_t droppedPackets = 0;
+	uint64_t receivedPackets = 0;
+	double maxFrameSeconds = 0.0;
+};
+
+uint32_t NextRandom(uint32_t& state) {
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+/// <summary>
+/// 127.0.0.1 の空いているポートに、ブロックしない UDP ソケットを作る
+/// </summary>
+bool OpenLoopbackSocket(SocketHandle& outSocket, sockaddr_in& outAddress) {
+	outSocket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	if (outSocket == kInvalidSocket) {
+		return false;
+	}
+	sockaddr_in address = {};
+	address.sin_family = AF_INET;
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	address.sin_port = 0;
+	if (bind(outSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+		return false;
+	}
+	socklen_t addressLength = sizeof(address);
+	if (getsockname(outSocket, reinterpret_cast<sockaddr*>(&address), &addressLength) != 0) {
+		return false;
+	}
+#ifdef _WIN32
+	u_long nonBlocking = 1;
+	ioctlsocket(outSocket, FIONBIO, &nonBlocking);
+#else
+	fcntl(outSocket, F_SETFL, fcntl(outSocket, F_GETFL, 0) | O_NONBLOCK);
+#endif
+	outAddress = address;
+	return true;
+}
+
+void WriteU32(uint8_t* bytes, uint32_t value) {
+	for (int i = 0; i < 4; ++i) {
+		bytes[i] = static_cast<uint8_t>(value >> (i * 8));
+	}
+}
+
+uint32_t ReadU32(const uint8_t* bytes) {
+	uint32_t value = 0;
+	for (int i = 0; i < 4; ++i) {
+		value |= static_cast<uint32_t>(bytes[i]) << (i * 8);
+	}
+	return value;
+}
+
+/// <summary>
+/// 直近の自分の入力をパケットにして、遅延とロスを加えて送信待ちに積む
+/// </summary>
+void QueueLocalInputs(Peer& peer, uint32_t tick, uint32_t delayTicks, uint32_t jitterTicks, uint32_t lossPercent) {
+	uint32_t endFrame = peer.session.GetCurrentFrame();
+	uint32_t startFrame = endFrame > kInputsPerPacket ? endFrame - kInputsPerPacket : 0;
+	if (startFrame == endFrame) {
+		return;
+	}
+
+	std::vector<uint8_t> bytes(kPacketHeaderSize);
+	WriteU32(&bytes[0], kPacketMagic);
+	bytes[4] = static_cast<uint8_t>(peer.localPlayer);
+	bytes[5] = static_cast<uint8_t>(endFrame - startFrame);
+	WriteU32(&bytes[6], startFrame);
+	for (uint32_t frame = startFrame; frame < endFrame; ++frame) {
+		SimInput input;
+		peer.session.GetConfirmedInput(peer.localPlayer, frame, input);
+		bytes.push_back(input.held);
+		bytes.push_back(input.triggered);
+	}
+
+	if (NextRandom(peer.randomState) % 100 < lossPercent) {
+		++peer.droppedPackets;
+		return;
+	}
+	uint32_t jitter = jitterTicks > 0 ? NextRandom(peer.randomState) % (jitterTicks + 1) : 0;
+	peer.outgoing.push_back({tick + delayTicks + jitter, std::move(bytes)});
+}
+
+/// <summary>
+/// 送る時刻になったパケットを送信する
+/// </summary>
+void FlushOutgoing(Peer& peer, uint32_t tick) {
+	auto isDue = [tick](const DelayedPacket& packet) { return packet.releaseTick <= tick; };
+	for (const DelayedPacket& packet : peer.outgoing) {
+		if (isDue(packet)) {
+			sendto(
+			    peer.socketHandle, reinterpret_cast<const char*>(packet.bytes.data()), static_cast<int>(packet.bytes.size()), 0, reinterpret_cast<const sockaddr*>(&peer.remoteAddress),
+			    sizeof(peer.remoteAddress));
+			++peer.sentPackets;
+		}
+	}
+	peer.outgoing.erase(std::remove_if(peer.outgoing.begin(), peer.outgoing.end(), isDue), peer.outgoing.end());
+}
+
+/// <summary>
+/// 届いているパケットを全て読み、相手の入力をセッションへ渡す
+/// </summary>
+void ReceiveRemoteInputs(Peer& peer) {
+	uint8_t bytes[kMaxPacketSize];
+	while (true) {
+		int size = static_cast<int>(recv(peer.socketHandle, reinterpret_cast<char*>(bytes), static_cast<int>(sizeof(bytes)), 0));
+		if (size < static_cast<int>(kPacketHeaderSize)) {
+			break;
+		}
+		uint32_t player = bytes[4];
+		uint32_t count = bytes[5];
+		if (ReadU32(&bytes[0]) != kPacketMagic || player >= kPlayerCount || player == peer.localPlayer || size != static_cast<int>(kPacketHeaderSize + count * 2)) {
+			continue;
+		}
+		++peer.receivedPackets;
+		uint32_t startFrame = ReadU32(&bytes[6]);
+		for (uint32_t i = 0; i < count; ++i) {
+			SimInput input;
+			input.held = bytes[kPacketHeaderSize + i * 2];
+			input.triggered = bytes[kPacketHeaderSize + i * 2 + 1];
+			peer.session.SetInput(player, startFrame + i, input);
+		}
+	}
+}
+
+/// <summary>
+/// 深さ depth の巻き戻し（全プレイヤーの状態の復元と depth フレームの進め直し）にかかる時間を計る
+/// </summary>
+double MeasureRollbackSeconds(const MapChipField* mapChipField, int stageNo, uint32_t depth) {
+	std::vector<SimWorld> worlds(kPlayerCount);
+	std::vector<SimRollbackBuffer> rollbackBuffers(kPlayerCount);
+	std::vector<SimEvent> events;
+	const uint32_t kWarmupFrames = 300;
+	for (uint32_t player = 0; player < kPlayerCount; ++player) {
+		worlds[player].Initialize(mapChipField, stageNo);
+		rollbackBuffers[player].Initialize(worlds[player]);
+		// 開始演出を抜けてプレイ中の状態から計る
+		for (uint32_t frame = 0; frame < kWarmupFrames; ++frame) {
+			rollbackBuffers[player].Save(worlds[player]);
+			events.clear();
+			worlds[player].Step(ScriptedInput(player, frame), events);
+		}
+	}
+
+	const uint32_t kIterations = 200;
+	uint32_t rollbackFrame = kWarmupFrames - depth;
+	auto startTime = std::chrono::steady_clock::now();
+	for (uint32_t iteration = 0; iteration < kIterations; ++iteration) {
+		for (uint32_t player = 0; player < kPlayerCount; ++player) {
+			rollbackBuffers[player].Load(rollbackFrame, worlds[player]);
+			for (uint32_t frame = rollbackFrame; frame < kWarmupFrames; ++frame) {
+				rollbackBuffers[player].Save(worlds[player]);
+				events.clear();
+				worlds[player].Step(ScriptedInput(player, frame), events);
+			}
+		}
+	}
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count() / kIterations;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	std::string resourceRoot = ".";
+	int stageNo = 2;
+	uint32_t frameCount = 1800;
+	uint32_t delayTicks = 4;
+	uint32_t jitterTicks = 2;
+	uint32_t lossPercent = 10;
+	double budgetMilliseconds = 16.0;
+
+	for (int i = 1; i < argc; ++i) {
+		if (i + 1 >= argc) {
+			std::fprintf(stderr, "usage: %s [--root resourceRoot] [--stage N] [--frames N] [--delay N] [--jitter N] [--loss percent] [--budget-ms ms]\n", argv[0]);
+			return 2;
+		}
+		if (std::strcmp(argv[i], "--root") == 0) {
+			resourceRoot = argv[++i];
+		} else if (std::strcmp(argv[i], "--stage") == 0) {
+			stageNo = std::atoi(argv[++i]);
+		} else if (std::strcmp(argv[i], "--frames") == 0) {
+			frameCount = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else if (std::strcmp(argv[i], "--delay") == 0) {
+			delayTicks = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else if (std::strcmp(argv[i], "--jitter") == 0) {
+			jitterTicks = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else if (std::strcmp(argv[i], "--loss") == 0) {
+			lossPercent = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else if (std::strcmp(argv[i], "--budget-ms") == 0) {
+			budgetMilliseconds = std::atof(argv[++i]);
+		} else {
+			std::fprintf(stderr, "unknown option %s\n", argv[i]);
+			return 2;
+		}
+	}
+
+	// マップの読み込み
+	MapChipField mapChipField;
+	std::string mapFileName = resourceRoot + "/Resources/stage/stage" + std::to_string(stageNo) + ".csv";
+	mapChipField.LoadMapChipCsv(mapFileName);
+	if (mapChipField.GetNumBlockVertical() == 0 || mapChipField.GetNumBlockHorizontal() == 0) {
+		std::fprintf(stderr, "failed to load %s\n", mapFileName.c_str());
+		return 1;
+	}
+
+#ifdef _WIN32
+	WSADATA wsaData;
+	if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0) {
+		std::fprintf(stderr, "WSAStartup failed\n");
+		return 1;
+	}
+#endif
+
+	// --- 2つのインスタンスを用意し、互いのポートを相手の送り先にする ---
+	Peer peers[kPlayerCount];
+	sockaddr_in addresses[kPlayerCount] = {};
+	for (uint32_t i = 0; i < kPlayerCount; ++i) {
+		peers[i].localPlayer = i;
+		peers[i].session.Initialize(&mapChipField, stageNo, kPlayerCount);
+		peers[i].randomState = 0x9E3779B9u ^ (i * 0x85EBCA6Bu) ^ 1u;
+		if (!OpenLoopbackSocket(peers[i].socketHandle, addresses[i])) {
+			std::fprintf(stderr, "failed to open a loopback UDP socket\n");
+			return 1;
+		}
+	}
+	peers[0].remoteAddress = addresses[1];
+	peers[1].remoteAddress = addresses[0];
+
+	// --- 1ティック = 1フレーム分の時間として、両方のインスタンスを交互に進める ---
+	// （実時間では待たずに回す。遅延とジッタはティック単位で数える）
+	const uint32_t kMaxTicks = frameCount * 20 + 600;
+	uint32_t tick = 0;
+	bool isFinished = false;
+	for (; tick < kMaxTicks && !isFinished; ++tick) {
+		isFinished = true;
+		for (Peer& peer : peers) {
+			ReceiveRemoteInputs(peer);
+
+			SimRollbackSession& session = peer.session;
+			if (session.GetCurrentFrame() < frameCount) {
+				if (session.CanAdvance()) {
+					auto startTime = std::chrono::steady_clock::now();
+					session.SetInput(peer.localPlayer, session.GetCurrentFrame(), ScriptedInput(peer.localPlayer, session.GetCurrentFrame()));
+					session.AdvanceFrame();
+					peer.maxFrameSeconds = (std::max)(peer.maxFrameSeconds, std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count());
+				} else {
+					// 相手の入力を待つ（その間も自分の入力は送り続ける）
+					++peer.stallTicks;
+				}
+			} else {
+				// 最後のフレームまで進めたら、残りの入力が届くのを待って確定させる
+				session.ApplyPendingRollback();
+			}
+
+			QueueLocalInputs(peer, tick, delayTicks, jitterTicks, lossPercent);
+			FlushOutgoing(peer, tick);
+
+			if (session.GetCurrentFrame() < frameCount || session.GetConfirmedFrame() < frameCount) {
+				isFinished = false;
+			}
+		}
+	}
+	for (Peer& peer : peers) {
+		peer.session.ApplyPendingRollback();
+		CloseSocket(peer.socketHandle);
+	}
+#ifdef _WIN32
+	WSACleanup();
+#endif
+
+	// --- ネットワークを通さずに同じ入力で進めた結果と比べる ---
+	int exitCode = 0;
+	std::vector<SimWorld> referenceWorlds(kPlayerCount);
+	std::vector<SimEvent> events;
+	for (uint32_t player = 0; player < kPlayerCount; ++player) {
+		referenceWorlds[player].Initialize(&mapChipField, stageNo);
+		for (uint32_t frame = 0; frame < frameCount; ++frame) {
+			events.clear();
+			referenceWorlds[player].Step(ScriptedInput(player, frame), events);
+		}
+	}
+
+	std::printf(
+	    "stage %d: %u frames, 2 instances over loopback UDP, delay %u+%u frames, loss %u%%, %u ticks\n", stageNo, frameCount, delayTicks, jitterTicks, lossPercent, tick);
+	for (const Peer& peer : peers) {
+		const SimRollbackSession& session = peer.session;
+		const SimRollbackSession::Stats& stats = session.GetStats();
+		bool isMatched = session.GetConfirmedFrame() >= frameCount;
+		for (uint32_t player = 0; player < kPlayerCount; ++player) {
+			isMatched = isMatched && session.GetWorld(player).ComputeStateHash() == referenceWorlds[player].ComputeStateHash();
+		}
+		if (!isMatched) {
+			exitCode = 3;
+		}
+		double meanRollbackMicroseconds = stats.rollbackCount > 0 ? stats.totalRollbackSeconds / stats.rollbackCount * 1e6 : 0.0;
+		std::printf(
+		    "peer %u: %s, rollbacks %llu (max depth %u, %llu frames resimulated), rollback mean %.1f us max %.1f us, worst frame %.1f us, stalled %u ticks, packets sent %llu dropped %llu received %llu\n",
+		    peer.localPlayer, isMatched ? "state matches reference" : "STATE MISMATCH", static_cast<unsigned long long>(stats.rollbackCount), stats.maxRollbackDepth,
+		    static_cast<unsigned long long>(stats.resimulatedFrames), meanRollbackMicroseconds, stats.maxRollbackSeconds * 1e6, peer.maxFrameSeconds * 1e6, peer.stallTicks,
+		    static_cast<unsigned long long>(peer.sentPackets), static_cast<unsigned long long>(peer.droppedPackets), static_cast<unsigned long long>(peer.receivedPackets));
+	}
+
+	// --- 予算内に収まる巻き戻しの深さ（実測した深さごとの時間と、1フレームあたりの時間からの見積もり） ---
+	std::printf("rollback cost (%u players, restore + resimulate):", kPlayerCount);
+	double perFrameSeconds = 0.0;
+	for (uint32_t depth = 1; depth <= SimRollbackBuffer::kMaxRollbackFrames; depth *= 2) {
+		double seconds = MeasureRollbackSeconds(&mapChipField, stageNo, depth);
+		perFrameSeconds = (std::max)(perFrameSeconds, seconds / depth);
+		std::printf(" depth %u %.1f us", depth, seconds * 1e6);
+	}
+	uint64_t budgetDepth = perFrameSeconds > 0.0 ? static_cast<uint64_t>(budgetMilliseconds / 1000.0 / perFrameSeconds) : 0;
+	std::printf(
+	    "\nbudget %.1f ms: up to %llu frames of rollback per frame (%.2f us per resimulated frame; the buffer keeps %u)\n", budgetMilliseconds, static_cast<unsigned long long>(budgetDepth),
+	    perFrameSeconds * 1e6, SimRollbackBuffer::kMaxRollbackFrames);
+	return exitCode;
+}
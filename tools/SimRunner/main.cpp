@@ -0,0 +1,255 @@
+#include "Sim/InputRecording.h"
+#include "Sim/SimStateHash.h"
+#include "Sim/SimWorld.h"
+#include "System/GameTime.h"
+#include "System/JobSystem.h"
+#include "System/MapChipField.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// ヘッドレス実行：描画・音・入力デバイスを使わずに1ステージ分のシミュレーションを回す
+//
+// 使い方: sim_runner [ステージ番号=1] [フレーム数=3600] [リソースのルート=.] [--idle] [--melee] [--record ファイル] [--replay ファイル]
+//   --idle を付けると無入力、付けなければ「右へ走りながら定期的にジャンプ・攻撃」する入力を与える
+//   --melee を付けると攻撃の前後だけ立ち止まり、突進攻撃の代わりに近接攻撃をする
+//   --record を付けると与えた入力をファイルへ保存する
+//   --replay を付けると記録ファイルの入力で（記録のステージを、記録の長さだけ）実時間より速く再生する
+//   --hash-out を付けると各ステップの状態ハッシュをファイルへ保存する
+//   --hash-check を付けると保存済みの状態ハッシュと比べ、最初にずれたステップと区分を報告する（ずれたら終了コード 3）
+//   --single-thread を付けると JobSystem を使わずに実行する（並列実行との比較用）
+
+namespace {
+
+const char* ToString(SimPhase phase) {
+	switch (phase) {
+	case SimPhase::kStageStart:
+		return "StageStart";
+	case SimPhase::kFadeIn:
+		return "FadeIn";
+	case SimPhase::kPlay:
+		return "Play";
+	case SimPhase::kGoalAnimation:
+		return "GoalAnimation";
+	case SimPhase::kDeath:
+		return "Death";
+	case SimPhase::kDeathFadeOut:
+		return "DeathFadeOut";
+	case SimPhase::kFadeOut:
+		return "FadeOut";
+	case SimPhase::kCleared:
+		return "Cleared";
+	}
+	return "Unknown";
+}
+
+/// <summary>
+/// 決まった入力パターンを作る（同じフレーム番号なら常に同じ入力になる）
+/// </summary>
+SimInput MakeScriptedInput(uint32_t frame) {
+	SimInput input;
+	input.SetHeld(SimButton::kRight, true);
+	input.SetTriggered(SimButton::kJump, frame % 40 == 0);
+	input.SetTriggered(SimButton::kAttack, frame % 90 == 45);
+	return input;
+}
+
+/// <summary>
+/// 近接攻撃をする入力パターンを作る（攻撃の前後は左右の入力を離すので、突進攻撃にならない）
+/// </summary>
+SimInput MakeScriptedMeleeInput(uint32_t frame) {
+	SimInput input;
+	uint32_t phase = frame % 90;
+	input.SetHeld(SimButton::kRight, phase < 40 || phase >= 70);
+	input.SetTriggered(SimButton::kJump, frame % 40 == 0);
+	input.SetTriggered(SimButton::kAttack, phase == 45);
+	return input;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	int stageNo = 1;
+	uint32_t frames = 3600;
+	std::string resourceRoot = ".";
+	bool idle = false;
+	bool melee = false;
+	std::string recordPath;
+	std::string replayPath;
+	std::string hashOutPath;
+	std::string hashCheckPath;
+	bool singleThread = false;
+
+	int positional = 0;
+	for (int i = 1; i < argc; ++i) {
+		if (std::strcmp(argv[i], "--idle") == 0) {
+			idle = true;
+			continue;
+		}
+		if (std::strcmp(argv[i], "--melee") == 0) {
+			melee = true;
+			continue;
+		}
+		if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+			recordPath = argv[++i];
+			continue;
+		}
+		if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+			replayPath = argv[++i];
+			continue;
+		}
+		if (std::strcmp(argv[i], "--hash-out") == 0 && i + 1 < argc) {
+			hashOutPath = argv[++i];
+			continue;
+		}
+		if (std::strcmp(argv[i], "--hash-check") == 0 && i + 1 < argc) {
+			hashCheckPath = argv[++i];
+			continue;
+		}
+		if (std::strcmp(argv[i], "--single-thread") == 0) {
+			singleThread = true;
+			continue;
+		}
+		switch (positional++) {
+		case 0:
+			stageNo = std::atoi(argv[i]);
+			break;
+		case 1:
+			frames = static_cast<uint32_t>(std::strtoul(argv[i], nullptr, 10));
+			break;
+		case 2:
+			resourceRoot = argv[i];
+			break;
+		default:
+			std::fprintf(stderr, "usage: %s [stageNo] [frames] [resourceRoot] [--idle] [--melee] [--record file] [--replay file] [--hash-out file] [--hash-check file] [--single-thread]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	// 再生する記録の読み込み（ステージ番号とフレーム数は記録に従う）
+	InputRecording replay;
+	if (!replayPath.empty()) {
+		if (!replay.LoadFromFile(replayPath)) {
+			std::fprintf(stderr, "failed to load replay %s\n", replayPath.c_str());
+			return 1;
+		}
+		stageNo = replay.GetStageNo();
+		frames = static_cast<uint32_t>(replay.GetStepCount());
+	}
+
+	// マップの読み込み
+	MapChipField mapChipField;
+	std::string mapFileName = resourceRoot + "/Resources/stage/stage" + std::to_string(stageNo) + ".csv";
+	mapChipField.LoadMapChipCsv(mapFileName);
+	if (mapChipField.GetNumBlockVertical() == 0 || mapChipField.GetNumBlockHorizontal() == 0) {
+		std::fprintf(stderr, "failed to load %s\n", mapFileName.c_str());
+		return 1;
+	}
+
+	JobSystem::GetInstance()->Initialize();
+	JobSystem::GetInstance()->SetEnabled(!singleThread);
+
+	SimWorld world;
+	world.Initialize(&mapChipField, stageNo);
+
+	InputRecording recording;
+	recording.Start(stageNo);
+
+	// 各ステップの状態ハッシュ（常に取り、かかった時間も計る）
+	SimHashLog hashLog;
+	hashLog.Start(stageNo);
+	std::chrono::steady_clock::duration hashTime{};
+
+	// イベントの種類ごとの発生回数
+	uint32_t eventCounts[static_cast<size_t>(SimEventType::kReset) + 1] = {};
+	uint32_t resetCount = 0;
+	std::vector<SimEvent> events;
+
+	auto startTime = std::chrono::steady_clock::now();
+	for (uint32_t frame = 0; frame < frames && world.GetPhase() != SimPhase::kCleared; ++frame) {
+		SimInput input;
+		if (!replayPath.empty()) {
+			input = replay.GetInputs()[frame];
+		} else if (melee) {
+			input = MakeScriptedMeleeInput(frame);
+		} else if (!idle) {
+			input = MakeScriptedInput(frame);
+		}
+		recording.Push(input);
+		events.clear();
+		world.Step(input, events);
+
+		auto hashStart = std::chrono::steady_clock::now();
+		hashLog.Push(world.ComputeStateHash());
+		hashTime += std::chrono::steady_clock::now() - hashStart;
+		for (const SimEvent& event : events) {
+			++eventCounts[static_cast<size_t>(event.type)];
+			if (event.type == SimEventType::kReset) {
+				++resetCount;
+			}
+		}
+	}
+
+	double elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+	double hashSeconds = std::chrono::duration<double>(hashTime).count();
+
+	if (!recordPath.empty() && !recording.SaveToFile(recordPath)) {
+		std::fprintf(stderr, "failed to save recording %s\n", recordPath.c_str());
+		return 1;
+	}
+
+	if (!hashOutPath.empty() && !hashLog.SaveToFile(hashOutPath)) {
+		std::fprintf(stderr, "failed to save hashes %s\n", hashOutPath.c_str());
+		return 1;
+	}
+
+	// 保存済みのハッシュ列との比較
+	int exitCode = 0;
+	if (!hashCheckPath.empty()) {
+		SimHashLog expected;
+		if (!expected.LoadFromFile(hashCheckPath)) {
+			std::fprintf(stderr, "failed to load hashes %s\n", hashCheckPath.c_str());
+			return 1;
+		}
+		SimHashMismatch mismatch;
+		if (expected.FindFirstMismatch(hashLog, mismatch)) {
+			std::printf("determinism: MISMATCH at step %u (%s)\n", mismatch.step, ToString(mismatch.field));
+			exitCode = 3;
+		} else {
+			std::printf("determinism: match (%zu steps)\n", hashLog.GetStepCount());
+		}
+	}
+
+	// 生存している敵の数
+	uint32_t aliveEnemies = 0;
+	for (const SimEnemy& enemy : world.GetEnemies()) {
+		aliveEnemies += enemy.GetIsAlive() ? 1 : 0;
+	}
+	for (const SimChasingEnemy& enemy : world.GetChasingEnemies()) {
+		aliveEnemies += enemy.GetIsAlive() ? 1 : 0;
+	}
+	for (const SimShooterEnemy& enemy : world.GetShooterEnemies()) {
+		aliveEnemies += enemy.GetIsAlive() ? 1 : 0;
+	}
+	uint32_t totalEnemies = static_cast<uint32_t>(world.GetEnemies().size() + world.GetChasingEnemies().size() + world.GetShooterEnemies().size());
+
+	const SimPlayer& player = world.GetPlayer();
+	const SimVector3& position = player.GetTranslation();
+	std::printf("stage %d: %u frames, phase %s\n", stageNo, world.GetFrameCount(), ToString(world.GetPhase()));
+	std::printf("time: %.3f ms (%.0f frames/s)\n", elapsedSeconds * 1000.0, elapsedSeconds > 0.0 ? world.GetFrameCount() / elapsedSeconds : 0.0);
+	std::printf(
+	    "hash: %016llx, %.3f ms (%.2f%% of sim, %.4f%% of a %.1f ms frame)\n", static_cast<unsigned long long>(world.ComputeStateHash().Combined()), hashSeconds * 1000.0,
+	    elapsedSeconds > 0.0 ? hashSeconds / elapsedSeconds * 100.0 : 0.0, world.GetFrameCount() > 0 ? hashSeconds / world.GetFrameCount() / GameTime::kFixedDeltaTime * 100.0 : 0.0,
+	    GameTime::kFixedDeltaTime * 1000.0f);
+	std::printf("player: pos (%.3f, %.3f, %.3f) hp %d alive %d\n", ToFloat(position.x), ToFloat(position.y), ToFloat(position.z), player.GetHp(), player.GetIsAlive() ? 1 : 0);
+	std::printf("enemies: %u / %u alive, resets %u\n", aliveEnemies, totalEnemies, resetCount);
+	std::printf(
+	    "events: jump %u attack %u damage %u enemyDeath %u phaseChanged %u\n", eventCounts[static_cast<size_t>(SimEventType::kPlayerJump)], eventCounts[static_cast<size_t>(SimEventType::kPlayerAttack)],
+	    eventCounts[static_cast<size_t>(SimEventType::kPlayerDamage)], eventCounts[static_cast<size_t>(SimEventType::kEnemyDeath)], eventCounts[static_cast<size_t>(SimEventType::kPhaseChanged)]);
+
+	JobSystem::GetInstance()->Finalize();
+	return exitCode;
+}
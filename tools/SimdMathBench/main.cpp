@@ -0,0 +1,323 @@
+#include "Utils/SimdMath.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+// SimdMath（コンパイル時に選ばれた命令セット）を、TransformUpdater にあったスカラーの式と比べる（速さと、同じ値になるか）
+// 同じソースを SSE / AVX2 / スカラー（SIMD_MATH_FORCE_SCALAR）でビルドして、どれも元の式と一致することを確かめる
+//
+// 使い方: simd_math_bench [--count 要素数=4096] [--steps 繰り返し数=200]
+
+namespace {
+
+// エンジンの Vector3 / Vector4 / Matrix4x4 と同じ並び
+struct Vector3 {
+	float x, y, z;
+};
+struct Vector4 {
+	float x, y, z, w;
+};
+struct Matrix4x4 {
+	float m[4][4];
+};
+
+// --- 置き換える前の実装（TransformUpdater.cpp にあったもの） ---
+
+Vector3 TransformReference(const Vector3& vector, const Matrix4x4& matrix) {
+	Vector3 result;
+	result.x = vector.x * matrix.m[0][0] + vector.y * matrix.m[1][0] + vector.z * matrix.m[2][0] + 1.0f * matrix.m[3][0];
+	result.y = vector.x * matrix.m[0][1] + vector.y * matrix.m[1][1] + vector.z * matrix.m[2][1] + 1.0f * matrix.m[3][1];
+	result.z = vector.x * matrix.m[0][2] + vector.y * matrix.m[1][2] + vector.z * matrix.m[2][2] + 1.0f * matrix.m[3][2];
+	float w = vector.x * matrix.m[0][3] + vector.y * matrix.m[1][3] + vector.z * matrix.m[2][3] + 1.0f * matrix.m[3][3];
+	result.x /= w;
+	result.y /= w;
+	result.z /= w;
+	return result;
+}
+
+Vector3 TransformNormalReference(const Vector3& vector, const Matrix4x4& matrix) {
+	Vector3 result;
+	result.x = vector.x * matrix.m[0][0] + vector.y * matrix.m[1][0] + vector.z * matrix.m[2][0];
+	result.y = vector.x * matrix.m[0][1] + vector.y * matrix.m[1][1] + vector.z * matrix.m[2][1];
+	result.z = vector.x * matrix.m[0][2] + vector.y * matrix.m[1][2] + vector.z * matrix.m[2][2];
+	return result;
+}
+
+Matrix4x4 MultiplyReference(const Matrix4x4& matrix1, const Matrix4x4& matrix2) {
+	Matrix4x4 result = {};
+	for (int i = 0; i < 4; i++) {
+		for (int j = 0; j < 4; j++) {
+			for (int k = 0; k < 4; k++) {
+				result.m[i][j] += matrix1.m[i][k] * matrix2.m[k][j];
+			}
+		}
+	}
+	return result;
+}
+
+Vector3 NormalizeReference(const Vector3& v) {
+	float length = std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
+	if (length != 0.0f) {
+		return {v.x / length, v.y / length, v.z / length};
+	}
+	return v;
+}
+
+Vector3 CrossReference(const Vector3& v1, const Vector3& v2) { return {v1.y * v2.z - v1.z * v2.y, v1.z * v2.x - v1.x * v2.z, v1.x * v2.y - v1.y * v2.x}; }
+
+Matrix4x4 MakeLookAtReference(const Vector3& eye, const Vector3& target, const Vector3& up) {
+	Vector3 zaxis = NormalizeReference({target.x - eye.x, target.y - eye.y, target.z - eye.z});
+	Vector3 xaxis = NormalizeReference(CrossReference(up, zaxis));
+	Vector3 yaxis = CrossReference(zaxis, xaxis);
+	return {
+	    xaxis.x,
+	    yaxis.x,
+	    zaxis.x,
+	    0.0f,
+	    xaxis.y,
+	    yaxis.y,
+	    zaxis.y,
+	    0.0f,
+	    xaxis.z,
+	    yaxis.z,
+	    zaxis.z,
+	    0.0f,
+	    -(eye.x * xaxis.x + eye.y * xaxis.y + eye.z * xaxis.z),
+	    -(eye.x * yaxis.x + eye.y * yaxis.y + eye.z * yaxis.z),
+	    -(eye.x * zaxis.x + eye.y * zaxis.y + eye.z * zaxis.z),
+	    1.0f};
+}
+
+// --- 比較 ---
+
+// 不一致の数と最大誤差（大きい値は相対誤差で見る）
+struct Difference {
+	uint64_t mismatchCount = 0;
+	double maxError = 0.0;
+
+	void Add(const float* a, const float* b, int size) {
+		for (int i = 0; i < size; ++i) {
+			double scale = (std::max)(1.0, std::fabs(static_cast<double>(b[i])));
+			double error = std::fabs(static_cast<double>(a[i]) - b[i]) / scale;
+			mismatchCount += a[i] != b[i] ? 1 : 0;
+			maxError = (std::max)(maxError, error);
+		}
+	}
+};
+
+// 1要素あたりのナノ秒を返す
+template<typename Function>
+double Measure(uint32_t count, uint32_t steps, Function function) {
+	auto startTime = std::chrono::steady_clock::now();
+	for (uint32_t step = 0; step < steps; ++step) {
+		function();
+	}
+	double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime).count();
+	return elapsed / (static_cast<double>(count) * steps);
+}
+
+void Report(const char* name, double referenceTime, double simdTime, const Difference& difference) {
+	std::printf(
+	    "%-16s reference %7.2f ns/op  simd %7.2f ns/op  x%.2f  max error %.3g  mismatches %llu\n", name, referenceTime, simdTime, referenceTime / simdTime,
+	    difference.maxError, static_cast<unsigned long long>(difference.mismatchCount));
+}
+
+// 速さを計っていないもの（元の実装と同じ式で、呼ばれる回数も少ない）は一致だけを表示する
+void ReportAccuracy(const char* name, const Difference& difference) {
+	std::printf("%-16s max error %.3g  mismatches %llu\n", name, difference.maxError, static_cast<unsigned long long>(difference.mismatchCount));
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	uint32_t count = 4096;
+	uint32_t steps = 200;
+
+	for (int i = 1; i < argc; ++i) {
+		if (i + 1 >= argc) {
+			std::fprintf(stderr, "usage: %s [--count N] [--steps N]\n", argv[0]);
+			return 2;
+		}
+		if (std::strcmp(argv[i], "--count") == 0) {
+			count = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else if (std::strcmp(argv[i], "--steps") == 0) {
+			steps = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else {
+			std::fprintf(stderr, "unknown option %s\n", argv[i]);
+			return 2;
+		}
+	}
+
+	// 足し算・掛け算の順番は元の式と同じなので、実際には一致する
+	const double kTolerance = 1.0e-6;
+
+	std::mt19937 random(12345);
+	std::uniform_real_distribution<float> value(-4.0f, 4.0f);
+	std::uniform_real_distribution<float> position(-400.0f, 400.0f);
+
+	// 入力（行列はアフィン変換になるよう4列目を 0,0,0,1 にする）
+	std::vector<Vector3> points(count);
+	std::vector<Vector4> vectors(count);
+	std::vector<Matrix4x4> matricesA(count), matricesB(count);
+	for (uint32_t i = 0; i < count; ++i) {
+		points[i] = {position(random), position(random), position(random)};
+		vectors[i] = {value(random), value(random), value(random), value(random)};
+		for (Matrix4x4* matrix : {&matricesA[i], &matricesB[i]}) {
+			for (int row = 0; row < 4; ++row) {
+				for (int column = 0; column < 4; ++column) {
+					matrix->m[row][column] = column == 3 ? (row == 3 ? 1.0f : 0.0f) : (row == 3 ? position(random) : value(random));
+				}
+			}
+		}
+	}
+	const Matrix4x4& matrix = matricesA[0];
+
+	std::vector<Vector3> referencePoints(count), simdPoints(count);
+	std::vector<Matrix4x4> referenceMatrices(count), simdMatrices(count);
+	double worstError = 0.0;
+	float checksum = 0.0f;
+
+	std::printf("instruction set: %s\n", SimdMath::kInstructionSet);
+
+	// --- 点の変換（1つずつ） ---
+	{
+		Difference difference;
+		for (uint32_t i = 0; i < count; ++i) {
+			Vector3 reference = TransformReference(points[i], matrix);
+			Vector3 result = SimdMath::Transform(points[i], matrix);
+			difference.Add(&result.x, &reference.x, 3);
+		}
+		double referenceTime = Measure(count, steps, [&]() {
+			for (uint32_t i = 0; i < count; ++i) {
+				referencePoints[i] = TransformReference(points[i], matrix);
+			}
+		});
+		double simdTime = Measure(count, steps, [&]() {
+			for (uint32_t i = 0; i < count; ++i) {
+				simdPoints[i] = SimdMath::Transform(points[i], matrix);
+			}
+		});
+		Report("Transform", referenceTime, simdTime, difference);
+		worstError = (std::max)(worstError, difference.maxError);
+	}
+
+	// --- 点の変換（配列をまとめて） ---
+	{
+		Difference difference;
+		SimdMath::TransformPoints(points.data(), simdPoints.data(), count, matrix);
+		for (uint32_t i = 0; i < count; ++i) {
+			Vector3 reference = TransformReference(points[i], matrix);
+			difference.Add(&simdPoints[i].x, &reference.x, 3);
+		}
+		double referenceTime = Measure(count, steps, [&]() {
+			for (uint32_t i = 0; i < count; ++i) {
+				referencePoints[i] = TransformReference(points[i], matrix);
+			}
+		});
+		double simdTime = Measure(count, steps, [&]() { SimdMath::TransformPoints(points.data(), simdPoints.data(), count, matrix); });
+		Report("TransformPoints", referenceTime, simdTime, difference);
+		worstError = (std::max)(worstError, difference.maxError);
+		checksum += referencePoints[count - 1].x + simdPoints[count - 1].x;
+	}
+
+	// --- 方向の変換 ---
+	{
+		Difference difference;
+		for (uint32_t i = 0; i < count; ++i) {
+			Vector3 reference = TransformNormalReference(points[i], matrix);
+			Vector3 result = SimdMath::TransformNormal(points[i], matrix);
+			difference.Add(&result.x, &reference.x, 3);
+		}
+		double referenceTime = Measure(count, steps, [&]() {
+			for (uint32_t i = 0; i < count; ++i) {
+				referencePoints[i] = TransformNormalReference(points[i], matrix);
+			}
+		});
+		double simdTime = Measure(count, steps, [&]() {
+			for (uint32_t i = 0; i < count; ++i) {
+				simdPoints[i] = SimdMath::TransformNormal(points[i], matrix);
+			}
+		});
+		Report("TransformNormal", referenceTime, simdTime, difference);
+		worstError = (std::max)(worstError, difference.maxError);
+		checksum += referencePoints[count - 1].x + simdPoints[count - 1].x;
+	}
+
+	// --- 4成分のベクトルの変換（元の実装は無いので、行列の1行として掛け算と比べる） ---
+	{
+		Difference difference;
+		for (uint32_t i = 0; i < count; ++i) {
+			Matrix4x4 row = {};
+			std::memcpy(row.m[0], &vectors[i].x, sizeof(float) * 4);
+			Matrix4x4 reference = MultiplyReference(row, matrix);
+			Vector4 result = SimdMath::Transform4(vectors[i], matrix);
+			difference.Add(&result.x, reference.m[0], 4);
+		}
+		ReportAccuracy("Transform4", difference);
+		worstError = (std::max)(worstError, difference.maxError);
+	}
+
+	// --- 行列の積（1つずつ・配列をまとめて・同じ行列を掛ける） ---
+	{
+		Difference single, batch, broadcast;
+		SimdMath::MultiplyMatrices(matricesA.data(), matricesB.data(), simdMatrices.data(), count);
+		for (uint32_t i = 0; i < count; ++i) {
+			Matrix4x4 reference = MultiplyReference(matricesA[i], matricesB[i]);
+			Matrix4x4 result = SimdMath::Multiply(matricesA[i], matricesB[i]);
+			single.Add(&result.m[0][0], &reference.m[0][0], 16);
+			batch.Add(&simdMatrices[i].m[0][0], &reference.m[0][0], 16);
+		}
+		SimdMath::MultiplyMatrices(matricesA.data(), matrix, simdMatrices.data(), count);
+		for (uint32_t i = 0; i < count; ++i) {
+			Matrix4x4 reference = MultiplyReference(matricesA[i], matrix);
+			broadcast.Add(&simdMatrices[i].m[0][0], &reference.m[0][0], 16);
+		}
+
+		double referenceTime = Measure(count, steps, [&]() {
+			for (uint32_t i = 0; i < count; ++i) {
+				referenceMatrices[i] = MultiplyReference(matricesA[i], matricesB[i]);
+			}
+		});
+		double singleTime = Measure(count, steps, [&]() {
+			for (uint32_t i = 0; i < count; ++i) {
+				simdMatrices[i] = SimdMath::Multiply(matricesA[i], matricesB[i]);
+			}
+		});
+		double batchTime = Measure(count, steps, [&]() { SimdMath::MultiplyMatrices(matricesA.data(), matricesB.data(), simdMatrices.data(), count); });
+		double broadcastTime = Measure(count, steps, [&]() { SimdMath::MultiplyMatrices(matricesA.data(), matrix, simdMatrices.data(), count); });
+		Report("Multiply", referenceTime, singleTime, single);
+		Report("MultiplyMatrices", referenceTime, batchTime, batch);
+		Report("Multiply(a[],b)", referenceTime, broadcastTime, broadcast);
+		worstError = (std::max)({worstError, single.maxError, batch.maxError, broadcast.maxError});
+		checksum += referenceMatrices[count - 1].m[3][0] + simdMatrices[count - 1].m[3][0];
+	}
+
+	// --- 正規化・LookAt ---
+	{
+		Difference normalize, lookAt;
+		for (uint32_t i = 0; i + 1 < count; ++i) {
+			Vector3 reference = NormalizeReference(points[i]);
+			Vector3 result = SimdMath::Normalize(points[i]);
+			normalize.Add(&result.x, &reference.x, 3);
+
+			Matrix4x4 referenceLookAt = MakeLookAtReference(points[i], points[i + 1], {0.0f, 1.0f, 0.0f});
+			Matrix4x4 resultLookAt = SimdMath::MakeLookAt<Matrix4x4>(points[i], points[i + 1], Vector3{0.0f, 1.0f, 0.0f});
+			lookAt.Add(&resultLookAt.m[0][0], &referenceLookAt.m[0][0], 16);
+		}
+		ReportAccuracy("Normalize", normalize);
+		ReportAccuracy("MakeLookAt", lookAt);
+		worstError = (std::max)({worstError, normalize.maxError, lookAt.maxError});
+	}
+
+	bool isPassed = worstError <= kTolerance;
+	std::printf(
+	    "%u elements x %u steps, max error %.3g (tolerance %.1g) %s, checksum %.6g\n", count, steps, worstError, kTolerance, isPassed ? "PASS" : "FAIL",
+	    static_cast<double>(checksum));
+	return isPassed ? 0 : 1;
+}
@@ -0,0 +1,241 @@
+#include "Render/SpriteBatch.h"
+#include "Render/UiAtlasTable.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <random>
+#include <vector>
+
+// SpriteBatch（画面上の四角形をテクスチャごとにまとめる）を確かめる
+// ・重なり: 重なる2つの四角形は、加えた順に描かれるか（並べ替えで見た目が変わらないか）
+// ・範囲: 描画の範囲が四角形を隙間なく覆い、範囲の中のテクスチャが1つか
+// ・頂点: 頂点配列が並べ替えた後の四角形と同じ位置・UV・色か
+// ・量: GameScene の1フレーム（フェード・ステージ番号・キー表示・ハート・ポーズ）と乱数のフレームで、描画の数がどれだけ減るか（表示するだけ）
+// ・アトラス: 同じフレームを UiAtlas の領域で描くと1回の描画になり、UV が領域と一致するか
+//
+// 使い方: sprite_batch_bench [--frames 乱数のフレームの数=2000] [--quads 1フレームの最大の四角形の数=64]
+
+namespace {
+
+bool Overlaps(const SpriteBatch::Quad& a, const SpriteBatch::Quad& b) {
+	return a.left < b.left + b.width && b.left < a.left + a.width && a.top < b.top + b.height && b.top < a.top + a.height;
+}
+
+// Build 後の内容を確かめ、見つかった誤りの数を返す
+uint32_t Verify(const SpriteBatch& batch) {
+	uint32_t errorCount = 0;
+	const std::vector<SpriteBatch::Quad>& quads = batch.GetQuads();
+
+	// 重なる組は加えた順のまま
+	for (size_t i = 0; i < quads.size(); ++i) {
+		for (size_t j = i + 1; j < quads.size(); ++j) {
+			if (Overlaps(quads[i], quads[j]) && quads[i].sequence > quads[j].sequence) {
+				++errorCount;
+			}
+		}
+	}
+
+	// 範囲は先頭から隙間なく続き、中のテクスチャは1つ。隣の範囲とはテクスチャが違う
+	uint32_t nextQuad = 0;
+	const std::vector<SpriteBatch::DrawRange>& ranges = batch.GetRanges();
+	for (size_t r = 0; r < ranges.size(); ++r) {
+		const SpriteBatch::DrawRange& range = ranges[r];
+		errorCount += range.firstQuad != nextQuad || range.quadCount == 0 ? 1 : 0;
+		errorCount += r > 0 && ranges[r - 1].textureHandle == range.textureHandle ? 1 : 0;
+		for (uint32_t i = range.firstQuad; i < range.firstQuad + range.quadCount && i < quads.size(); ++i) {
+			errorCount += quads[i].textureHandle != range.textureHandle ? 1 : 0;
+		}
+		nextQuad = range.firstQuad + range.quadCount;
+	}
+	errorCount += nextQuad != quads.size() ? 1 : 0;
+
+	// 頂点は 左上・右上・左下・右下
+	const std::vector<SpriteBatch::Vertex>& vertices = batch.GetVertices();
+	if (vertices.size() != quads.size() * SpriteBatch::kVerticesPerQuad) {
+		return errorCount + 1;
+	}
+	for (size_t i = 0; i < quads.size(); ++i) {
+		const SpriteBatch::Quad& quad = quads[i];
+		const SpriteBatch::Vertex* corner = &vertices[i * SpriteBatch::kVerticesPerQuad];
+		const float expected[4][4] = {
+		    {quad.left, quad.top, quad.texcoord.left, quad.texcoord.top},
+		    {quad.left + quad.width, quad.top, quad.texcoord.right, quad.texcoord.top},
+		    {quad.left, quad.top + quad.height, quad.texcoord.left, quad.texcoord.bottom},
+		    {quad.left + quad.width, quad.top + quad.height, quad.texcoord.right, quad.texcoord.bottom},
+		};
+		for (int c = 0; c < 4; ++c) {
+			bool isSame = corner[c].position[0] == expected[c][0] && corner[c].position[1] == expected[c][1] && corner[c].texcoord[0] == expected[c][2] &&
+			              corner[c].texcoord[1] == expected[c][3] && corner[c].color[0] == quad.color.r && corner[c].color[3] == quad.color.a;
+			errorCount += isSame ? 0 : 1;
+		}
+	}
+	return errorCount;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	uint32_t frameCount = 2000;
+	uint32_t maxQuadCount = 64;
+
+	for (int i = 1; i < argc; ++i) {
+		if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+			frameCount = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else if (std::strcmp(argv[i], "--quads") == 0 && i + 1 < argc) {
+			maxQuadCount = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else {
+			std::fprintf(stderr, "usage: %s [--frames N] [--quads N]\n", argv[0]);
+			return 2;
+		}
+	}
+	if (maxQuadCount == 0 || maxQuadCount > 16384) {
+		std::fprintf(stderr, "--quads must be 1 ～ 16384\n");
+		return 2;
+	}
+
+	bool isPassed = true;
+	SpriteBatch batch;
+
+	// GameScene の BuildSnapshot と同じ順・位置・大きさ（テクスチャの番号は仮のもの）
+	{
+		enum : uint32_t { kWhite = 1, kStageText, kNumber1, kKeyJ, kKeySpace, kKeyEsc, kHeart, kPause, kArrow };
+		const SpriteBatch::Color white = {1.0f, 1.0f, 1.0f, 1.0f};
+		const SpriteBatch::Color black = {0.0f, 0.0f, 0.0f, 1.0f};
+		batch.Clear();
+		// フェード・ステージ番号
+		batch.Add(kWhite, 0.0f, 0.0f, 1280.0f, 720.0f, {0.0f, 0.0f, 0.0f, 0.5f});
+		batch.Add(kStageText, 400.0f, 300.0f, 384.0f, 64.0f, white);
+		batch.Add(kNumber1, 740.0f, 300.0f, 64.0f, 64.0f, white);
+		// キー表示
+		batch.Add(kKeyJ, 64.0f, 600.0f, 64.0f, 64.0f, white);
+		batch.Add(kKeySpace, 192.0f, 600.0f, 224.0f, 64.0f, white);
+		batch.Add(kKeyEsc, 64.0f, 128.0f, 144.0f, 64.0f, white);
+		// ハート（黒い背景の上に赤いハート）
+		for (int i = 0; i < 3; ++i) {
+			float x = 64.0f + static_cast<float>(i) * 60.0f;
+			batch.Add(kHeart, x, 50.0f, 50.0f, 50.0f, black);
+			batch.Add(kHeart, x + 5.0f, 55.0f, 40.0f, 40.0f, white);
+		}
+		// ポーズ
+		batch.Add(kWhite, 0.0f, 0.0f, 1280.0f, 720.0f, {0.0f, 0.0f, 0.0f, 0.8f});
+		batch.Add(kPause, 256.0f, 144.0f, 768.0f, 432.0f, white);
+		batch.Add(kArrow, 350.0f, 370.0f, 80.0f, 32.0f, white);
+		batch.Build();
+
+		uint32_t errorCount = Verify(batch);
+		std::printf("game scene frame: %zu quads -> %zu draws (%u layers)  errors %u\n", batch.GetQuadCount(), batch.GetRanges().size(), batch.GetLayerCount(),
+		            errorCount);
+		isPassed &= errorCount == 0;
+		// 6つのハートは1回の描画にまとまる
+		for (const SpriteBatch::DrawRange& range : batch.GetRanges()) {
+			if (range.textureHandle == kHeart && range.quadCount != 6) {
+				std::printf("hearts were split into several draws\n");
+				isPassed = false;
+			}
+		}
+	}
+
+	// 同じフレームを UiAtlas の領域で描く（UiAtlas::Get と同じ値を表から作る）
+	{
+		using Region = UiAtlasTable::Region;
+		const uint32_t kAtlasTexture = 100;
+		auto get = [&](Region region) {
+			const UiAtlasTable::Entry& entry = UiAtlasTable::kEntries[static_cast<size_t>(region)];
+			return SpriteBatch::TextureRegion{kAtlasTexture,
+			                                  static_cast<float>(UiAtlasTable::kWidth),
+			                                  static_cast<float>(UiAtlasTable::kHeight),
+			                                  static_cast<float>(entry.x),
+			                                  static_cast<float>(entry.y),
+			                                  static_cast<float>(entry.width),
+			                                  static_cast<float>(entry.height)};
+		};
+		const SpriteBatch::Color white = {1.0f, 1.0f, 1.0f, 1.0f};
+		const SpriteBatch::Color black = {0.0f, 0.0f, 0.0f, 1.0f};
+		batch.Clear();
+		batch.Add(get(Region::kWhite), 0.0f, 0.0f, 1280.0f, 720.0f, {0.0f, 0.0f, 0.0f, 0.5f});
+		batch.Add(get(Region::kStageText), 400.0f, 300.0f, 384.0f, 64.0f, white);
+		batch.Add(get(Region::kNumber1), 740.0f, 300.0f, 64.0f, 64.0f, white);
+		batch.Add(get(Region::kKeyJ), 64.0f, 600.0f, 64.0f, 64.0f, white);
+		batch.Add(get(Region::kKeySpace), 192.0f, 600.0f, 224.0f, 64.0f, white);
+		batch.Add(get(Region::kKeyEsc), 64.0f, 128.0f, 144.0f, 64.0f, white);
+		for (int i = 0; i < 3; ++i) {
+			float x = 64.0f + static_cast<float>(i) * 60.0f;
+			batch.Add(get(Region::kHeart), x, 50.0f, 50.0f, 50.0f, black);
+			batch.Add(get(Region::kHeart), x + 5.0f, 55.0f, 40.0f, 40.0f, white);
+		}
+		batch.Add(get(Region::kWhite), 0.0f, 0.0f, 1280.0f, 720.0f, {0.0f, 0.0f, 0.0f, 0.8f});
+		batch.Add(get(Region::kPause), 256.0f, 144.0f, 768.0f, 432.0f, white);
+		batch.Add(get(Region::kArrow), 350.0f, 370.0f, 80.0f, 32.0f, white);
+		batch.Build();
+
+		uint32_t errorCount = Verify(batch);
+		// 並べ替えても加えた順のまま（1つのテクスチャなので）で、UV は領域をアトラスの大きさで割ったもの
+		const Region kOrder[] = {Region::kWhite, Region::kStageText, Region::kNumber1, Region::kKeyJ, Region::kKeySpace, Region::kKeyEsc, Region::kHeart,
+		                         Region::kHeart,  Region::kHeart,     Region::kHeart,   Region::kHeart, Region::kHeart,    Region::kWhite, Region::kPause,
+		                         Region::kArrow};
+		for (size_t i = 0; i < batch.GetQuadCount() && i < std::size(kOrder); ++i) {
+			const SpriteBatch::Quad& quad = batch.GetQuads()[i];
+			SpriteBatch::TextureRegion region = get(kOrder[i]);
+			bool isSame = quad.texcoord.left * region.textureWidth == region.x && quad.texcoord.top * region.textureHeight == region.y &&
+			              quad.texcoord.right * region.textureWidth == region.x + region.width &&
+			              quad.texcoord.bottom * region.textureHeight == region.y + region.height && quad.textureWidth == region.textureWidth;
+			errorCount += isSame ? 0 : 1;
+		}
+		std::printf("game scene frame (atlas): %zu quads -> %zu draws  errors %u\n", batch.GetQuadCount(), batch.GetRanges().size(), errorCount);
+		isPassed &= errorCount == 0 && batch.GetRanges().size() == 1;
+	}
+
+	// インデックスは四角形ごとに 0,1,2 / 2,1,3
+	{
+		std::vector<uint16_t> indices;
+		SpriteBatch::BuildIndices(3, indices);
+		const uint16_t expected[] = {0, 1, 2, 2, 1, 3, 4, 5, 6, 6, 5, 7, 8, 9, 10, 10, 9, 11};
+		bool isSame = indices.size() == sizeof(expected) / sizeof(expected[0]) && std::memcmp(indices.data(), expected, sizeof(expected)) == 0;
+		std::printf("indices: %s\n", isSame ? "ok" : "mismatch");
+		isPassed &= isSame;
+	}
+
+	// 乱数のフレーム（テクスチャ 12 種類、画面内のいろいろな大きさの四角形）
+	std::mt19937 random(12345);
+	std::uniform_int_distribution<uint32_t> quadCountRoll(1, maxQuadCount);
+	std::uniform_int_distribution<uint32_t> textureRoll(1, 12);
+	std::uniform_real_distribution<float> xRoll(0.0f, 1280.0f);
+	std::uniform_real_distribution<float> yRoll(0.0f, 720.0f);
+	std::uniform_real_distribution<float> sizeRoll(8.0f, 320.0f);
+	std::uniform_real_distribution<float> colorRoll(0.0f, 1.0f);
+
+	uint64_t totalQuads = 0;
+	uint64_t totalRanges = 0;
+	uint64_t totalErrors = 0;
+	double buildNanoseconds = 0.0;
+	for (uint32_t frame = 0; frame < frameCount; ++frame) {
+		batch.Clear();
+		uint32_t quadCount = quadCountRoll(random);
+		for (uint32_t i = 0; i < quadCount; ++i) {
+			float u = colorRoll(random) * 0.5f;
+			float v = colorRoll(random) * 0.5f;
+			batch.Add(textureRoll(random), xRoll(random), yRoll(random), sizeRoll(random), sizeRoll(random), {colorRoll(random), 1.0f, 1.0f, colorRoll(random)},
+			          {u, v, u + 0.5f, v + 0.5f});
+		}
+
+		auto startTime = std::chrono::steady_clock::now();
+		batch.Build();
+		buildNanoseconds += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime).count();
+
+		totalQuads += batch.GetQuadCount();
+		totalRanges += batch.GetRanges().size();
+		totalErrors += Verify(batch);
+	}
+	if (frameCount > 0) {
+		std::printf("random frames %u: %.1f quads -> %.1f draws per frame  errors %llu  %.0f ns/quad\n", frameCount,
+		            static_cast<double>(totalQuads) / frameCount, static_cast<double>(totalRanges) / frameCount, static_cast<unsigned long long>(totalErrors),
+		            totalQuads > 0 ? buildNanoseconds / static_cast<double>(totalQuads) : 0.0);
+	}
+	isPassed &= totalErrors == 0;
+
+	std::printf("%s\n", isPassed ? "PASS" : "FAIL");
+	return isPassed ? 0 : 1;
+}
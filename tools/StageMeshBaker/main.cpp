@@ -0,0 +1,217 @@
+#include "System/MapChipField.h"
+#include "System/StageMesh.h"
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// ステージのメッシュを作り、頂点数・三角形数をブロック1個ずつ描く場合（1個 24頂点・12三角形）と比べる
+// 作ったメッシュは次のことを確かめる
+// ・三角形の向き: 頂点の並び（時計回り）から求めた向きが、頂点の法線と同じか
+// ・面の量: 面をまとめても、向きごとの面積の合計が変わらないか
+// ・保存: バイト列にして読み直すと同じ中身になるか、壊れたデータを読まないか
+// ・キャッシュ: 2回目は保存したものを使い、違うマップでは作り直すか
+//
+// 使い方: stage_mesh_baker [--root リソースのルート=.] [--out キャッシュを書き出すフォルダ] [ステージ番号...（省略時は 1 ～ 10）]
+//   --out を付けたときだけ、各ステージの .mesh をそのフォルダに保存する（ソースの中には書かない）
+
+namespace {
+
+// ブロック1個を立方体で描くときの数
+const size_t kCubeVertexCount = 24;
+const size_t kCubeTriangleCount = 12;
+
+const uint32_t kFaceCount = 6;
+
+// 法線から面の番号（-Z, +Z, +X, -X, +Y, -Y）
+int FaceIndexOf(const float normal[3]) {
+	const float kDirections[kFaceCount][3] = {{0, 0, -1}, {0, 0, 1}, {1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}};
+	for (uint32_t i = 0; i < kFaceCount; ++i) {
+		if (normal[0] == kDirections[i][0] && normal[1] == kDirections[i][1] && normal[2] == kDirections[i][2]) {
+			return static_cast<int>(i);
+		}
+	}
+	return -1;
+}
+
+// 三角形の向きを確かめながら、向きごとの面積を足す。おかしな三角形の数を返す
+uint64_t SumFaceAreas(const StageMesh& mesh, double (&outAreas)[kFaceCount]) {
+	for (double& area : outAreas) {
+		area = 0.0;
+	}
+	uint64_t errorCount = 0;
+	for (const StageMesh::Chunk& chunk : mesh.GetChunks()) {
+		for (size_t i = 0; i + 2 < chunk.indices.size(); i += 3) {
+			const StageMesh::Vertex& v0 = chunk.vertices[chunk.indices[i]];
+			const StageMesh::Vertex& v1 = chunk.vertices[chunk.indices[i + 1]];
+			const StageMesh::Vertex& v2 = chunk.vertices[chunk.indices[i + 2]];
+			double e1[3];
+			double e2[3];
+			for (int axis = 0; axis < 3; ++axis) {
+				e1[axis] = static_cast<double>(v1.position[axis]) - v0.position[axis];
+				e2[axis] = static_cast<double>(v2.position[axis]) - v0.position[axis];
+			}
+			double cross[3] = {e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0]};
+			double length = std::sqrt(cross[0] * cross[0] + cross[1] * cross[1] + cross[2] * cross[2]);
+			int face = FaceIndexOf(v0.normal);
+			if (face < 0 || length <= 0.0) {
+				++errorCount;
+				continue;
+			}
+			// 時計回り（左手系）なら cross は法線と同じ向き
+			double dot = (cross[0] * v0.normal[0] + cross[1] * v0.normal[1] + cross[2] * v0.normal[2]) / length;
+			if (dot < 0.999) {
+				++errorCount;
+			}
+			outAreas[face] += length / 2.0;
+		}
+	}
+	return errorCount;
+}
+
+bool IsSameMesh(const StageMesh& a, const StageMesh& b) {
+	if (a.GetSourceHash() != b.GetSourceHash() || a.GetChunks().size() != b.GetChunks().size()) {
+		return false;
+	}
+	for (size_t i = 0; i < a.GetChunks().size(); ++i) {
+		const StageMesh::Chunk& chunkA = a.GetChunks()[i];
+		const StageMesh::Chunk& chunkB = b.GetChunks()[i];
+		if (chunkA.firstColumn != chunkB.firstColumn || chunkA.columnCount != chunkB.columnCount || chunkA.indices != chunkB.indices ||
+		    chunkA.vertices.size() != chunkB.vertices.size()) {
+			return false;
+		}
+		if (!chunkA.vertices.empty() && std::memcmp(chunkA.vertices.data(), chunkB.vertices.data(), chunkA.vertices.size() * sizeof(StageMesh::Vertex)) != 0) {
+			return false;
+		}
+	}
+	return true;
+}
+
+uint32_t CountBlocks(const MapChipField& mapChipField) {
+	uint32_t count = 0;
+	for (uint32_t row = 0; row < mapChipField.GetNumBlockVertical(); ++row) {
+		for (uint32_t column = 0; column < mapChipField.GetNumBlockHorizontal(); ++column) {
+			count += mapChipField.GetMapChipTypeByIndex(column, row) == MapChipType::kBlock ? 1 : 0;
+		}
+	}
+	return count;
+}
+
+bool Check(bool condition, int stageNo, const char* message) {
+	if (!condition) {
+		std::printf("stage%d: NG %s\n", stageNo, message);
+	}
+	return condition;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	std::string resourceRoot = ".";
+	std::string outDirectory;
+	std::vector<int> stageNos;
+
+	for (int i = 1; i < argc; ++i) {
+		if (std::strcmp(argv[i], "--root") == 0 && i + 1 < argc) {
+			resourceRoot = argv[++i];
+		} else if (std::strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+			outDirectory = argv[++i];
+		} else if (argv[i][0] != '-') {
+			stageNos.push_back(std::atoi(argv[i]));
+		} else {
+			std::fprintf(stderr, "usage: %s [--root DIR] [--out DIR] [stage...]\n", argv[0]);
+			return 2;
+		}
+	}
+	if (stageNos.empty()) {
+		for (int stageNo = 1; stageNo <= 10; ++stageNo) {
+			stageNos.push_back(stageNo);
+		}
+	}
+
+	bool isPassed = true;
+	size_t totalCubeVertexCount = 0;
+	size_t totalCubeTriangleCount = 0;
+	size_t totalVertexCount = 0;
+	size_t totalTriangleCount = 0;
+
+	MapChipField previousField;
+	bool hasPreviousField = false;
+
+	for (int stageNo : stageNos) {
+		std::string stageFileName = "stage" + std::to_string(stageNo) + ".csv";
+		MapChipField mapChipField;
+		mapChipField.LoadMapChipCsv(resourceRoot + "/Resources/stage/" + stageFileName);
+		uint32_t blockCount = CountBlocks(mapChipField);
+
+		// 面を消さない・まとめないもの（ブロック1個ずつ描くのと同じ量）、面を消すだけのもの、両方するもの
+		StageMesh naiveMesh;
+		naiveMesh.Bake(mapChipField, {false, false});
+		StageMesh culledMesh;
+		culledMesh.Bake(mapChipField, {true, false});
+		StageMesh mesh;
+		auto startTime = std::chrono::steady_clock::now();
+		mesh.Bake(mapChipField);
+		double bakeMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+		isPassed &= Check(naiveMesh.GetVertexCount() == blockCount * kCubeVertexCount, stageNo, "naive vertex count differs from 24 per block");
+		isPassed &= Check(naiveMesh.GetTriangleCount() == blockCount * kCubeTriangleCount, stageNo, "naive triangle count differs from 12 per block");
+
+		// 向きと面積（消すだけのものとまとめたものは、向きごとの面積が同じになる）
+		double culledAreas[kFaceCount];
+		double mergedAreas[kFaceCount];
+		double naiveAreas[kFaceCount];
+		isPassed &= Check(SumFaceAreas(naiveMesh, naiveAreas) == 0, stageNo, "naive mesh has misoriented triangles");
+		isPassed &= Check(SumFaceAreas(culledMesh, culledAreas) == 0, stageNo, "culled mesh has misoriented triangles");
+		isPassed &= Check(SumFaceAreas(mesh, mergedAreas) == 0, stageNo, "merged mesh has misoriented triangles");
+		for (uint32_t face = 0; face < kFaceCount; ++face) {
+			isPassed &= Check(std::fabs(culledAreas[face] - mergedAreas[face]) < 1.0e-3, stageNo, "merged area differs from culled area");
+			isPassed &= Check(culledAreas[face] <= naiveAreas[face] + 1.0e-3, stageNo, "culled area exceeds naive area");
+		}
+
+		// バイト列にして戻す。途中で切れたものは読まない
+		std::vector<uint8_t> bytes = mesh.Serialize();
+		StageMesh loadedMesh;
+		isPassed &= Check(loadedMesh.Deserialize(bytes) && IsSameMesh(mesh, loadedMesh), stageNo, "serialize round trip failed");
+		std::vector<uint8_t> truncatedBytes(bytes.begin(), bytes.end() - 1);
+		isPassed &= Check(!loadedMesh.Deserialize(truncatedBytes) && loadedMesh.GetChunks().empty(), stageNo, "truncated data was accepted");
+
+		// キャッシュ（1回目は作る、2回目は読む、前のステージのマップで読むと作り直す）
+		if (!outDirectory.empty()) {
+			std::string stageFilePath = outDirectory + "/" + stageFileName;
+			std::remove(StageMesh::GetCachePath(stageFilePath).c_str());
+			StageMesh cachedMesh;
+			isPassed &= Check(!cachedMesh.LoadOrBake(stageFilePath, mapChipField), stageNo, "cache was used before it was written");
+			isPassed &= Check(cachedMesh.LoadOrBake(stageFilePath, mapChipField) && IsSameMesh(mesh, cachedMesh), stageNo, "written cache was not used");
+			if (hasPreviousField && StageMesh::ComputeSourceHash(previousField, {}) != mesh.GetSourceHash()) {
+				StageMesh staleMesh;
+				isPassed &= Check(!staleMesh.LoadOrBake(stageFilePath, previousField), stageNo, "stale cache was used");
+				// 元に戻しておく
+				cachedMesh.LoadOrBake(stageFilePath, mapChipField);
+			}
+		}
+		previousField = mapChipField;
+		hasPreviousField = true;
+
+		std::printf(
+		    "stage%-2d blocks %4u  cubes %6zu verts %6zu tris  culled %6zu verts %6zu tris  baked %5zu verts %5zu tris (%zu chunks, x%.1f fewer tris) %.2f ms %zu bytes\n",
+		    stageNo, blockCount, naiveMesh.GetVertexCount(), naiveMesh.GetTriangleCount(), culledMesh.GetVertexCount(), culledMesh.GetTriangleCount(),
+		    mesh.GetVertexCount(), mesh.GetTriangleCount(), mesh.GetChunks().size(),
+		    mesh.GetTriangleCount() > 0 ? static_cast<double>(naiveMesh.GetTriangleCount()) / static_cast<double>(mesh.GetTriangleCount()) : 0.0, bakeMilliseconds,
+		    bytes.size());
+
+		totalCubeVertexCount += naiveMesh.GetVertexCount();
+		totalCubeTriangleCount += naiveMesh.GetTriangleCount();
+		totalVertexCount += mesh.GetVertexCount();
+		totalTriangleCount += mesh.GetTriangleCount();
+	}
+
+	std::printf(
+	    "total cubes %zu verts %zu tris  baked %zu verts %zu tris %s\n", totalCubeVertexCount, totalCubeTriangleCount, totalVertexCount, totalTriangleCount,
+	    isPassed ? "PASS" : "FAIL");
+	return isPassed ? 0 : 1;
+}
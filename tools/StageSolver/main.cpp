@@ -0,0 +1,119 @@
+#include "Sim/SimStageSolver.h"
+#include "Sim/SimWorld.h"
+#include "System/JobSystem.h"
+#include "System/MapChipField.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// ステージがクリアできるかを入力列の探索で確かめる（ステージを編集したときの確認用）
+//
+// 使い方: stage_solver [--root リソースのルート=.] [--beam 幅=256] [--macro 1手のフレーム数=6] [--max-frames 最大フレーム数=7200]
+//                     [--threads N] [--out 出力フォルダ] [ステージ番号...]
+//   ステージ番号を省略すると 1〜10 を順に調べる
+//   --out を付けると、クリアできたステージは stageN_clear.rep、できなかったステージは stageN_furthest.rep を保存する
+//   クリアできないステージがあれば終了コード 4 を返す
+
+namespace {
+
+/// <summary>
+/// 状態の複製（SimWorld のコピー代入）にかかる時間を計る
+/// </summary>
+double MeasureCloneNanoseconds(const MapChipField* mapChipField, int stageNo) {
+	SimWorld source;
+	source.Initialize(mapChipField, stageNo);
+	// 確保済みの領域へ代入する（探索中と同じ条件）
+	SimWorld destination = source;
+
+	const uint32_t kIterations = 10000;
+	auto startTime = std::chrono::steady_clock::now();
+	for (uint32_t i = 0; i < kIterations; ++i) {
+		destination = source;
+	}
+	double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime).count();
+	return elapsed / kIterations;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	std::string resourceRoot = ".";
+	std::string outputDirectory;
+	uint32_t threadCount = 0;
+	SimStageSolver::Settings settings;
+	std::vector<int> stageNumbers;
+
+	for (int i = 1; i < argc; ++i) {
+		bool hasValue = i + 1 < argc;
+		if (std::strcmp(argv[i], "--root") == 0 && hasValue) {
+			resourceRoot = argv[++i];
+		} else if (std::strcmp(argv[i], "--beam") == 0 && hasValue) {
+			settings.beamWidth = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else if (std::strcmp(argv[i], "--macro") == 0 && hasValue) {
+			settings.macroFrames = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else if (std::strcmp(argv[i], "--max-frames") == 0 && hasValue) {
+			settings.maxFrames = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else if (std::strcmp(argv[i], "--threads") == 0 && hasValue) {
+			threadCount = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else if (std::strcmp(argv[i], "--out") == 0 && hasValue) {
+			outputDirectory = argv[++i];
+		} else if (argv[i][0] != '-') {
+			stageNumbers.push_back(std::atoi(argv[i]));
+		} else {
+			std::fprintf(stderr, "usage: %s [--root resourceRoot] [--beam N] [--macro N] [--max-frames N] [--threads N] [--out dir] [stageNo...]\n", argv[0]);
+			return 2;
+		}
+	}
+	if (stageNumbers.empty()) {
+		for (int stageNo = 1; stageNo <= 10; ++stageNo) {
+			stageNumbers.push_back(stageNo);
+		}
+	}
+
+	JobSystem* jobSystem = JobSystem::GetInstance();
+	jobSystem->Initialize(threadCount > 0 ? threadCount - 1 : UINT32_MAX);
+
+	int exitCode = 0;
+	for (int stageNo : stageNumbers) {
+		MapChipField mapChipField;
+		std::string mapFileName = resourceRoot + "/Resources/stage/stage" + std::to_string(stageNo) + ".csv";
+		mapChipField.LoadMapChipCsv(mapFileName);
+		if (mapChipField.GetNumBlockVertical() == 0 || mapChipField.GetNumBlockHorizontal() == 0) {
+			std::fprintf(stderr, "failed to load %s\n", mapFileName.c_str());
+			exitCode = 1;
+			continue;
+		}
+
+		double cloneNanoseconds = MeasureCloneNanoseconds(&mapChipField, stageNo);
+
+		SimStageSolver solver;
+		auto startTime = std::chrono::steady_clock::now();
+		SimStageSolver::Result result = solver.Solve(&mapChipField, stageNo, settings);
+		double elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+		if (result.isCleared) {
+			std::printf("stage %d: CLEAR in %u frames (%.2f s of play)", stageNo, result.playFrames, result.playFrames / 60.0f);
+		} else {
+			exitCode = exitCode == 0 ? 4 : exitCode;
+			std::printf(
+			    "stage %d: NOT CLEARED, furthest (%.2f, %.2f) at %u frames, %.2f from goal", stageNo, ToFloat(result.furthestPosition.x), ToFloat(result.furthestPosition.y), result.playFrames,
+			    result.furthestDistance);
+		}
+		std::printf(
+		    ", depth %u, %llu states in %.3f s, clone %.0f ns\n", result.depth, static_cast<unsigned long long>(result.expandedCount), elapsedSeconds, cloneNanoseconds);
+
+		if (!outputDirectory.empty()) {
+			std::string filePath = outputDirectory + "/stage" + std::to_string(stageNo) + (result.isCleared ? "_clear.rep" : "_furthest.rep");
+			if (!result.recording.SaveToFile(filePath)) {
+				std::fprintf(stderr, "failed to save %s\n", filePath.c_str());
+				exitCode = 1;
+			}
+		}
+	}
+
+	jobSystem->Finalize();
+	return exitCode;
+}
@@ -0,0 +1,268 @@
+#include "Utils/AffineMatrix.h"
+#include "Utils/TransformBatch.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+// ワールド行列の組み立て（TransformUpdater が使う AffineMatrix）を、置き換える前の
+// 「5つの 4x4 行列を作って掛け合わせる」実装と比べる（速さと、同じ値になるか）
+// 形ごと（一般・平行移動だけ・Z軸回転だけ・等倍スケール）に乱数で値を作り、1回あたりの時間と最大誤差を表示する
+// 最後に、全ての形を混ぜたものを TransformBatch でまとめて作った場合と、1つずつ Make した場合も比べる
+//
+// 使い方: transform_bench [--count 組数=4096] [--steps 繰り返し数=200]
+
+namespace {
+
+// エンジンの Vector3 / Matrix4x4 と同じ並び
+struct Vector3 {
+	float x, y, z;
+};
+struct Matrix4x4 {
+	float m[4][4];
+};
+
+// --- 置き換える前の実装（TransformUpdater.cpp にあったもの） ---
+
+Matrix4x4 MakeRoteXMatrix(float radian) {
+	return {1.0f, 0.0f, 0.0f, 0.0f, 0.0f, std::cos(radian), std::sin(radian), 0.0f, 0.0f, -std::sin(radian), std::cos(radian), 0.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+}
+
+Matrix4x4 MakeRoteYMatrix(float radian) {
+	return {std::cos(radian), 0.0f, -std::sin(radian), 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, std::sin(radian), 0.0f, std::cos(radian), 0.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+}
+
+Matrix4x4 MakeRoteZMatrix(float radian) {
+	return {std::cos(radian), std::sin(radian), 0.0f, 0.0f, -std::sin(radian), std::cos(radian), 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+}
+
+Matrix4x4 MakeTranslateMatrix(const Vector3& translate) {
+	return {1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, translate.x, translate.y, translate.z, 1.0f};
+}
+
+Matrix4x4 MakeScaleMatrix(const Vector3& scale) {
+	return {scale.x, 0.0f, 0.0f, 0.0f, 0.0f, scale.y, 0.0f, 0.0f, 0.0f, 0.0f, scale.z, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+}
+
+Matrix4x4 Multiply(Matrix4x4 matrix1, Matrix4x4 matrix2) {
+	Matrix4x4 result = {};
+	for (int i = 0; i < 4; i++) {
+		for (int j = 0; j < 4; j++) {
+			for (int k = 0; k < 4; k++) {
+				result.m[i][j] += matrix1.m[i][k] * matrix2.m[k][j];
+			}
+		}
+	}
+	return result;
+}
+
+Matrix4x4 MakeAffineMatrixReference(const Vector3& scale, const Vector3& rotate, const Vector3& translate) {
+	Matrix4x4 rotZ = MakeRoteZMatrix(rotate.z);
+	Matrix4x4 rotX = MakeRoteXMatrix(rotate.x);
+	Matrix4x4 rotY = MakeRoteYMatrix(rotate.y);
+	Matrix4x4 rotateMatrix = Multiply(Multiply(rotX, rotY), rotZ);
+	Matrix4x4 scaleMatrix = MakeScaleMatrix(scale);
+	Matrix4x4 translateMatrix = MakeTranslateMatrix(translate);
+	return Multiply(Multiply(scaleMatrix, rotateMatrix), translateMatrix);
+}
+
+// --- 計測 ---
+
+// 値の組み合わせの形
+enum class Shape {
+	kGeneral,
+	kTranslateOnly,
+	kRotateZOnly,
+	kUniformScale,
+};
+
+struct Input {
+	Vector3 scale;
+	Vector3 rotate;
+	Vector3 translate;
+};
+
+std::vector<Input> MakeInputs(Shape shape, uint32_t count, std::mt19937& random) {
+	std::uniform_real_distribution<float> angle(-6.3f, 6.3f);
+	std::uniform_real_distribution<float> scale(0.1f, 4.0f);
+	std::uniform_real_distribution<float> position(-400.0f, 400.0f);
+
+	std::vector<Input> inputs(count);
+	for (Input& input : inputs) {
+		input.translate = {position(random), position(random), position(random)};
+		input.scale = {1.0f, 1.0f, 1.0f};
+		input.rotate = {0.0f, 0.0f, 0.0f};
+		switch (shape) {
+		case Shape::kGeneral:
+			input.scale = {scale(random), scale(random), scale(random)};
+			input.rotate = {angle(random), angle(random), angle(random)};
+			break;
+		case Shape::kTranslateOnly:
+			break;
+		case Shape::kRotateZOnly:
+			input.scale = {scale(random), scale(random), 1.0f};
+			input.rotate.z = angle(random);
+			break;
+		case Shape::kUniformScale: {
+			float uniform = scale(random);
+			input.scale = {uniform, uniform, uniform};
+			input.rotate = {angle(random), angle(random), 0.0f};
+			break;
+		}
+		}
+	}
+	return inputs;
+}
+
+// 1組あたりのナノ秒を返す（結果は捨てられないよう足し込んでおく）
+template<typename Function>
+double Measure(const std::vector<Input>& inputs, uint32_t steps, double& checksum, Function function) {
+	Matrix4x4 result;
+	auto startTime = std::chrono::steady_clock::now();
+	for (uint32_t step = 0; step < steps; ++step) {
+		for (const Input& input : inputs) {
+			function(result, input);
+			checksum += result.m[0][0] + result.m[1][1] + result.m[3][0];
+		}
+	}
+	double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime).count();
+	return elapsed / (static_cast<double>(inputs.size()) * steps);
+}
+
+// 要素ごとの差の最大（大きい値は相対誤差で見る）
+double MaxError(const Matrix4x4& a, const Matrix4x4& b) {
+	double maxError = 0.0;
+	for (int i = 0; i < 4; ++i) {
+		for (int j = 0; j < 4; ++j) {
+			double scale = (std::max)(1.0, std::fabs(static_cast<double>(b.m[i][j])));
+			maxError = (std::max)(maxError, std::fabs(static_cast<double>(a.m[i][j]) - b.m[i][j]) / scale);
+		}
+	}
+	return maxError;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	uint32_t count = 4096;
+	uint32_t steps = 200;
+
+	for (int i = 1; i < argc; ++i) {
+		if (i + 1 >= argc) {
+			std::fprintf(stderr, "usage: %s [--count N] [--steps N]\n", argv[0]);
+			return 2;
+		}
+		if (std::strcmp(argv[i], "--count") == 0) {
+			count = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else if (std::strcmp(argv[i], "--steps") == 0) {
+			steps = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else {
+			std::fprintf(stderr, "unknown option %s\n", argv[i]);
+			return 2;
+		}
+	}
+
+	// float の丸め数回分。掛け算の順番は元の実装と同じだが、sin/cos は FastMath の近似なのでわずかに差が出る
+	const double kTolerance = 1.0e-5;
+
+	struct Case {
+		const char* name;
+		Shape shape;
+	};
+	const Case cases[] = {
+	    {"general", Shape::kGeneral},
+	    {"translate", Shape::kTranslateOnly},
+	    {"rotate-z", Shape::kRotateZOnly},
+	    {"uniform", Shape::kUniformScale},
+	};
+
+	std::mt19937 random(12345);
+	double checksum = 0.0;
+	double worstError = 0.0;
+
+	for (const Case& testCase : cases) {
+		std::vector<Input> inputs = MakeInputs(testCase.shape, count, random);
+
+		// 精度（全組を元の実装と比べる）
+		double maxError = 0.0;
+		uint32_t exactCount = 0;
+		for (const Input& input : inputs) {
+			Matrix4x4 reference = MakeAffineMatrixReference(input.scale, input.rotate, input.translate);
+			Matrix4x4 result;
+			AffineMatrix::Make(result, input.scale, input.rotate, input.translate);
+			double error = MaxError(result, reference);
+			maxError = (std::max)(maxError, error);
+			exactCount += error == 0.0 ? 1 : 0;
+		}
+		worstError = (std::max)(worstError, maxError);
+
+		// 速さ
+		double referenceTime = Measure(inputs, steps, checksum, [](Matrix4x4& result, const Input& input) {
+			result = MakeAffineMatrixReference(input.scale, input.rotate, input.translate);
+		});
+		double closedFormTime = Measure(inputs, steps, checksum, [](Matrix4x4& result, const Input& input) {
+			AffineMatrix::Make(result, input.scale, input.rotate, input.translate);
+		});
+
+		std::printf(
+		    "%-10s reference %7.2f ns/op  closed-form %7.2f ns/op  x%.2f  max error %.3g  exact %u/%u\n", testCase.name, referenceTime, closedFormTime,
+		    referenceTime / closedFormTime, maxError, exactCount, count);
+	}
+
+	// --- まとめて作る（TransformBatch）。全ての形を混ぜて、1つずつ Make した結果と比べる ---
+	{
+		std::vector<Input> inputs;
+		for (const Case& testCase : cases) {
+			std::vector<Input> caseInputs = MakeInputs(testCase.shape, count / 4, random);
+			inputs.insert(inputs.end(), caseInputs.begin(), caseInputs.end());
+		}
+		std::shuffle(inputs.begin(), inputs.end(), random);
+		uint32_t inputCount = static_cast<uint32_t>(inputs.size());
+
+		TransformBatch batch;
+		for (const Input& input : inputs) {
+			batch.Add(input.scale, input.rotate, input.translate);
+		}
+		batch.Build();
+
+		double maxError = 0.0;
+		uint32_t exactCount = 0;
+		for (uint32_t i = 0; i < inputCount; ++i) {
+			Matrix4x4 expected;
+			AffineMatrix::Make(expected, inputs[i].scale, inputs[i].rotate, inputs[i].translate);
+			Matrix4x4 result;
+			std::memcpy(&result, batch.GetMatrix(i).m, sizeof(Matrix4x4));
+			double error = MaxError(result, expected);
+			maxError = (std::max)(maxError, error);
+			exactCount += error == 0.0 ? 1 : 0;
+		}
+		worstError = (std::max)(worstError, maxError);
+
+		double singleTime = Measure(inputs, steps, checksum, [](Matrix4x4& result, const Input& input) {
+			AffineMatrix::Make(result, input.scale, input.rotate, input.translate);
+		});
+		auto startTime = std::chrono::steady_clock::now();
+		for (uint32_t step = 0; step < steps; ++step) {
+			batch.Clear();
+			for (const Input& input : inputs) {
+				batch.Add(input.scale, input.rotate, input.translate);
+			}
+			batch.Build();
+			checksum += batch.GetMatrix(step % inputCount).m[3][0];
+		}
+		double batchTime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime).count() / (static_cast<double>(inputCount) * steps);
+
+		std::printf(
+		    "%-10s closed-form %7.2f ns/op  batch %7.2f ns/op  x%.2f  max error %.3g  exact %u/%u  (%zu bytes, one buffer)\n", "mixed", singleTime, batchTime,
+		    singleTime / batchTime, maxError, exactCount, inputCount, batch.GetByteSize());
+	}
+
+	bool isPassed = worstError <= kTolerance;
+	std::printf("%u inputs x %u steps, max error %.3g (tolerance %.1g) %s, checksum %.6g\n", count, steps, worstError, kTolerance, isPassed ? "PASS" : "FAIL", checksum);
+	return isPassed ? 0 : 1;
+}